@@ -0,0 +1,922 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_acquisition.c
+ * @brief     driver adxl362 acquisition source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_adxl362_acquisition.h"
+
+static adxl362_handle_t gs_handle;                                                    /**< adxl362 handle */
+static adxl362_frame_t gs_frame[512];                                                 /**< fifo frame */
+static void (*gs_callback)(adxl362_frame_t *frame, uint16_t frame_len) = NULL;        /**< callback function */
+static adxl362_acquisition_plan_t gs_plan;                                            /**< current plan */
+static adxl362_odr_t gs_odr;                                                          /**< current odr */
+static adxl362_bool_t gs_irq_wired;                                                   /**< int pin wired flag */
+static uint32_t gs_latency_ms;                                                        /**< latency target */
+static uint32_t gs_irq_cost_us;                                                       /**< irq cost used by the planner */
+static uint32_t (*gs_clock_us)(void) = NULL;                                          /**< clock to measure the irq cost */
+static uint32_t gs_irq_cost_avg;                                                      /**< running irq cost average << shift */
+static uint32_t gs_irq_count;                                                         /**< timed irq counter */
+static uint32_t gs_drain_us;                                                          /**< fifo drain time inside the timed irq */
+static uint32_t gs_poll_ms;                                                           /**< polling time since the last probe */
+static volatile uint32_t gs_overrun;                                                  /**< fifo overrun counter */
+
+/**
+ * @brief odr in mHz definition
+ */
+static const uint32_t gsc_odr_mhz[6] = {12500, 25000, 50000, 100000, 200000, 400000};
+
+/**
+ * @brief      select the acquisition mode
+ * @param[in]  odr output data rate
+ * @param[in]  latency_ms latency target in ms
+ * @param[in]  irq_cost_us measured cost of one interrupt in us
+ * @param[in]  irq_wired bool value, ADXL362_BOOL_FALSE if the int pin is not connected
+ * @param[out] *plan pointer to a plan structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 select failed
+ * @note       data ready is used when the interrupt load stays inside the budget and the latency target
+ *             is shorter than two samples, watermark draining is used when the latency target allows
+ *             batching and polling is used when the interrupt line is missing or too expensive
+ */
+uint8_t adxl362_acquisition_select(adxl362_odr_t odr, uint32_t latency_ms, uint32_t irq_cost_us,
+                                   adxl362_bool_t irq_wired, adxl362_acquisition_plan_t *plan)
+{
+    uint32_t rate;
+    uint32_t batch;
+    uint32_t period_ms;
+    uint64_t load;
+
+    /* check the params */
+    if ((plan == NULL) || (odr > ADXL362_ODR_400HZ))
+    {
+        return 1;
+    }
+
+    /* samples inside the latency target */
+    rate = gsc_odr_mhz[odr];
+    batch = (uint32_t)(((uint64_t)latency_ms * rate) / 1000000U);
+    if (batch > ADXL362_ACQUISITION_MAX_WATERMARK)
+    {
+        batch = ADXL362_ACQUISITION_MAX_WATERMARK;
+    }
+
+    /* the longest polling period which keeps the fifo below half full */
+    period_ms = (uint32_t)(((uint64_t)ADXL362_ACQUISITION_MAX_WATERMARK * 1000000U) / rate);
+    if (period_ms > latency_ms)
+    {
+        period_ms = latency_ms;
+    }
+    if (period_ms == 0)
+    {
+        period_ms = 1;
+    }
+
+    /* interrupt time per second with one interrupt per sample */
+    load = ((uint64_t)irq_cost_us * rate) / 1000U;
+
+    /* set the default plan */
+    plan->mode = ADXL362_ACQUISITION_MODE_POLLING;
+    plan->watermark = 0;
+    plan->poll_period_ms = period_ms;
+    plan->irq_cost_us = irq_cost_us;
+
+    /* the int pin is not connected */
+    if (irq_wired == ADXL362_BOOL_FALSE)
+    {
+        return 0;
+    }
+
+    /* check the batch */
+    if (batch < 2)
+    {
+        /* per sample interrupt is affordable */
+        if (load <= ADXL362_ACQUISITION_DEFAULT_IRQ_BUDGET_US)
+        {
+            plan->mode = ADXL362_ACQUISITION_MODE_DATA_READY;
+            plan->watermark = 1;
+        }
+    }
+    else
+    {
+        /* one interrupt per batch is affordable */
+        if ((load / batch) <= ADXL362_ACQUISITION_DEFAULT_IRQ_BUDGET_US)
+        {
+            plan->mode = ADXL362_ACQUISITION_MODE_WATERMARK;
+            plan->watermark = (uint16_t)batch;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief  drain the fifo
+ * @return status code
+ *         - 0 success
+ *         - 1 drain failed
+ * @note   none
+ */
+static uint8_t a_adxl362_acquisition_drain(void)
+{
+    uint8_t res;
+    uint16_t frame_len;
+    uint32_t start;
+
+    /* the drain grows with the samples, keep it out of the irq cost */
+    start = (gs_clock_us != NULL) ? gs_clock_us() : 0;
+
+    /* total 512 */
+    frame_len = 512;
+
+    /* read fifo */
+    res = adxl362_read_fifo(&gs_handle, gs_frame, &frame_len);
+    if (res != 0)
+    {
+        return 1;
+    }
+
+    /* if not null */
+    if ((gs_callback != NULL) && (frame_len != 0))
+    {
+        /* run the callback */
+        gs_callback(gs_frame, frame_len);
+    }
+
+    /* add the drain time */
+    if (gs_clock_us != NULL)
+    {
+        gs_drain_us += gs_clock_us() - start;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     apply an acquisition plan
+ * @param[in] *plan pointer to a plan structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 apply failed
+ * @note      the fifo keeps streaming while the interrupt map is changed, so no sample is lost
+ */
+static uint8_t a_adxl362_acquisition_apply(const adxl362_acquisition_plan_t *plan)
+{
+    uint8_t res;
+    uint16_t sample;
+    adxl362_bool_t data_ready;
+    adxl362_bool_t watermark;
+    adxl362_bool_t overrun;
+
+    /* flush the samples collected under the old plan */
+    res = a_adxl362_acquisition_drain();
+    if (res != 0)
+    {
+        return 1;
+    }
+
+    /* set the watermark in fifo entries */
+    sample = (plan->mode == ADXL362_ACQUISITION_MODE_WATERMARK) ? (uint16_t)(plan->watermark * 3) :
+             (uint16_t)(ADXL362_ACQUISITION_MAX_WATERMARK * 3);
+    res = adxl362_set_fifo_sample(&gs_handle, sample);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: set fifo sample failed.\n");
+
+        return 1;
+    }
+
+    /* set the interrupt sources */
+    data_ready = (plan->mode == ADXL362_ACQUISITION_MODE_DATA_READY) ? ADXL362_BOOL_TRUE : ADXL362_BOOL_FALSE;
+    watermark = (plan->mode == ADXL362_ACQUISITION_MODE_WATERMARK) ? ADXL362_BOOL_TRUE : ADXL362_BOOL_FALSE;
+    overrun = gs_irq_wired;
+
+    /* set data ready map */
+    res = adxl362_set_interrupt_pin1_map(&gs_handle, ADXL362_INTERRUPT_MAP_DATA_READY, data_ready);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: set interrupt pin1 map failed.\n");
+
+        return 1;
+    }
+
+    /* set fifo watermark map */
+    res = adxl362_set_interrupt_pin1_map(&gs_handle, ADXL362_INTERRUPT_MAP_FIFO_WATERMARK, watermark);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: set interrupt pin1 map failed.\n");
+
+        return 1;
+    }
+
+    /* set fifo overrun map */
+    res = adxl362_set_interrupt_pin1_map(&gs_handle, ADXL362_INTERRUPT_MAP_FIFO_OVERRUN, overrun);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: set interrupt pin1 map failed.\n");
+
+        return 1;
+    }
+
+    /* save the plan */
+    gs_plan = *plan;
+    gs_poll_ms = 0;
+
+    return 0;
+}
+
+/**
+ * @brief  select and apply the plan for the current settings
+ * @return status code
+ *         - 0 success
+ *         - 1 update failed
+ * @note   none
+ */
+static uint8_t a_adxl362_acquisition_update(void)
+{
+    adxl362_acquisition_plan_t plan;
+
+    /* select the plan */
+    if (adxl362_acquisition_select(gs_odr, gs_latency_ms, gs_irq_cost_us, gs_irq_wired, &plan) != 0)
+    {
+        return 1;
+    }
+
+    /* only the polling period changed */
+    if ((plan.mode == gs_plan.mode) && (plan.watermark == gs_plan.watermark))
+    {
+        gs_plan.poll_period_ms = plan.poll_period_ms;
+        gs_plan.irq_cost_us = plan.irq_cost_us;
+
+        return 0;
+    }
+
+    /* output */
+    adxl362_interface_debug_print("adxl362: acquisition mode %d, watermark %d, poll period %dms.\n",
+                                  plan.mode, plan.watermark, plan.poll_period_ms);
+
+    return a_adxl362_acquisition_apply(&plan);
+}
+
+/**
+ * @brief  acquisition irq
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   with a clock set by adxl362_acquisition_set_clock the handler is timed without the fifo drain,
+ *         the running average replans the mode when it moves more than a quarter away from the planned cost
+ */
+uint8_t adxl362_acquisition_irq_handler(void)
+{
+    uint32_t start;
+    uint32_t cost;
+
+    /* no clock */
+    if (gs_clock_us == NULL)
+    {
+        if (adxl362_irq_handler(&gs_handle) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+
+    /* time the handler */
+    gs_drain_us = 0;
+    start = gs_clock_us();
+    if (adxl362_irq_handler(&gs_handle) != 0)
+    {
+        return 1;
+    }
+    cost = gs_clock_us() - start;
+
+    /* only the fixed cost of one interrupt is planned for */
+    cost = (cost > gs_drain_us) ? (cost - gs_drain_us) : 0;
+
+    /* running average, seeded with the first interrupt */
+    if (gs_irq_count == 0)
+    {
+        gs_irq_cost_avg = cost << ADXL362_ACQUISITION_IRQ_COST_SHIFT;
+    }
+    else
+    {
+        gs_irq_cost_avg = gs_irq_cost_avg - (gs_irq_cost_avg >> ADXL362_ACQUISITION_IRQ_COST_SHIFT) + cost;
+    }
+    if (gs_irq_count < (1U << ADXL362_ACQUISITION_IRQ_COST_SHIFT))
+    {
+        gs_irq_count++;
+
+        return 0;
+    }
+
+    /* replan only on a clear change to avoid switching back and forth */
+    cost = gs_irq_cost_avg >> ADXL362_ACQUISITION_IRQ_COST_SHIFT;
+    if ((cost > gs_irq_cost_us + gs_irq_cost_us / 4) || (cost + cost / 4 < gs_irq_cost_us))
+    {
+        gs_irq_cost_us = cost;
+        if (a_adxl362_acquisition_update() != 0)
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief  acquisition timer tick
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   call it every poll_period_ms in the polling mode, it drains the fifo in the other modes too,
+ *         no interrupt is timed while polling, so with a clock and a wired int pin the interrupt
+ *         modes are probed again every ADXL362_ACQUISITION_PROBE_MS
+ */
+uint8_t adxl362_acquisition_poll(void)
+{
+    /* drain the fifo */
+    if (a_adxl362_acquisition_drain() != 0)
+    {
+        return 1;
+    }
+
+    /* only a polling plan which could run on the interrupt needs a probe */
+    if ((gs_plan.mode != ADXL362_ACQUISITION_MODE_POLLING) || (gs_irq_wired == ADXL362_BOOL_FALSE) ||
+        (gs_clock_us == NULL))
+    {
+        return 0;
+    }
+
+    /* wait for the probe period */
+    gs_poll_ms += gs_plan.poll_period_ms;
+    if (gs_poll_ms < ADXL362_ACQUISITION_PROBE_MS)
+    {
+        return 0;
+    }
+    gs_poll_ms = 0;
+
+    /* replan with the default cost and measure it again, a still expensive interrupt returns to polling */
+    if (gs_irq_cost_us > ADXL362_ACQUISITION_DEFAULT_IRQ_COST_US)
+    {
+        gs_irq_cost_us = ADXL362_ACQUISITION_DEFAULT_IRQ_COST_US;
+        gs_irq_cost_avg = 0;
+        gs_irq_count = 0;
+
+        return a_adxl362_acquisition_update();
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     interface receive callback
+ * @param[in] type irq type
+ * @note      none
+ */
+static void a_adxl362_interface_receive_callback(uint8_t type)
+{
+    switch (type)
+    {
+        case ADXL362_STATUS_ERR_USER_REGS :
+        {
+            adxl362_interface_debug_print("adxl362: irq seu error detect.\n");
+
+            break;
+        }
+        case ADXL362_STATUS_AWAKE :
+        {
+            break;
+        }
+        case ADXL362_STATUS_INACT :
+        {
+            break;
+        }
+        case ADXL362_STATUS_ACT :
+        {
+            break;
+        }
+        case ADXL362_STATUS_FIFO_OVERRUN :
+        {
+            /* count the lost samples */
+            gs_overrun++;
+
+            /* output */
+            adxl362_interface_debug_print("adxl362: irq fifo overrun.\n");
+
+            break;
+        }
+        case ADXL362_STATUS_FIFO_WATERMARK :
+        {
+            /* the status bit is set in all modes */
+            if (gs_plan.mode == ADXL362_ACQUISITION_MODE_WATERMARK)
+            {
+                (void)a_adxl362_acquisition_drain();
+            }
+
+            break;
+        }
+        case ADXL362_STATUS_FIFO_READY :
+        {
+            break;
+        }
+        case ADXL362_STATUS_DATA_READY :
+        {
+            /* the status bit is set in all modes */
+            if (gs_plan.mode == ADXL362_ACQUISITION_MODE_DATA_READY)
+            {
+                (void)a_adxl362_acquisition_drain();
+            }
+
+            break;
+        }
+        default :
+        {
+            adxl362_interface_debug_print("adxl362: unknown code.\n");
+
+            break;
+        }
+    }
+}
+
+/**
+ * @brief     acquisition example init
+ * @param[in] odr output data rate
+ * @param[in] latency_ms latency target in ms
+ * @param[in] irq_wired bool value, ADXL362_BOOL_FALSE if the int pin is not connected
+ * @param[in] *callback pointer to a callback function
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the fifo always runs in the stream mode, so a mode switch never drops samples
+ */
+uint8_t adxl362_acquisition_init(adxl362_odr_t odr, uint32_t latency_ms, adxl362_bool_t irq_wired,
+                                 void (*callback)(adxl362_frame_t *frame, uint16_t frame_len))
+{
+    uint8_t res;
+    adxl362_acquisition_plan_t plan;
+
+    /* link interface function */
+    DRIVER_ADXL362_LINK_INIT(&gs_handle, adxl362_handle_t);
+    DRIVER_ADXL362_LINK_SPI_INIT(&gs_handle, adxl362_interface_spi_init);
+    DRIVER_ADXL362_LINK_SPI_DEINIT(&gs_handle, adxl362_interface_spi_deinit);
+    DRIVER_ADXL362_LINK_SPI_READ(&gs_handle, adxl362_interface_spi_read);
+    DRIVER_ADXL362_LINK_SPI_READ_ADDRESS16(&gs_handle, adxl362_interface_spi_read_address16);
+    DRIVER_ADXL362_LINK_SPI_WRITE_ADDRESS16(&gs_handle, adxl362_interface_spi_write_address16);
+    DRIVER_ADXL362_LINK_DELAY_MS(&gs_handle, adxl362_interface_delay_ms);
+    DRIVER_ADXL362_LINK_DEBUG_PRINT(&gs_handle, adxl362_interface_debug_print);
+    DRIVER_ADXL362_LINK_RECEIVE_CALLBACK(&gs_handle, a_adxl362_interface_receive_callback);
+
+    /* select the first plan */
+    res = adxl362_acquisition_select(odr, latency_ms, ADXL362_ACQUISITION_DEFAULT_IRQ_COST_US, irq_wired, &plan);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: odr is invalid.\n");
+
+        return 1;
+    }
+
+    /* init the adxl362 */
+    res = adxl362_init(&gs_handle);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: init failed.\n");
+
+        return 1;
+    }
+
+    /* disable fifo temperature */
+    res = adxl362_set_fifo_temperature(&gs_handle, ADXL362_BOOL_FALSE);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: set fifo temperature failed.\n");
+        (void)adxl362_deinit(&gs_handle);
+
+        return 1;
+    }
+
+    /* set stream mode */
+    res = adxl362_set_fifo_mode(&gs_handle, ADXL362_FIFO_MODE_STREAM);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: set fifo mode failed.\n");
+        (void)adxl362_deinit(&gs_handle);
+
+        return 1;
+    }
+
+    /* set default interrupt pin1 active level */
+    res = adxl362_set_interrupt_pin1_active_level(&gs_handle, ADXL362_ACQUISITION_DEFAULT_INTERRUPT_PIN_LEVEL);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: set interrupt pin1 active level failed.\n");
+        (void)adxl362_deinit(&gs_handle);
+
+        return 1;
+    }
+
+    /* disable awake map */
+    res = adxl362_set_interrupt_pin1_map(&gs_handle, ADXL362_INTERRUPT_MAP_AWAKE, ADXL362_BOOL_FALSE);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: set interrupt pin1 map failed.\n");
+        (void)adxl362_deinit(&gs_handle);
+
+        return 1;
+    }
+
+    /* disable inact map */
+    res = adxl362_set_interrupt_pin1_map(&gs_handle, ADXL362_INTERRUPT_MAP_INACT, ADXL362_BOOL_FALSE);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: set interrupt pin1 map failed.\n");
+        (void)adxl362_deinit(&gs_handle);
+
+        return 1;
+    }
+
+    /* disable act map */
+    res = adxl362_set_interrupt_pin1_map(&gs_handle, ADXL362_INTERRUPT_MAP_ACT, ADXL362_BOOL_FALSE);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: set interrupt pin1 map failed.\n");
+        (void)adxl362_deinit(&gs_handle);
+
+        return 1;
+    }
+
+    /* disable fifo ready map */
+    res = adxl362_set_interrupt_pin1_map(&gs_handle, ADXL362_INTERRUPT_MAP_FIFO_READY, ADXL362_BOOL_FALSE);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: set interrupt pin1 map failed.\n");
+        (void)adxl362_deinit(&gs_handle);
+
+        return 1;
+    }
+
+    /* set interrupt pin2 active level low */
+    res = adxl362_set_interrupt_pin2_active_level(&gs_handle, ADXL362_INTERRUPT_PIN_LOW);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: set interrupt pin2 active level failed.\n");
+        (void)adxl362_deinit(&gs_handle);
+
+        return 1;
+    }
+
+    /* disable awake map */
+    res = adxl362_set_interrupt_pin2_map(&gs_handle, ADXL362_INTERRUPT_MAP_AWAKE, ADXL362_BOOL_FALSE);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: set interrupt pin2 map failed.\n");
+        (void)adxl362_deinit(&gs_handle);
+
+        return 1;
+    }
+
+    /* disable inact map */
+    res = adxl362_set_interrupt_pin2_map(&gs_handle, ADXL362_INTERRUPT_MAP_INACT, ADXL362_BOOL_FALSE);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: set interrupt pin2 map failed.\n");
+        (void)adxl362_deinit(&gs_handle);
+
+        return 1;
+    }
+
+    /* disable act map */
+    res = adxl362_set_interrupt_pin2_map(&gs_handle, ADXL362_INTERRUPT_MAP_ACT, ADXL362_BOOL_FALSE);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: set interrupt pin2 map failed.\n");
+        (void)adxl362_deinit(&gs_handle);
+
+        return 1;
+    }
+
+    /* disable fifo overrun map */
+    res = adxl362_set_interrupt_pin2_map(&gs_handle, ADXL362_INTERRUPT_MAP_FIFO_OVERRUN, ADXL362_BOOL_FALSE);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: set interrupt pin2 map failed.\n");
+        (void)adxl362_deinit(&gs_handle);
+
+        return 1;
+    }
+
+    /* disable fifo watermark map */
+    res = adxl362_set_interrupt_pin2_map(&gs_handle, ADXL362_INTERRUPT_MAP_FIFO_WATERMARK, ADXL362_BOOL_FALSE);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: set interrupt pin2 map failed.\n");
+        (void)adxl362_deinit(&gs_handle);
+
+        return 1;
+    }
+
+    /* disable fifo ready map */
+    res = adxl362_set_interrupt_pin2_map(&gs_handle, ADXL362_INTERRUPT_MAP_FIFO_READY, ADXL362_BOOL_FALSE);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: set interrupt pin2 map failed.\n");
+        (void)adxl362_deinit(&gs_handle);
+
+        return 1;
+    }
+
+    /* disable data ready map */
+    res = adxl362_set_interrupt_pin2_map(&gs_handle, ADXL362_INTERRUPT_MAP_DATA_READY, ADXL362_BOOL_FALSE);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: set interrupt pin2 map failed.\n");
+        (void)adxl362_deinit(&gs_handle);
+
+        return 1;
+    }
+
+    /* set default bandwidth */
+    res = adxl362_set_bandwidth(&gs_handle, ADXL362_ACQUISITION_DEFAULT_BANDWIDTH_ODR);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: set bandwidth failed.\n");
+        (void)adxl362_deinit(&gs_handle);
+
+        return 1;
+    }
+
+    /* set default noise mode */
+    res = adxl362_set_noise_mode(&gs_handle, ADXL362_ACQUISITION_DEFAULT_NOISE_MODE);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: set noise mode failed.\n");
+        (void)adxl362_deinit(&gs_handle);
+
+        return 1;
+    }
+
+    /* disable wake up */
+    res = adxl362_set_wake_up(&gs_handle, ADXL362_BOOL_FALSE);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: set wake up failed.\n");
+        (void)adxl362_deinit(&gs_handle);
+
+        return 1;
+    }
+
+    /* disable auto sleep */
+    res = adxl362_set_auto_sleep(&gs_handle, ADXL362_BOOL_FALSE);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: set auto sleep failed.\n");
+        (void)adxl362_deinit(&gs_handle);
+
+        return 1;
+    }
+
+    /* disable inactivity */
+    res = adxl362_set_inactivity(&gs_handle, ADXL362_BOOL_FALSE);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: set inactivity failed.\n");
+        (void)adxl362_deinit(&gs_handle);
+
+        return 1;
+    }
+
+    /* disable activity */
+    res = adxl362_set_activity(&gs_handle, ADXL362_BOOL_FALSE);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: set activity failed.\n");
+        (void)adxl362_deinit(&gs_handle);
+
+        return 1;
+    }
+
+    /* disable self test */
+    res = adxl362_set_self_test(&gs_handle, ADXL362_BOOL_FALSE);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: set self test failed.\n");
+        (void)adxl362_deinit(&gs_handle);
+
+        return 1;
+    }
+
+    /* set the odr */
+    res = adxl362_set_odr(&gs_handle, odr);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: set odr failed.\n");
+        (void)adxl362_deinit(&gs_handle);
+
+        return 1;
+    }
+
+    /* set default range */
+    res = adxl362_set_range(&gs_handle, ADXL362_ACQUISITION_DEFAULT_RANGE);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: set range failed.\n");
+        (void)adxl362_deinit(&gs_handle);
+
+        return 1;
+    }
+
+    /* save the settings */
+    gs_odr = odr;
+    gs_latency_ms = latency_ms;
+    gs_irq_cost_us = ADXL362_ACQUISITION_DEFAULT_IRQ_COST_US;
+    gs_irq_cost_avg = 0;
+    gs_irq_count = 0;
+    gs_irq_wired = irq_wired;
+    gs_drain_us = 0;
+    gs_poll_ms = 0;
+    gs_overrun = 0;
+    gs_callback = callback;
+
+    /* apply the first plan */
+    res = a_adxl362_acquisition_apply(&plan);
+    if (res != 0)
+    {
+        (void)adxl362_deinit(&gs_handle);
+
+        return 1;
+    }
+
+    /* start measurement */
+    res = adxl362_set_mode(&gs_handle, ADXL362_MODE_MEASUREMENT);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: set mode failed.\n");
+        (void)adxl362_deinit(&gs_handle);
+
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     set the measured interrupt cost and switch the mode if needed
+ * @param[in] irq_cost_us cost of one interrupt in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 set irq cost failed
+ * @note      call it from the same context as the irq handler or with the interrupt masked
+ */
+uint8_t adxl362_acquisition_set_irq_cost(uint32_t irq_cost_us)
+{
+    /* save the cost */
+    gs_irq_cost_us = irq_cost_us;
+
+    return a_adxl362_acquisition_update();
+}
+
+/**
+ * @brief     set the clock used to measure the interrupt cost
+ * @param[in] *clock_us pointer to a microsecond clock function, NULL stops the measurement
+ * @return    status code
+ *            - 0 success
+ * @note      the clock may wrap, call it before adxl362_acquisition_init
+ */
+uint8_t adxl362_acquisition_set_clock(uint32_t (*clock_us)(void))
+{
+    /* save the clock */
+    gs_clock_us = clock_us;
+    gs_irq_cost_avg = 0;
+    gs_irq_count = 0;
+
+    return 0;
+}
+
+/**
+ * @brief     set the latency target and switch the mode if needed
+ * @param[in] latency_ms latency target in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 set latency failed
+ * @note      call it from the same context as the irq handler or with the interrupt masked
+ */
+uint8_t adxl362_acquisition_set_latency(uint32_t latency_ms)
+{
+    /* save the latency */
+    gs_latency_ms = latency_ms;
+
+    return a_adxl362_acquisition_update();
+}
+
+/**
+ * @brief     set the output data rate and switch the mode if needed
+ * @param[in] odr output data rate
+ * @return    status code
+ *            - 0 success
+ *            - 1 set odr failed
+ * @note      call it from the same context as the irq handler or with the interrupt masked
+ */
+uint8_t adxl362_acquisition_set_odr(adxl362_odr_t odr)
+{
+    uint8_t res;
+
+    /* check the odr */
+    if (odr > ADXL362_ODR_400HZ)
+    {
+        return 1;
+    }
+
+    /* flush the samples of the old rate */
+    res = a_adxl362_acquisition_drain();
+    if (res != 0)
+    {
+        return 1;
+    }
+
+    /* set the odr */
+    res = adxl362_set_odr(&gs_handle, odr);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: set odr failed.\n");
+
+        return 1;
+    }
+    gs_odr = odr;
+
+    return a_adxl362_acquisition_update();
+}
+
+/**
+ * @brief      get the current acquisition plan
+ * @param[out] *plan pointer to a plan structure
+ * @param[out] *overrun pointer to a fifo overrun counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get plan failed
+ * @note       none
+ */
+uint8_t adxl362_acquisition_get_plan(adxl362_acquisition_plan_t *plan, uint32_t *overrun)
+{
+    /* check the params */
+    if ((plan == NULL) || (overrun == NULL))
+    {
+        return 1;
+    }
+
+    /* copy the plan */
+    *plan = gs_plan;
+    *overrun = gs_overrun;
+
+    return 0;
+}
+
+/**
+ * @brief  acquisition example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t adxl362_acquisition_deinit(void)
+{
+    /* deinit */
+    if (adxl362_deinit(&gs_handle) != 0)
+    {
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,204 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_acquisition.h
+ * @brief     driver adxl362 acquisition header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADXL362_ACQUISITION_H
+#define DRIVER_ADXL362_ACQUISITION_H
+
+#include "driver_adxl362_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup adxl362_example_driver
+ * @{
+ */
+
+/**
+ * @brief adxl362 acquisition example default definition
+ */
+#define ADXL362_ACQUISITION_DEFAULT_INTERRUPT_PIN_LEVEL        ADXL362_INTERRUPT_PIN_LOW            /**< activity low */
+#define ADXL362_ACQUISITION_DEFAULT_BANDWIDTH_ODR              ADXL362_BANDWIDTH_ODR_DIV_2          /**< bandwidth odr 1/2 */
+#define ADXL362_ACQUISITION_DEFAULT_NOISE_MODE                 ADXL362_NOISE_MODE_NORMAL            /**< normal noise mode */
+#define ADXL362_ACQUISITION_DEFAULT_RANGE                      ADXL362_RANGE_2G                     /**< 2g */
+#define ADXL362_ACQUISITION_DEFAULT_IRQ_COST_US                50                                   /**< 50us per interrupt until measured */
+#define ADXL362_ACQUISITION_IRQ_COST_SHIFT                     3                                    /**< irq cost averaged over 8 interrupts */
+#define ADXL362_ACQUISITION_DEFAULT_IRQ_BUDGET_US              20000                                /**< 20ms interrupt time per second */
+#define ADXL362_ACQUISITION_MAX_WATERMARK                      85                                   /**< half of the fifo in samples */
+#define ADXL362_ACQUISITION_PROBE_MS                           10000                                /**< probe the interrupt modes every 10s of polling */
+
+/**
+ * @brief adxl362 acquisition mode enumeration definition
+ */
+typedef enum
+{
+    ADXL362_ACQUISITION_MODE_DATA_READY = 0x00,        /**< one interrupt per sample */
+    ADXL362_ACQUISITION_MODE_POLLING    = 0x01,        /**< timer driven fifo polling */
+    ADXL362_ACQUISITION_MODE_WATERMARK  = 0x02,        /**< fifo watermark draining */
+} adxl362_acquisition_mode_t;
+
+/**
+ * @brief adxl362 acquisition plan structure definition
+ */
+typedef struct adxl362_acquisition_plan_s
+{
+    adxl362_acquisition_mode_t mode;        /**< selected mode */
+    uint16_t watermark;                     /**< samples per watermark interrupt */
+    uint32_t poll_period_ms;                /**< polling period in ms */
+    uint32_t irq_cost_us;                   /**< interrupt cost the plan was selected for */
+} adxl362_acquisition_plan_t;
+
+/**
+ * @brief      select the acquisition mode
+ * @param[in]  odr output data rate
+ * @param[in]  latency_ms latency target in ms
+ * @param[in]  irq_cost_us measured cost of one interrupt in us
+ * @param[in]  irq_wired bool value, ADXL362_BOOL_FALSE if the int pin is not connected
+ * @param[out] *plan pointer to a plan structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 select failed
+ * @note       data ready is used when the interrupt load stays inside the budget and the latency target
+ *             is shorter than two samples, watermark draining is used when the latency target allows
+ *             batching and polling is used when the interrupt line is missing or too expensive
+ */
+uint8_t adxl362_acquisition_select(adxl362_odr_t odr, uint32_t latency_ms, uint32_t irq_cost_us,
+                                   adxl362_bool_t irq_wired, adxl362_acquisition_plan_t *plan);
+
+/**
+ * @brief  acquisition irq
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   with a clock set by adxl362_acquisition_set_clock the handler is timed without the fifo drain,
+ *         the running average replans the mode when it moves more than a quarter away from the planned cost
+ */
+uint8_t adxl362_acquisition_irq_handler(void);
+
+/**
+ * @brief  acquisition timer tick
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   call it every poll_period_ms in the polling mode, it drains the fifo in the other modes too,
+ *         no interrupt is timed while polling, so with a clock and a wired int pin the interrupt
+ *         modes are probed again every ADXL362_ACQUISITION_PROBE_MS
+ */
+uint8_t adxl362_acquisition_poll(void);
+
+/**
+ * @brief     acquisition example init
+ * @param[in] odr output data rate
+ * @param[in] latency_ms latency target in ms
+ * @param[in] irq_wired bool value, ADXL362_BOOL_FALSE if the int pin is not connected
+ * @param[in] *callback pointer to a callback function
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the fifo always runs in the stream mode, so a mode switch never drops samples
+ */
+uint8_t adxl362_acquisition_init(adxl362_odr_t odr, uint32_t latency_ms, adxl362_bool_t irq_wired,
+                                 void (*callback)(adxl362_frame_t *frame, uint16_t frame_len));
+
+/**
+ * @brief     set the measured interrupt cost and switch the mode if needed
+ * @param[in] irq_cost_us cost of one interrupt in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 set irq cost failed
+ * @note      call it from the same context as the irq handler or with the interrupt masked
+ */
+uint8_t adxl362_acquisition_set_irq_cost(uint32_t irq_cost_us);
+
+/**
+ * @brief     set the clock used to measure the interrupt cost
+ * @param[in] *clock_us pointer to a microsecond clock function, NULL stops the measurement
+ * @return    status code
+ *            - 0 success
+ * @note      the clock may wrap, call it before adxl362_acquisition_init
+ */
+uint8_t adxl362_acquisition_set_clock(uint32_t (*clock_us)(void));
+
+/**
+ * @brief     set the latency target and switch the mode if needed
+ * @param[in] latency_ms latency target in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 set latency failed
+ * @note      call it from the same context as the irq handler or with the interrupt masked
+ */
+uint8_t adxl362_acquisition_set_latency(uint32_t latency_ms);
+
+/**
+ * @brief     set the output data rate and switch the mode if needed
+ * @param[in] odr output data rate
+ * @return    status code
+ *            - 0 success
+ *            - 1 set odr failed
+ * @note      call it from the same context as the irq handler or with the interrupt masked
+ */
+uint8_t adxl362_acquisition_set_odr(adxl362_odr_t odr);
+
+/**
+ * @brief      get the current acquisition plan
+ * @param[out] *plan pointer to a plan structure
+ * @param[out] *overrun pointer to a fifo overrun counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get plan failed
+ * @note       none
+ */
+uint8_t adxl362_acquisition_get_plan(adxl362_acquisition_plan_t *plan, uint32_t *overrun);
+
+/**
+ * @brief  acquisition example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t adxl362_acquisition_deinit(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
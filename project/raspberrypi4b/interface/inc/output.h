@@ -0,0 +1,124 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      output.h
+ * @brief     output header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef OUTPUT_H
+#define OUTPUT_H
+
+#include <unistd.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/**
+ * @defgroup output output function
+ * @brief    output function modules
+ * @{
+ */
+
+/**
+ * @brief output definition
+ */
+#define OUTPUT_BUFFER_SIZE      (256 * 1024)        /**< output buffer size in bytes */
+#define OUTPUT_RECORD_MAX       64                  /**< max bytes of one formatted record */
+
+/**
+ * @brief output format enumeration definition
+ */
+typedef enum
+{
+    OUTPUT_FORMAT_CSV = 0x00,        /**< index,x,y,z text lines in mg */
+    OUTPUT_FORMAT_BIN = 0x01,        /**< packed int16 x, y, z triplets in mg */
+} output_format_t;
+
+/**
+ * @brief output handle structure definition
+ */
+typedef struct output_s
+{
+    int fd;                                 /**< output fd */
+    output_format_t format;                 /**< output format */
+    uint32_t len;                           /**< buffered bytes */
+    uint64_t index;                         /**< written samples */
+    uint64_t bytes;                         /**< flushed bytes */
+    uint32_t writes;                        /**< write calls */
+    char buf[OUTPUT_BUFFER_SIZE];           /**< output buffer */
+} output_t;
+
+/**
+ * @brief      output init
+ * @param[out] *output pointer to an output handle
+ * @param[in]  fd output fd
+ * @param[in]  format output format
+ * @note       none
+ */
+void output_init(output_t *output, int fd, output_format_t format);
+
+/**
+ * @brief     append triplets to the output buffer
+ * @param[in] *output pointer to an output handle
+ * @param[in] *xyz pointer to a packed x, y, z raw triplet buffer
+ * @param[in] count triplet count
+ * @param[in] shift mg per lsb as a power of 2, 0 for 2g, 1 for 4g and 2 for 8g
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush failed
+ * @note      the buffer is only flushed when it runs full, both formats are in mg,
+ *            so a binary record reads the same in every range
+ */
+uint8_t output_triplets(output_t *output, const int16_t *xyz, uint32_t count, uint8_t shift);
+
+/**
+ * @brief     flush the output buffer
+ * @param[in] *output pointer to an output handle
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush failed
+ * @note      the whole buffer goes out with one write call unless the fd takes a short write
+ */
+uint8_t output_flush(output_t *output);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,192 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      shm.h
+ * @brief     shm header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef SHM_H
+#define SHM_H
+
+#include <unistd.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/**
+ * @defgroup shm shm function
+ * @brief    shm function modules
+ * @{
+ */
+
+/**
+ * @brief shm ring definition
+ */
+#define SHM_RING_MAGIC          0x32363341U        /**< "A362" */
+#define SHM_RING_VERSION        1                  /**< layout version */
+#define SHM_RING_DEFAULT_NAME   "/adxl362"         /**< default shm name */
+#define SHM_RING_LOCK_DIR       "/dev/shm"         /**< writer lock file directory */
+
+/**
+ * @brief shm ring header structure definition
+ */
+typedef struct shm_ring_header_s
+{
+    uint32_t magic;             /**< magic number */
+    uint32_t version;           /**< layout version */
+    uint32_t slot_count;        /**< slot count, power of 2 */
+    uint32_t slot_size;         /**< slot size in bytes */
+    uint32_t sensor_id;         /**< sensor id */
+    uint32_t odr_mhz;           /**< output data rate in mHz */
+    uint64_t head;              /**< published sample count */
+} shm_ring_header_t;
+
+/**
+ * @brief shm ring slot structure definition
+ */
+typedef struct shm_ring_slot_s
+{
+    uint32_t seq;               /**< sequence counter, odd while the slot is written */
+    uint32_t range;             /**< adxl362 range */
+    uint64_t index;             /**< sample index */
+    uint64_t timestamp_ns;      /**< CLOCK_MONOTONIC timestamp */
+    int16_t raw[3];             /**< raw data */
+    int16_t reserved;           /**< reserved */
+    float g[3];                 /**< converted data */
+    uint32_t padding;           /**< padding to 48 bytes */
+} shm_ring_slot_t;
+
+/**
+ * @brief shm ring handle structure definition
+ */
+typedef struct shm_ring_s
+{
+    int fd;                             /**< shm fd */
+    int lock_fd;                        /**< writer lock fd */
+    size_t size;                        /**< mapped size */
+    uint8_t owner;                      /**< owner flag */
+    char name[64];                      /**< shm name */
+    shm_ring_header_t *header;          /**< mapped header */
+    shm_ring_slot_t *slot;              /**< mapped slots */
+} shm_ring_t;
+
+/**
+ * @brief      create a ring as the only writer
+ * @param[out] *ring pointer to a ring handle
+ * @param[in]  *name pointer to a shm name buffer
+ * @param[in]  slot_count slot count, must be a power of 2
+ * @param[in]  sensor_id sensor id
+ * @param[in]  odr_mhz output data rate in mHz
+ * @return     status code
+ *             - 0 success
+ *             - 1 create failed
+ * @note       the writer holds an exclusive lock on SHM_RING_LOCK_DIR/<name>.lock until the ring is closed,
+ *             the create fails while another writer holds it, an old ring of a dead writer is unlinked,
+ *             never truncated, so its readers keep a valid mapping until they reopen
+ */
+uint8_t shm_ring_create(shm_ring_t *ring, const char *name, uint32_t slot_count, uint32_t sensor_id, uint32_t odr_mhz);
+
+/**
+ * @brief      open a ring as a reader
+ * @param[out] *ring pointer to a ring handle
+ * @param[in]  *name pointer to a shm name buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 open failed
+ * @note       the ring is mapped read only, readers never write to the shared memory
+ */
+uint8_t shm_ring_open(shm_ring_t *ring, const char *name);
+
+/**
+ * @brief     publish one sample
+ * @param[in] *ring pointer to a ring handle
+ * @param[in] *raw pointer to a raw data buffer
+ * @param[in] *g pointer to a converted data buffer
+ * @param[in] range adxl362 range
+ * @param[in] timestamp_ns sample timestamp
+ * @note      only one writer is allowed
+ */
+void shm_ring_publish(shm_ring_t *ring, const int16_t raw[3], const float g[3], uint32_t range, uint64_t timestamp_ns);
+
+/**
+ * @brief     get the published sample count
+ * @param[in] *ring pointer to a ring handle
+ * @return    published sample count
+ * @note      none
+ */
+uint64_t shm_ring_head(shm_ring_t *ring);
+
+/**
+ * @brief      read one sample
+ * @param[in]  *ring pointer to a ring handle
+ * @param[in]  index sample index
+ * @param[out] *slot pointer to a slot buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 sample is not published yet
+ *             - 2 sample is overwritten
+ * @note       the seqlock retries while the writer is inside the slot
+ */
+uint8_t shm_ring_read(shm_ring_t *ring, uint64_t index, shm_ring_slot_t *slot);
+
+/**
+ * @brief     check if the ring name points to a new ring
+ * @param[in] *ring pointer to a ring handle
+ * @return    status code
+ *            - 0 the ring is current or the name is gone
+ *            - 1 a writer created a new ring, reopen it
+ * @note      call it when no sample arrives for a while
+ */
+uint8_t shm_ring_replaced(shm_ring_t *ring);
+
+/**
+ * @brief     close a ring
+ * @param[in] *ring pointer to a ring handle
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      the writer also unlinks the shm name
+ */
+uint8_t shm_ring_close(shm_ring_t *ring);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,155 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      sink.h
+ * @brief     sink header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef SINK_H
+#define SINK_H
+
+#include <unistd.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/**
+ * @defgroup sink sink function
+ * @brief    sink function modules
+ * @{
+ */
+
+/**
+ * @brief sink definition
+ */
+#define SINK_FRAME_MAGIC        0x4B4E5341U                  /**< "ASNK" */
+#define SINK_MAX_CLIENTS        8                            /**< max clients */
+#define SINK_QUEUE_SIZE         (64 * 1024)                  /**< per client queue size in bytes */
+#define SINK_MAX_SAMPLES        512                          /**< max triplets in one frame */
+#define SINK_DEFAULT_PATH       "/tmp/adxl362.sock"          /**< default socket path */
+
+/**
+ * @brief sink frame header structure definition
+ * @note  the header is followed by count packed int16 x, y, z triplets in host byte order
+ */
+typedef struct sink_frame_header_s
+{
+    uint32_t magic;             /**< magic number */
+    uint16_t sensor_id;         /**< sensor id */
+    uint16_t range;             /**< full scale range in g */
+    uint64_t timestamp_ns;      /**< CLOCK_MONOTONIC time of the last sample */
+    uint32_t count;             /**< triplet count */
+    uint32_t reserved;          /**< reserved */
+} sink_frame_header_t;
+
+/**
+ * @brief sink client structure definition
+ */
+typedef struct sink_client_s
+{
+    int fd;                     /**< client fd, -1 if the slot is free */
+    int flags;                  /**< fd flags before the sink took the fd */
+    uint8_t borrowed;           /**< 1 if the fd belongs to the caller */
+    uint8_t *queue;             /**< queue buffer */
+    uint32_t head;              /**< read position */
+    uint32_t used;              /**< queued bytes */
+} sink_client_t;
+
+/**
+ * @brief sink handle structure definition
+ */
+typedef struct sink_s
+{
+    int listen_fd;                              /**< listen socket, -1 for a pipe sink */
+    char path[108];                             /**< socket path */
+    uint16_t sensor_id;                         /**< sensor id */
+    uint32_t dropped;                           /**< dropped clients */
+    sink_client_t client[SINK_MAX_CLIENTS];     /**< clients */
+} sink_t;
+
+/**
+ * @brief      open a unix domain socket sink
+ * @param[out] *sink pointer to a sink handle
+ * @param[in]  *path pointer to a socket path buffer
+ * @param[in]  sensor_id sensor id
+ * @return     status code
+ *             - 0 success
+ *             - 1 open failed
+ * @note       clients are accepted while publishing, a stale socket at path is replaced,
+ *             any other file at path fails the open
+ */
+uint8_t sink_open_socket(sink_t *sink, const char *path, uint16_t sensor_id);
+
+/**
+ * @brief      open a pipe sink
+ * @param[out] *sink pointer to a sink handle
+ * @param[in]  fd pipe fd
+ * @param[in]  sensor_id sensor id
+ * @return     status code
+ *             - 0 success
+ *             - 1 open failed
+ * @note       the pipe is the only client and is dropped like a socket client when it stalls,
+ *             the fd is never closed and gets its flags back when it is dropped or the sink closes
+ */
+uint8_t sink_open_fd(sink_t *sink, int fd, uint16_t sensor_id);
+
+/**
+ * @brief     publish one frame to all clients
+ * @param[in] *sink pointer to a sink handle
+ * @param[in] timestamp_ns CLOCK_MONOTONIC time of the last sample
+ * @param[in] range full scale range in g
+ * @param[in] *xyz pointer to a packed x, y, z triplet buffer
+ * @param[in] count triplet count
+ * @return    connected clients
+ * @note      never blocks, a client whose queue cannot hold the frame is dropped
+ */
+uint32_t sink_publish(sink_t *sink, uint64_t timestamp_ns, uint16_t range, const int16_t *xyz, uint32_t count);
+
+/**
+ * @brief     close the sink
+ * @param[in] *sink pointer to a sink handle
+ * @note      none
+ */
+void sink_close(sink_t *sink);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
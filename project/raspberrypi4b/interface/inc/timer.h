@@ -0,0 +1,137 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      timer.h
+ * @brief     timer header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef TIMER_H
+#define TIMER_H
+
+#include <unistd.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/**
+ * @defgroup timer timer function
+ * @brief    timer function modules
+ * @{
+ */
+
+/**
+ * @brief timer statistics structure definition
+ */
+typedef struct timer_stat_s
+{
+    uint64_t ticks;                 /**< handled ticks */
+    uint64_t missed;                /**< ticks lost to overruns */
+    uint64_t jitter_min_ns;         /**< min wake up delay after the deadline */
+    uint64_t jitter_max_ns;         /**< max wake up delay after the deadline */
+    uint64_t jitter_sum_ns;         /**< sum of the wake up delays */
+    uint64_t latency_min_ns;        /**< min read latency */
+    uint64_t latency_max_ns;        /**< max read latency */
+    uint64_t latency_sum_ns;        /**< sum of the read latencies */
+} timer_stat_t;
+
+/**
+ * @brief timer handle structure definition
+ */
+typedef struct timer_handle_s
+{
+    int fd;                         /**< timerfd */
+    uint64_t period_ns;             /**< tick period */
+    uint64_t start_ns;              /**< first absolute deadline */
+    uint64_t tick;                  /**< expired ticks since the start */
+    uint64_t wake_ns;               /**< last wake up time */
+    timer_stat_t stat;              /**< statistics */
+} timer_handle_t;
+
+/**
+ * @brief  get the monotonic time
+ * @return time in ns
+ * @note   none
+ */
+uint64_t timer_monotonic_ns(void);
+
+/**
+ * @brief      periodic timer init
+ * @param[out] *handle pointer to a timer handle
+ * @param[in]  period_us tick period in us
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       the timer uses absolute CLOCK_MONOTONIC deadlines, so the loop body never adds drift
+ */
+uint8_t timer_periodic_init(timer_handle_t *handle, uint32_t period_us);
+
+/**
+ * @brief      wait for the next tick
+ * @param[in]  *handle pointer to a timer handle
+ * @param[out] *deadline_ns pointer to a deadline buffer
+ * @param[out] *missed pointer to a missed tick buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 wait failed
+ * @note       deadline_ns is start + n * period, it is the drift free sample clock
+ */
+uint8_t timer_periodic_wait(timer_handle_t *handle, uint64_t *deadline_ns, uint64_t *missed);
+
+/**
+ * @brief     record the read latency of the current tick
+ * @param[in] *handle pointer to a timer handle
+ * @note      call it after the sample is read
+ */
+void timer_periodic_mark(timer_handle_t *handle);
+
+/**
+ * @brief     periodic timer deinit
+ * @param[in] *handle pointer to a timer handle
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t timer_periodic_deinit(timer_handle_t *handle);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
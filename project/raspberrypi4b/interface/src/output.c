@@ -0,0 +1,257 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      output.c
+ * @brief     output source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "output.h"
+#include <errno.h>
+#include <string.h>
+
+/**
+ * @brief two digit lookup table
+ */
+static const char gsc_digits[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+/**
+ * @brief     format an unsigned integer
+ * @param[in] *p pointer to an output buffer
+ * @param[in] v value
+ * @return    pointer after the last digit
+ * @note      two digits per division, no locale and no format parsing
+ */
+static inline char *a_output_utoa(char *p, uint64_t v)
+{
+    char tmp[20];
+    char *t;
+    uint32_t d;
+
+    /* fill from the end */
+    t = tmp + sizeof(tmp);
+    while (v >= 100)
+    {
+        d = (uint32_t)(v % 100) * 2;
+        v /= 100;
+        *--t = gsc_digits[d + 1];
+        *--t = gsc_digits[d];
+    }
+    if (v >= 10)
+    {
+        d = (uint32_t)v * 2;
+        *--t = gsc_digits[d + 1];
+        *--t = gsc_digits[d];
+    }
+    else
+    {
+        *--t = (char)('0' + v);
+    }
+
+    /* copy out */
+    d = (uint32_t)(tmp + sizeof(tmp) - t);
+    memcpy(p, t, d);
+
+    return p + d;
+}
+
+/**
+ * @brief     format a signed integer
+ * @param[in] *p pointer to an output buffer
+ * @param[in] v value
+ * @return    pointer after the last digit
+ * @note      none
+ */
+static inline char *a_output_itoa(char *p, int32_t v)
+{
+    if (v < 0)
+    {
+        *p++ = '-';
+
+        return a_output_utoa(p, (uint64_t)(-(int64_t)v));
+    }
+
+    return a_output_utoa(p, (uint64_t)v);
+}
+
+/**
+ * @brief      output init
+ * @param[out] *output pointer to an output handle
+ * @param[in]  fd output fd
+ * @param[in]  format output format
+ * @note       none
+ */
+void output_init(output_t *output, int fd, output_format_t format)
+{
+    output->fd = fd;
+    output->format = format;
+    output->len = 0;
+    output->index = 0;
+    output->bytes = 0;
+    output->writes = 0;
+}
+
+/**
+ * @brief     flush the output buffer
+ * @param[in] *output pointer to an output handle
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush failed
+ * @note      the whole buffer goes out with one write call unless the fd takes a short write
+ */
+uint8_t output_flush(output_t *output)
+{
+    uint32_t offset;
+    ssize_t n;
+
+    /* write until the buffer is empty */
+    offset = 0;
+    while (offset < output->len)
+    {
+        n = write(output->fd, output->buf + offset, output->len - offset);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            perror("output: write failed.\n");
+            output->len = 0;
+
+            return 1;
+        }
+        offset += (uint32_t)n;
+        output->writes++;
+    }
+    output->bytes += output->len;
+    output->len = 0;
+
+    return 0;
+}
+
+/**
+ * @brief     append triplets to the output buffer
+ * @param[in] *output pointer to an output handle
+ * @param[in] *xyz pointer to a packed x, y, z raw triplet buffer
+ * @param[in] count triplet count
+ * @param[in] shift mg per lsb as a power of 2, 0 for 2g, 1 for 4g and 2 for 8g
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush failed
+ * @note      the buffer is only flushed when it runs full, both formats are in mg,
+ *            so a binary record reads the same in every range
+ */
+uint8_t output_triplets(output_t *output, const int16_t *xyz, uint32_t count, uint8_t shift)
+{
+    uint32_t i;
+    uint32_t len;
+    char *p;
+    int16_t t[3];
+
+    /* binary records are scaled to mg, 2047 lsb in the 8g range is 8188mg and still fits */
+    if (output->format == OUTPUT_FORMAT_BIN)
+    {
+        while (count != 0)
+        {
+            len = (OUTPUT_BUFFER_SIZE - output->len) / (3 * sizeof(int16_t));
+            if (len == 0)
+            {
+                if (output_flush(output) != 0)
+                {
+                    return 1;
+                }
+                continue;
+            }
+            if (len > count)
+            {
+                len = count;
+            }
+            if (shift == 0)
+            {
+                memcpy(output->buf + output->len, xyz, len * 3 * sizeof(int16_t));
+            }
+            else
+            {
+                for (i = 0; i < len; i++)
+                {
+                    t[0] = (int16_t)(xyz[i * 3 + 0] * (1 << shift));
+                    t[1] = (int16_t)(xyz[i * 3 + 1] * (1 << shift));
+                    t[2] = (int16_t)(xyz[i * 3 + 2] * (1 << shift));
+                    memcpy(output->buf + output->len + i * 3 * sizeof(int16_t), t, sizeof(t));
+                }
+            }
+            output->len += len * 3 * (uint32_t)sizeof(int16_t);
+            output->index += len;
+            xyz += len * 3;
+            count -= len;
+        }
+
+        return 0;
+    }
+
+    /* csv records */
+    for (i = 0; i < count; i++)
+    {
+        /* make room for the worst case record */
+        if (OUTPUT_BUFFER_SIZE - output->len < OUTPUT_RECORD_MAX)
+        {
+            if (output_flush(output) != 0)
+            {
+                return 1;
+            }
+        }
+
+        /* index,x,y,z */
+        p = output->buf + output->len;
+        p = a_output_utoa(p, output->index);
+        *p++ = ',';
+        p = a_output_itoa(p, (int32_t)xyz[i * 3 + 0] * (1 << shift));
+        *p++ = ',';
+        p = a_output_itoa(p, (int32_t)xyz[i * 3 + 1] * (1 << shift));
+        *p++ = ',';
+        p = a_output_itoa(p, (int32_t)xyz[i * 3 + 2] * (1 << shift));
+        *p++ = '\n';
+        output->len = (uint32_t)(p - output->buf);
+        output->index++;
+    }
+
+    return 0;
+}
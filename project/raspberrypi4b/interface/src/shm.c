@@ -0,0 +1,407 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      shm.c
+ * @brief     shm source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "shm.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/**
+ * @brief      create a ring as the only writer
+ * @param[out] *ring pointer to a ring handle
+ * @param[in]  *name pointer to a shm name buffer
+ * @param[in]  slot_count slot count, must be a power of 2
+ * @param[in]  sensor_id sensor id
+ * @param[in]  odr_mhz output data rate in mHz
+ * @return     status code
+ *             - 0 success
+ *             - 1 create failed
+ * @note       the writer holds an exclusive lock on SHM_RING_LOCK_DIR/<name>.lock until the ring is closed,
+ *             the create fails while another writer holds it, an old ring of a dead writer is unlinked,
+ *             never truncated, so its readers keep a valid mapping until they reopen
+ */
+uint8_t shm_ring_create(shm_ring_t *ring, const char *name, uint32_t slot_count, uint32_t sensor_id, uint32_t odr_mhz)
+{
+    void *addr;
+    char path[128];
+
+    /* check the slot count */
+    if ((slot_count == 0) || ((slot_count & (slot_count - 1)) != 0))
+    {
+        fprintf(stderr, "shm: slot count must be a power of 2.\n");
+
+        return 1;
+    }
+
+    /* take the writer lock, it is released by the kernel if the writer dies */
+    memset(ring, 0, sizeof(shm_ring_t));
+    (void)snprintf(path, sizeof(path), "%s%s%s.lock", SHM_RING_LOCK_DIR, (name[0] == '/') ? "" : "/", name);
+    ring->lock_fd = open(path, O_CREAT | O_RDWR | O_CLOEXEC, 0644);
+    if (ring->lock_fd < 0)
+    {
+        perror("shm: lock open failed.\n");
+
+        return 1;
+    }
+    if (flock(ring->lock_fd, LOCK_EX | LOCK_NB) != 0)
+    {
+        if (errno == EWOULDBLOCK)
+        {
+            fprintf(stderr, "shm: ring %s is owned by another writer.\n", name);
+        }
+        else
+        {
+            perror("shm: lock failed.\n");
+        }
+        (void)close(ring->lock_fd);
+
+        return 1;
+    }
+
+    /* save the pid for the tools */
+    if (ftruncate(ring->lock_fd, 0) == 0)
+    {
+        (void)dprintf(ring->lock_fd, "%ld\n", (long)getpid());
+    }
+
+    /* drop the old name, live readers keep their mapping of the old object */
+    if ((shm_unlink(name) != 0) && (errno != ENOENT))
+    {
+        perror("shm: unlink failed.\n");
+        (void)close(ring->lock_fd);
+
+        return 1;
+    }
+
+    /* open a fresh shm */
+    ring->fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (ring->fd < 0)
+    {
+        perror("shm: open failed.\n");
+        (void)close(ring->lock_fd);
+
+        return 1;
+    }
+
+    /* set the size */
+    ring->size = sizeof(shm_ring_header_t) + (size_t)slot_count * sizeof(shm_ring_slot_t);
+    if (ftruncate(ring->fd, (off_t)ring->size) != 0)
+    {
+        perror("shm: truncate failed.\n");
+        (void)close(ring->fd);
+        (void)shm_unlink(name);
+        (void)close(ring->lock_fd);
+
+        return 1;
+    }
+
+    /* map the memory */
+    addr = mmap(NULL, ring->size, PROT_READ | PROT_WRITE, MAP_SHARED, ring->fd, 0);
+    if (addr == MAP_FAILED)
+    {
+        perror("shm: map failed.\n");
+        (void)close(ring->fd);
+        (void)shm_unlink(name);
+        (void)close(ring->lock_fd);
+
+        return 1;
+    }
+
+    /* init the header */
+    ring->header = (shm_ring_header_t *)addr;
+    ring->slot = (shm_ring_slot_t *)((uint8_t *)addr + sizeof(shm_ring_header_t));
+    ring->owner = 1;
+    strncpy(ring->name, name, sizeof(ring->name) - 1);
+    memset(addr, 0, ring->size);
+    ring->header->version = SHM_RING_VERSION;
+    ring->header->slot_count = slot_count;
+    ring->header->slot_size = (uint32_t)sizeof(shm_ring_slot_t);
+    ring->header->sensor_id = sensor_id;
+    ring->header->odr_mhz = odr_mhz;
+
+    /* readers check the magic last */
+    __atomic_store_n(&ring->header->magic, SHM_RING_MAGIC, __ATOMIC_RELEASE);
+
+    return 0;
+}
+
+/**
+ * @brief      open a ring as a reader
+ * @param[out] *ring pointer to a ring handle
+ * @param[in]  *name pointer to a shm name buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 open failed
+ * @note       the ring is mapped read only, readers never write to the shared memory
+ */
+uint8_t shm_ring_open(shm_ring_t *ring, const char *name)
+{
+    void *addr;
+    struct stat st;
+    shm_ring_header_t *header;
+
+    /* open the shm */
+    memset(ring, 0, sizeof(shm_ring_t));
+    ring->lock_fd = -1;
+    ring->fd = shm_open(name, O_RDONLY, 0);
+    if (ring->fd < 0)
+    {
+        perror("shm: open failed.\n");
+
+        return 1;
+    }
+
+    /* get the size */
+    if ((fstat(ring->fd, &st) != 0) || ((size_t)st.st_size < sizeof(shm_ring_header_t)))
+    {
+        fprintf(stderr, "shm: ring is invalid.\n");
+        (void)close(ring->fd);
+
+        return 1;
+    }
+    ring->size = (size_t)st.st_size;
+
+    /* map the memory */
+    addr = mmap(NULL, ring->size, PROT_READ, MAP_SHARED, ring->fd, 0);
+    if (addr == MAP_FAILED)
+    {
+        perror("shm: map failed.\n");
+        (void)close(ring->fd);
+
+        return 1;
+    }
+
+    /* check the layout */
+    header = (shm_ring_header_t *)addr;
+    if ((__atomic_load_n(&header->magic, __ATOMIC_ACQUIRE) != SHM_RING_MAGIC) ||
+        (header->version != SHM_RING_VERSION) ||
+        (header->slot_size != sizeof(shm_ring_slot_t)) ||
+        (sizeof(shm_ring_header_t) + (size_t)header->slot_count * sizeof(shm_ring_slot_t) > ring->size))
+    {
+        fprintf(stderr, "shm: ring layout is invalid.\n");
+        (void)munmap(addr, ring->size);
+        (void)close(ring->fd);
+
+        return 1;
+    }
+
+    /* save the pointers */
+    ring->header = header;
+    ring->slot = (shm_ring_slot_t *)((uint8_t *)addr + sizeof(shm_ring_header_t));
+    ring->owner = 0;
+    strncpy(ring->name, name, sizeof(ring->name) - 1);
+
+    return 0;
+}
+
+/**
+ * @brief     publish one sample
+ * @param[in] *ring pointer to a ring handle
+ * @param[in] *raw pointer to a raw data buffer
+ * @param[in] *g pointer to a converted data buffer
+ * @param[in] range adxl362 range
+ * @param[in] timestamp_ns sample timestamp
+ * @note      only one writer is allowed
+ */
+void shm_ring_publish(shm_ring_t *ring, const int16_t raw[3], const float g[3], uint32_t range, uint64_t timestamp_ns)
+{
+    uint32_t seq;
+    uint64_t head;
+    shm_ring_slot_t *slot;
+
+    /* get the slot */
+    head = ring->header->head;
+    slot = &ring->slot[head & (ring->header->slot_count - 1)];
+
+    /* mark the slot busy */
+    seq = slot->seq;
+    __atomic_store_n(&slot->seq, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    /* write the payload */
+    slot->range = range;
+    slot->index = head;
+    slot->timestamp_ns = timestamp_ns;
+    slot->raw[0] = raw[0];
+    slot->raw[1] = raw[1];
+    slot->raw[2] = raw[2];
+    slot->g[0] = g[0];
+    slot->g[1] = g[1];
+    slot->g[2] = g[2];
+
+    /* mark the slot stable and publish it */
+    __atomic_store_n(&slot->seq, seq + 2, __ATOMIC_RELEASE);
+    __atomic_store_n(&ring->header->head, head + 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief     get the published sample count
+ * @param[in] *ring pointer to a ring handle
+ * @return    published sample count
+ * @note      none
+ */
+uint64_t shm_ring_head(shm_ring_t *ring)
+{
+    return __atomic_load_n(&ring->header->head, __ATOMIC_ACQUIRE);
+}
+
+/**
+ * @brief      read one sample
+ * @param[in]  *ring pointer to a ring handle
+ * @param[in]  index sample index
+ * @param[out] *slot pointer to a slot buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 sample is not published yet
+ *             - 2 sample is overwritten
+ * @note       the seqlock retries while the writer is inside the slot
+ */
+uint8_t shm_ring_read(shm_ring_t *ring, uint64_t index, shm_ring_slot_t *slot)
+{
+    uint32_t seq0;
+    uint32_t seq1;
+    uint64_t head;
+    const shm_ring_slot_t *src;
+
+    /* check the index */
+    head = shm_ring_head(ring);
+    if (index >= head)
+    {
+        return 1;
+    }
+    if ((head - index) > ring->header->slot_count)
+    {
+        return 2;
+    }
+
+    /* read with the seqlock */
+    src = &ring->slot[index & (ring->header->slot_count - 1)];
+    do
+    {
+        seq0 = __atomic_load_n(&src->seq, __ATOMIC_ACQUIRE);
+        if ((seq0 & 1) != 0)
+        {
+            continue;
+        }
+        memcpy(slot, src, sizeof(shm_ring_slot_t));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        seq1 = __atomic_load_n(&src->seq, __ATOMIC_RELAXED);
+    } while (((seq0 & 1) != 0) || (seq0 != seq1));
+
+    /* the writer lapped the reader */
+    if (slot->index != index)
+    {
+        return 2;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     check if the ring name points to a new ring
+ * @param[in] *ring pointer to a ring handle
+ * @return    status code
+ *            - 0 the ring is current or the name is gone
+ *            - 1 a writer created a new ring, reopen it
+ * @note      call it when no sample arrives for a while
+ */
+uint8_t shm_ring_replaced(shm_ring_t *ring)
+{
+    int fd;
+    uint8_t res;
+    struct stat st_old;
+    struct stat st_new;
+
+    /* open the name */
+    fd = shm_open(ring->name, O_RDONLY, 0);
+    if (fd < 0)
+    {
+        return 0;
+    }
+
+    /* compare the objects */
+    res = 0;
+    if ((fstat(ring->fd, &st_old) == 0) && (fstat(fd, &st_new) == 0) &&
+        ((st_old.st_ino != st_new.st_ino) || (st_old.st_dev != st_new.st_dev)))
+    {
+        res = 1;
+    }
+    (void)close(fd);
+
+    return res;
+}
+
+/**
+ * @brief     close a ring
+ * @param[in] *ring pointer to a ring handle
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      the writer also unlinks the shm name
+ */
+uint8_t shm_ring_close(shm_ring_t *ring)
+{
+    uint8_t res;
+
+    /* unmap the memory */
+    res = 0;
+    if (munmap((void *)ring->header, ring->size) != 0)
+    {
+        perror("shm: unmap failed.\n");
+        res = 1;
+    }
+
+    /* close the fd */
+    (void)close(ring->fd);
+
+    /* unlink the name */
+    if (ring->owner != 0)
+    {
+        if (shm_unlink(ring->name) != 0)
+        {
+            perror("shm: unlink failed.\n");
+            res = 1;
+        }
+
+        /* release the writer lock after the name is gone */
+        (void)close(ring->lock_fd);
+    }
+
+    return res;
+}
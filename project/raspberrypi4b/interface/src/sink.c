@@ -0,0 +1,464 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      sink.c
+ * @brief     sink source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE        /**< accept4 */
+#endif
+
+#include "sink.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+
+/**
+ * @brief     drop a client
+ * @param[in] *sink pointer to a sink handle
+ * @param[in] *client pointer to a client
+ * @note      a borrowed fd is only given back, never closed
+ */
+static void a_sink_drop(sink_t *sink, sink_client_t *client)
+{
+    /* a borrowed fd is handed back as it came */
+    if (client->borrowed != 0)
+    {
+        (void)fcntl(client->fd, F_SETFL, client->flags);
+    }
+    else
+    {
+        (void)close(client->fd);
+    }
+    free(client->queue);
+    client->fd = -1;
+    client->queue = NULL;
+    client->head = 0;
+    client->used = 0;
+    sink->dropped++;
+}
+
+/**
+ * @brief     add a client
+ * @param[in] *sink pointer to a sink handle
+ * @param[in] fd client fd
+ * @param[in] borrowed 1 if the fd belongs to the caller
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ * @note      none
+ */
+static uint8_t a_sink_add(sink_t *sink, int fd, uint8_t borrowed)
+{
+    uint32_t i;
+    int flags;
+
+    /* get the flags */
+    flags = fcntl(fd, F_GETFL);
+    if (flags < 0)
+    {
+        return 1;
+    }
+
+    /* find a free slot */
+    for (i = 0; i < SINK_MAX_CLIENTS; i++)
+    {
+        if (sink->client[i].fd < 0)
+        {
+            sink->client[i].queue = (uint8_t *)malloc(SINK_QUEUE_SIZE);
+            if (sink->client[i].queue == NULL)
+            {
+                return 1;
+            }
+
+            /* set non blocking */
+            if (fcntl(fd, F_SETFL, flags | O_NONBLOCK) != 0)
+            {
+                free(sink->client[i].queue);
+                sink->client[i].queue = NULL;
+
+                return 1;
+            }
+            sink->client[i].fd = fd;
+            sink->client[i].flags = flags;
+            sink->client[i].borrowed = borrowed;
+            sink->client[i].head = 0;
+            sink->client[i].used = 0;
+
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * @brief     write the queued bytes of a client
+ * @param[in] *client pointer to a client
+ * @return    status code
+ *            - 0 success
+ *            - 1 client is broken
+ * @note      the queue is written with one writev, two vectors when it wraps
+ */
+static uint8_t a_sink_flush(sink_client_t *client)
+{
+    struct iovec iov[2];
+    uint32_t first;
+    ssize_t n;
+
+    /* nothing to do */
+    if (client->used == 0)
+    {
+        return 0;
+    }
+
+    /* split at the end of the buffer */
+    first = SINK_QUEUE_SIZE - client->head;
+    if (first > client->used)
+    {
+        first = client->used;
+    }
+    iov[0].iov_base = client->queue + client->head;
+    iov[0].iov_len = first;
+    iov[1].iov_base = client->queue;
+    iov[1].iov_len = client->used - first;
+    n = writev(client->fd, iov, (iov[1].iov_len != 0) ? 2 : 1);
+    if (n < 0)
+    {
+        return ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR)) ? 0 : 1;
+    }
+
+    /* consume */
+    client->head = (client->head + (uint32_t)n) % SINK_QUEUE_SIZE;
+    client->used -= (uint32_t)n;
+    if (client->used == 0)
+    {
+        client->head = 0;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     append bytes to a client queue
+ * @param[in] *client pointer to a client
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @note      the caller checks the free space
+ */
+static void a_sink_queue(sink_client_t *client, const uint8_t *buf, uint32_t len)
+{
+    uint32_t tail;
+    uint32_t first;
+
+    tail = (client->head + client->used) % SINK_QUEUE_SIZE;
+    first = SINK_QUEUE_SIZE - tail;
+    if (first > len)
+    {
+        first = len;
+    }
+    memcpy(client->queue + tail, buf, first);
+    memcpy(client->queue, buf + first, len - first);
+    client->used += len;
+}
+
+/**
+ * @brief      open a unix domain socket sink
+ * @param[out] *sink pointer to a sink handle
+ * @param[in]  *path pointer to a socket path buffer
+ * @param[in]  sensor_id sensor id
+ * @return     status code
+ *             - 0 success
+ *             - 1 open failed
+ * @note       clients are accepted while publishing, a stale socket at path is replaced,
+ *             any other file at path fails the open
+ */
+uint8_t sink_open_socket(sink_t *sink, const char *path, uint16_t sensor_id)
+{
+    uint32_t i;
+    struct sockaddr_un addr;
+    struct stat st;
+
+    /* check the path */
+    if (strlen(path) >= sizeof(addr.sun_path))
+    {
+        fprintf(stderr, "sink: path is too long.\n");
+
+        return 1;
+    }
+
+    /* init the handle */
+    memset(sink, 0, sizeof(sink_t));
+    for (i = 0; i < SINK_MAX_CLIENTS; i++)
+    {
+        sink->client[i].fd = -1;
+    }
+    sink->sensor_id = sensor_id;
+    strncpy(sink->path, path, sizeof(sink->path) - 1);
+
+    /* a closed client must not kill the acquisition */
+    (void)signal(SIGPIPE, SIG_IGN);
+
+    /* create the socket */
+    sink->listen_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (sink->listen_fd < 0)
+    {
+        perror("sink: socket failed.\n");
+
+        return 1;
+    }
+
+    /* bind and listen */
+    memset(&addr, 0, sizeof(struct sockaddr_un));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, path, sizeof(addr.sun_path) - 1);
+    if (lstat(path, &st) == 0)
+    {
+        /* never remove a file which is not a socket */
+        if (!S_ISSOCK(st.st_mode))
+        {
+            fprintf(stderr, "sink: %s is not a socket.\n", path);
+            (void)close(sink->listen_fd);
+
+            return 1;
+        }
+        (void)unlink(path);
+    }
+    if (bind(sink->listen_fd, (struct sockaddr *)&addr, sizeof(struct sockaddr_un)) != 0)
+    {
+        perror("sink: bind failed.\n");
+        (void)close(sink->listen_fd);
+
+        return 1;
+    }
+    if (listen(sink->listen_fd, SINK_MAX_CLIENTS) != 0)
+    {
+        perror("sink: listen failed.\n");
+        (void)close(sink->listen_fd);
+        (void)unlink(path);
+
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief      open a pipe sink
+ * @param[out] *sink pointer to a sink handle
+ * @param[in]  fd pipe fd
+ * @param[in]  sensor_id sensor id
+ * @return     status code
+ *             - 0 success
+ *             - 1 open failed
+ * @note       the pipe is the only client and is dropped like a socket client when it stalls,
+ *             the fd is never closed and gets its flags back when it is dropped or the sink closes
+ */
+uint8_t sink_open_fd(sink_t *sink, int fd, uint16_t sensor_id)
+{
+    uint32_t i;
+
+    /* init the handle */
+    memset(sink, 0, sizeof(sink_t));
+    for (i = 0; i < SINK_MAX_CLIENTS; i++)
+    {
+        sink->client[i].fd = -1;
+    }
+    sink->listen_fd = -1;
+    sink->sensor_id = sensor_id;
+
+    /* a closed reader must not kill the acquisition */
+    (void)signal(SIGPIPE, SIG_IGN);
+
+    /* add the pipe */
+    if (a_sink_add(sink, fd, 1) != 0)
+    {
+        fprintf(stderr, "sink: add pipe failed.\n");
+
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     publish one frame to all clients
+ * @param[in] *sink pointer to a sink handle
+ * @param[in] timestamp_ns CLOCK_MONOTONIC time of the last sample
+ * @param[in] range full scale range in g
+ * @param[in] *xyz pointer to a packed x, y, z triplet buffer
+ * @param[in] count triplet count
+ * @return    connected clients
+ * @note      never blocks, a client whose queue cannot hold the frame is dropped
+ */
+uint32_t sink_publish(sink_t *sink, uint64_t timestamp_ns, uint16_t range, const int16_t *xyz, uint32_t count)
+{
+    uint32_t i;
+    uint32_t len;
+    uint32_t connected;
+    int fd;
+    ssize_t n;
+    sink_frame_header_t header;
+    struct iovec iov[2];
+
+    /* accept the pending clients */
+    if (sink->listen_fd >= 0)
+    {
+        while ((fd = accept4(sink->listen_fd, NULL, NULL, SOCK_CLOEXEC | SOCK_NONBLOCK)) >= 0)
+        {
+            if (a_sink_add(sink, fd, 0) != 0)
+            {
+                (void)close(fd);
+            }
+        }
+    }
+
+    /* make the frame */
+    if (count > SINK_MAX_SAMPLES)
+    {
+        count = SINK_MAX_SAMPLES;
+    }
+    header.magic = SINK_FRAME_MAGIC;
+    header.sensor_id = sink->sensor_id;
+    header.range = range;
+    header.timestamp_ns = timestamp_ns;
+    header.count = count;
+    header.reserved = 0;
+    len = (uint32_t)(sizeof(sink_frame_header_t) + count * 3 * sizeof(int16_t));
+
+    /* send to all clients */
+    connected = 0;
+    for (i = 0; i < SINK_MAX_CLIENTS; i++)
+    {
+        sink_client_t *client = &sink->client[i];
+
+        if (client->fd < 0)
+        {
+            continue;
+        }
+
+        /* write the backlog first to keep the frames in order */
+        if (a_sink_flush(client) != 0)
+        {
+            a_sink_drop(sink, client);
+
+            continue;
+        }
+
+        /* a slow client is dropped instead of blocking the acquisition */
+        if (SINK_QUEUE_SIZE - client->used < len)
+        {
+            a_sink_drop(sink, client);
+
+            continue;
+        }
+
+        /* fast path, write the whole frame without copying */
+        n = 0;
+        if (client->used == 0)
+        {
+            iov[0].iov_base = &header;
+            iov[0].iov_len = sizeof(sink_frame_header_t);
+            iov[1].iov_base = (void *)xyz;
+            iov[1].iov_len = len - sizeof(sink_frame_header_t);
+            n = writev(client->fd, iov, 2);
+            if (n < 0)
+            {
+                if ((errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR))
+                {
+                    a_sink_drop(sink, client);
+
+                    continue;
+                }
+                n = 0;
+            }
+        }
+
+        /* queue the rest */
+        if ((uint32_t)n < sizeof(sink_frame_header_t))
+        {
+            a_sink_queue(client, (const uint8_t *)&header + n, (uint32_t)(sizeof(sink_frame_header_t) - n));
+            a_sink_queue(client, (const uint8_t *)xyz, len - (uint32_t)sizeof(sink_frame_header_t));
+        }
+        else if ((uint32_t)n < len)
+        {
+            a_sink_queue(client, (const uint8_t *)xyz + (n - sizeof(sink_frame_header_t)), len - (uint32_t)n);
+        }
+        connected++;
+    }
+
+    return connected;
+}
+
+/**
+ * @brief     close the sink
+ * @param[in] *sink pointer to a sink handle
+ * @note      none
+ */
+void sink_close(sink_t *sink)
+{
+    uint32_t i;
+
+    /* close the clients */
+    for (i = 0; i < SINK_MAX_CLIENTS; i++)
+    {
+        if (sink->client[i].fd >= 0)
+        {
+            if (sink->client[i].borrowed != 0)
+            {
+                (void)fcntl(sink->client[i].fd, F_SETFL, sink->client[i].flags);
+            }
+            else
+            {
+                (void)close(sink->client[i].fd);
+            }
+            free(sink->client[i].queue);
+            sink->client[i].fd = -1;
+            sink->client[i].queue = NULL;
+        }
+    }
+
+    /* close the socket */
+    if (sink->listen_fd >= 0)
+    {
+        (void)close(sink->listen_fd);
+        (void)unlink(sink->path);
+        sink->listen_fd = -1;
+    }
+}
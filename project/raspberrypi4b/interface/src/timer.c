@@ -0,0 +1,205 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      timer.c
+ * @brief     timer source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "timer.h"
+#include <errno.h>
+#include <string.h>
+#include <sys/timerfd.h>
+#include <time.h>
+
+/**
+ * @brief  get the monotonic time
+ * @return time in ns
+ * @note   none
+ */
+uint64_t timer_monotonic_ns(void)
+{
+    struct timespec ts;
+
+    /* get the time */
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief      periodic timer init
+ * @param[out] *handle pointer to a timer handle
+ * @param[in]  period_us tick period in us
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       the timer uses absolute CLOCK_MONOTONIC deadlines, so the loop body never adds drift
+ */
+uint8_t timer_periodic_init(timer_handle_t *handle, uint32_t period_us)
+{
+    struct itimerspec spec;
+
+    /* check the period */
+    if (period_us == 0)
+    {
+        fprintf(stderr, "timer: period is invalid.\n");
+
+        return 1;
+    }
+
+    /* create the timer */
+    memset(handle, 0, sizeof(timer_handle_t));
+    handle->fd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+    if (handle->fd < 0)
+    {
+        perror("timer: create failed.\n");
+
+        return 1;
+    }
+
+    /* set the first absolute deadline one period from now */
+    handle->period_ns = (uint64_t)period_us * 1000ULL;
+    handle->start_ns = timer_monotonic_ns() + handle->period_ns;
+    handle->stat.jitter_min_ns = UINT64_MAX;
+    handle->stat.latency_min_ns = UINT64_MAX;
+    spec.it_value.tv_sec = (time_t)(handle->start_ns / 1000000000ULL);
+    spec.it_value.tv_nsec = (long)(handle->start_ns % 1000000000ULL);
+    spec.it_interval.tv_sec = (time_t)(handle->period_ns / 1000000000ULL);
+    spec.it_interval.tv_nsec = (long)(handle->period_ns % 1000000000ULL);
+    if (timerfd_settime(handle->fd, TFD_TIMER_ABSTIME, &spec, NULL) != 0)
+    {
+        perror("timer: set time failed.\n");
+        (void)close(handle->fd);
+
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief      wait for the next tick
+ * @param[in]  *handle pointer to a timer handle
+ * @param[out] *deadline_ns pointer to a deadline buffer
+ * @param[out] *missed pointer to a missed tick buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 wait failed
+ * @note       deadline_ns is start + n * period, it is the drift free sample clock
+ */
+uint8_t timer_periodic_wait(timer_handle_t *handle, uint64_t *deadline_ns, uint64_t *missed)
+{
+    ssize_t n;
+    uint64_t expirations;
+    uint64_t deadline;
+    uint64_t jitter;
+
+    /* block until the deadline */
+    do
+    {
+        n = read(handle->fd, &expirations, sizeof(uint64_t));
+    } while ((n < 0) && (errno == EINTR));
+    if (n != (ssize_t)sizeof(uint64_t))
+    {
+        perror("timer: read failed.\n");
+
+        return 1;
+    }
+    handle->wake_ns = timer_monotonic_ns();
+
+    /* more than one expiration means the loop overran */
+    handle->tick += expirations;
+    handle->stat.ticks++;
+    handle->stat.missed += expirations - 1;
+    *missed = expirations - 1;
+
+    /* the newest deadline that expired */
+    deadline = handle->start_ns + (handle->tick - 1) * handle->period_ns;
+    *deadline_ns = deadline;
+
+    /* update the jitter */
+    jitter = (handle->wake_ns > deadline) ? (handle->wake_ns - deadline) : 0;
+    handle->stat.jitter_sum_ns += jitter;
+    if (jitter < handle->stat.jitter_min_ns)
+    {
+        handle->stat.jitter_min_ns = jitter;
+    }
+    if (jitter > handle->stat.jitter_max_ns)
+    {
+        handle->stat.jitter_max_ns = jitter;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     record the read latency of the current tick
+ * @param[in] *handle pointer to a timer handle
+ * @note      call it after the sample is read
+ */
+void timer_periodic_mark(timer_handle_t *handle)
+{
+    uint64_t latency;
+
+    /* update the latency */
+    latency = timer_monotonic_ns() - handle->wake_ns;
+    handle->stat.latency_sum_ns += latency;
+    if (latency < handle->stat.latency_min_ns)
+    {
+        handle->stat.latency_min_ns = latency;
+    }
+    if (latency > handle->stat.latency_max_ns)
+    {
+        handle->stat.latency_max_ns = latency;
+    }
+}
+
+/**
+ * @brief     periodic timer deinit
+ * @param[in] *handle pointer to a timer handle
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t timer_periodic_deinit(timer_handle_t *handle)
+{
+    /* close the timer */
+    if (close(handle->fd) != 0)
+    {
+        perror("timer: close failed.\n");
+
+        return 1;
+    }
+
+    return 0;
+}
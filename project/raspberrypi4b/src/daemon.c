@@ -0,0 +1,538 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      daemon.c
+ * @brief     daemon source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_adxl362_acquisition.h"
+#include "gpio.h"
+#include "shm.h"
+#include <getopt.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <time.h>
+
+uint8_t (*g_gpio_irq)(void) = NULL;                 /**< gpio irq function address */
+static volatile sig_atomic_t gs_running = 1;        /**< running flag */
+static shm_ring_t gs_ring;                          /**< shm ring */
+static uint64_t gs_period_ns;                       /**< sample period */
+
+/**
+ * @brief odr table definition
+ */
+static const struct
+{
+    const char *name;          /**< odr name */
+    adxl362_odr_t odr;         /**< odr */
+    uint32_t mhz;              /**< odr in mHz */
+} gsc_odr[6] =
+{
+    {"12.5", ADXL362_ODR_12P5HZ, 12500},
+    {"25", ADXL362_ODR_25HZ, 25000},
+    {"50", ADXL362_ODR_50HZ, 50000},
+    {"100", ADXL362_ODR_100HZ, 100000},
+    {"200", ADXL362_ODR_200HZ, 200000},
+    {"400", ADXL362_ODR_400HZ, 400000},
+};
+
+/**
+ * @brief     signal handler
+ * @param[in] signum signal number
+ * @note      none
+ */
+static void a_signal_handler(int signum)
+{
+    (void)signum;
+
+    /* stop the loop */
+    gs_running = 0;
+}
+
+/**
+ * @brief  get the monotonic time
+ * @return time in ns
+ * @note   none
+ */
+static uint64_t a_monotonic_ns(void)
+{
+    struct timespec ts;
+
+    /* get the time */
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief  get the microsecond clock
+ * @return time in us
+ * @note   it wraps, only differences are used
+ */
+static uint32_t a_clock_us(void)
+{
+    return (uint32_t)(a_monotonic_ns() / 1000U);
+}
+
+/**
+ * @brief     acquisition callback
+ * @param[in] *frame pointer to a frame buffer
+ * @param[in] frame_len length of frame
+ * @note      the sets are taken by the frame type, an incomplete set is dropped
+ */
+static void a_acquisition_callback(adxl362_frame_t *frame, uint16_t frame_len)
+{
+    uint16_t i;
+    uint16_t sets;
+    uint16_t n;
+    uint8_t seen;
+    uint64_t now;
+    int16_t raw[3] = {0, 0, 0};
+    float g[3] = {0.0f, 0.0f, 0.0f};
+
+    /* get the batch time */
+    now = a_monotonic_ns();
+
+    /* count the complete sets to date them */
+    sets = 0;
+    seen = 0;
+    for (i = 0; i < frame_len; i++)
+    {
+        if (frame[i].type == ADXL362_FRAME_TYPE_X)
+        {
+            seen = 1;
+        }
+        else if (frame[i].type == ADXL362_FRAME_TYPE_Y)
+        {
+            seen = (seen == 1) ? 3 : 0;
+        }
+        else if (frame[i].type == ADXL362_FRAME_TYPE_Z)
+        {
+            sets += (seen == 3) ? 1 : 0;
+            seen = 0;
+        }
+        else
+        {
+            seen = 0;
+        }
+    }
+
+    /* publish the samples, a set is complete on the z axis */
+    n = 0;
+    seen = 0;
+    for (i = 0; i < frame_len; i++)
+    {
+        if (frame[i].type == ADXL362_FRAME_TYPE_X)
+        {
+            raw[0] = frame[i].raw;
+            g[0] = frame[i].data;
+            seen = 1;
+        }
+        else if (frame[i].type == ADXL362_FRAME_TYPE_Y)
+        {
+            raw[1] = frame[i].raw;
+            g[1] = frame[i].data;
+            seen = (seen == 1) ? 3 : 0;
+        }
+        else if (frame[i].type == ADXL362_FRAME_TYPE_Z)
+        {
+            if (seen == 3)
+            {
+                raw[2] = frame[i].raw;
+                g[2] = frame[i].data;
+                shm_ring_publish(&gs_ring, raw, g, ADXL362_ACQUISITION_DEFAULT_RANGE,
+                                 now - (uint64_t)(sets - 1 - n) * gs_period_ns);
+                n++;
+            }
+            seen = 0;
+        }
+        else
+        {
+            seen = 0;
+        }
+    }
+}
+
+/**
+ * @brief     run as the ring reader
+ * @param[in] *name pointer to a shm name buffer
+ * @param[in] times read times
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+static uint8_t a_reader(const char *name, uint32_t times)
+{
+    uint8_t res;
+    uint64_t index;
+    uint64_t head;
+    shm_ring_t ring;
+    shm_ring_slot_t slot;
+    uint32_t idle;
+
+    /* open the ring */
+    res = shm_ring_open(&ring, name);
+    if (res != 0)
+    {
+        return 1;
+    }
+    idle = 0;
+
+    /* start from the newest sample */
+    index = shm_ring_head(&ring);
+
+    /* loop */
+    while ((times != 0) && (gs_running != 0))
+    {
+        /* read the sample */
+        res = shm_ring_read(&ring, index, &slot);
+        if (res == 1)
+        {
+            /* wait 1ms */
+            usleep(1000);
+
+            /* check once a second if the writer restarted with a new ring */
+            idle++;
+            if (idle >= 1000)
+            {
+                idle = 0;
+                if (shm_ring_replaced(&ring) != 0)
+                {
+                    (void)shm_ring_close(&ring);
+                    res = shm_ring_open(&ring, name);
+                    if (res != 0)
+                    {
+                        return 1;
+                    }
+                    adxl362_interface_debug_print("adxl362d: ring is replaced, reopen.\n");
+                    index = shm_ring_head(&ring);
+                }
+            }
+
+            continue;
+        }
+        else if (res == 2)
+        {
+            /* resync to the newest sample */
+            idle = 0;
+            head = shm_ring_head(&ring);
+            adxl362_interface_debug_print("adxl362d: lost %llu samples.\n", (unsigned long long)(head - index));
+            index = head;
+
+            continue;
+        }
+        else
+        {
+            /* output */
+            adxl362_interface_debug_print("adxl362d: %llu %llu.%09llu x %0.3fg y %0.3fg z %0.3fg.\n",
+                                          (unsigned long long)slot.index,
+                                          (unsigned long long)(slot.timestamp_ns / 1000000000ULL),
+                                          (unsigned long long)(slot.timestamp_ns % 1000000000ULL),
+                                          slot.g[0], slot.g[1], slot.g[2]);
+            idle = 0;
+            index++;
+            times--;
+        }
+    }
+
+    /* close the ring */
+    (void)shm_ring_close(&ring);
+
+    return 0;
+}
+
+/**
+ * @brief     run as the ring writer
+ * @param[in] *name pointer to a shm name buffer
+ * @param[in] slots slot count
+ * @param[in] id sensor id
+ * @param[in] odr_index index of the odr table
+ * @param[in] latency_ms latency target in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+static uint8_t a_writer(const char *name, uint32_t slots, uint32_t id, uint8_t odr_index, uint32_t latency_ms)
+{
+    uint8_t res;
+    uint32_t overrun;
+    adxl362_acquisition_plan_t plan;
+
+    /* create the ring */
+    res = shm_ring_create(&gs_ring, name, slots, id, gsc_odr[odr_index].mhz);
+    if (res != 0)
+    {
+        return 1;
+    }
+    gs_period_ns = 1000000000000ULL / gsc_odr[odr_index].mhz;
+
+    /* gpio init */
+    res = gpio_interrupt_init();
+    if (res != 0)
+    {
+        (void)shm_ring_close(&gs_ring);
+
+        return 1;
+    }
+
+    /* set the gpio irq */
+    g_gpio_irq = adxl362_acquisition_irq_handler;
+
+    /* measure the irq cost */
+    (void)adxl362_acquisition_set_clock(a_clock_us);
+
+    /* acquisition init */
+    res = adxl362_acquisition_init(gsc_odr[odr_index].odr, latency_ms, ADXL362_BOOL_TRUE, a_acquisition_callback);
+    if (res != 0)
+    {
+        (void)gpio_interrupt_deinit();
+        g_gpio_irq = NULL;
+        (void)shm_ring_close(&gs_ring);
+
+        return 1;
+    }
+
+    /* output */
+    adxl362_interface_debug_print("adxl362d: publish to %s with %d slots.\n", name, slots);
+
+    /* loop */
+    while (gs_running != 0)
+    {
+        /* get the plan */
+        (void)adxl362_acquisition_get_plan(&plan, &overrun);
+
+        /* drive the polling mode */
+        if (plan.mode == ADXL362_ACQUISITION_MODE_POLLING)
+        {
+            (void)adxl362_acquisition_poll();
+            adxl362_interface_delay_ms(plan.poll_period_ms);
+        }
+        else
+        {
+            adxl362_interface_delay_ms(100);
+        }
+    }
+
+    /* output */
+    (void)adxl362_acquisition_get_plan(&plan, &overrun);
+    adxl362_interface_debug_print("adxl362d: %llu samples published, %d fifo overruns, irq cost %dus.\n",
+                                  (unsigned long long)shm_ring_head(&gs_ring), overrun, plan.irq_cost_us);
+
+    /* gpio deinit */
+    (void)gpio_interrupt_deinit();
+    g_gpio_irq = NULL;
+
+    /* acquisition deinit */
+    (void)adxl362_acquisition_deinit();
+
+    /* close the ring */
+    (void)shm_ring_close(&gs_ring);
+
+    return 0;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note      none
+ */
+int main(int argc, char **argv)
+{
+    int c;
+    int longindex = 0;
+    const char short_options[] = "hr";
+    const struct option long_options[] =
+    {
+        {"help", no_argument, NULL, 'h'},
+        {"read", no_argument, NULL, 'r'},
+        {"name", required_argument, NULL, 1},
+        {"slots", required_argument, NULL, 2},
+        {"id", required_argument, NULL, 3},
+        {"odr", required_argument, NULL, 4},
+        {"latency", required_argument, NULL, 5},
+        {"times", required_argument, NULL, 6},
+        {NULL, 0, NULL, 0},
+    };
+    char name[64] = SHM_RING_DEFAULT_NAME;
+    uint8_t reader = 0;
+    uint8_t odr_index = 5;
+    uint8_t i;
+    uint32_t slots = 4096;
+    uint32_t id = 0;
+    uint32_t latency_ms = 100;
+    uint32_t times = 3;
+    uint8_t res;
+
+    /* parse */
+    do
+    {
+        /* parse the args */
+        c = getopt_long(argc, argv, short_options, long_options, &longindex);
+
+        /* judge the result */
+        switch (c)
+        {
+            /* help */
+            case 'h' :
+            {
+                adxl362_interface_debug_print("Usage:\n");
+                adxl362_interface_debug_print("  adxl362d [--name=<shm>] [--slots=<num>] [--id=<num>] [--odr=<12.5 | 25 | 50 | 100 | 200 | 400>] [--latency=<ms>]\n");
+                adxl362_interface_debug_print("  adxl362d (-r | --read) [--name=<shm>] [--times=<num>]\n");
+                adxl362_interface_debug_print("  adxl362d (-h | --help)\n");
+                adxl362_interface_debug_print("\n");
+                adxl362_interface_debug_print("Options:\n");
+                adxl362_interface_debug_print("  -h, --help           Show the help.\n");
+                adxl362_interface_debug_print("      --id=<num>       Set the sensor id stored in the ring.([default: 0])\n");
+                adxl362_interface_debug_print("      --latency=<ms>   Set the latency target.([default: 100])\n");
+                adxl362_interface_debug_print("      --name=<shm>     Set the shared memory name.([default: /adxl362])\n");
+                adxl362_interface_debug_print("      --odr=<hz>       Set the output data rate.([default: 400])\n");
+                adxl362_interface_debug_print("  -r, --read           Attach to the ring as a reader and print the samples.\n");
+                adxl362_interface_debug_print("      --slots=<num>    Set the ring slot count, a power of 2.([default: 4096])\n");
+                adxl362_interface_debug_print("      --times=<num>    Set the reader sample count.([default: 3])\n");
+
+                return 0;
+            }
+
+            /* reader */
+            case 'r' :
+            {
+                reader = 1;
+
+                break;
+            }
+
+            /* name */
+            case 1 :
+            {
+                memset(name, 0, sizeof(char) * 64);
+                snprintf(name, 63, "%s", optarg);
+
+                break;
+            }
+
+            /* slots */
+            case 2 :
+            {
+                slots = atol(optarg);
+
+                break;
+            }
+
+            /* id */
+            case 3 :
+            {
+                id = atol(optarg);
+
+                break;
+            }
+
+            /* odr */
+            case 4 :
+            {
+                for (i = 0; i < 6; i++)
+                {
+                    if (strcmp(gsc_odr[i].name, optarg) == 0)
+                    {
+                        break;
+                    }
+                }
+                if (i == 6)
+                {
+                    adxl362_interface_debug_print("adxl362d: param is invalid.\n");
+
+                    return 1;
+                }
+                odr_index = i;
+
+                break;
+            }
+
+            /* latency */
+            case 5 :
+            {
+                latency_ms = atol(optarg);
+
+                break;
+            }
+
+            /* times */
+            case 6 :
+            {
+                times = atol(optarg);
+
+                break;
+            }
+
+            /* the end */
+            case -1 :
+            {
+                break;
+            }
+
+            /* others */
+            default :
+            {
+                adxl362_interface_debug_print("adxl362d: param is invalid.\n");
+
+                return 1;
+            }
+        }
+    } while (c != -1);
+
+    /* stop on the signals */
+    (void)signal(SIGINT, a_signal_handler);
+    (void)signal(SIGTERM, a_signal_handler);
+
+    /* run */
+    if (reader != 0)
+    {
+        res = a_reader(name, times);
+    }
+    else
+    {
+        res = a_writer(name, slots, id, odr_index, latency_ms);
+    }
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362d: run failed.\n");
+
+        return 1;
+    }
+
+    return 0;
+}
@@ -37,16 +37,81 @@
 #include "driver_adxl362_basic.h"
 #include "driver_adxl362_motion.h"
 #include "driver_adxl362_fifo.h"
+#include "driver_adxl362_acquisition.h"
 #include "driver_adxl362_register_test.h"
 #include "driver_adxl362_read_test.h"
 #include "driver_adxl362_motion_test.h"
 #include "driver_adxl362_fifo_test.h"
+#include "driver_adxl362_fft_test.h"
+#include "driver_adxl362_tilt_test.h"
+#include "driver_adxl362_trend_test.h"
+#include "driver_adxl362_calibration_test.h"
+#include "driver_adxl362_codec_test.h"
+#include "driver_adxl362_histogram_test.h"
+#include "driver_adxl362_threshold_test.h"
+#include "driver_adxl362_step_test.h"
+#include "driver_adxl362_impact_test.h"
+#include "driver_adxl362_recorder_test.h"
+#include "driver_adxl362_gesture_test.h"
 #include "gpio.h"
+#include "timer.h"
+#include "sink.h"
+#include "output.h"
 #include <getopt.h>
 #include <stdlib.h>
+#include <stdio.h>
 
 volatile uint8_t g_flag;                   /**< interrupt flag */
 uint8_t (*g_gpio_irq)(void) = NULL;        /**< gpio irq function address */
+static sink_t gs_sink;                     /**< stream sink */
+static int16_t gs_xyz[SINK_MAX_SAMPLES * 3];        /**< packed triplets */
+static output_t gs_output;                 /**< stream output */
+
+/**
+ * @brief  take the stdout for a data stream
+ * @return data fd, -1 on error
+ * @note   the stdout stream is pointed to the stderr, so the driver messages never mix with the data
+ */
+static int a_stdout_claim(void)
+{
+    int fd;
+
+    /* flush the pending text */
+    (void)fflush(stdout);
+
+    /* keep the data pipe and send the text to the stderr */
+    fd = dup(STDOUT_FILENO);
+    if (fd < 0)
+    {
+        perror("adxl362: dup failed.\n");
+
+        return -1;
+    }
+    if (dup2(STDERR_FILENO, STDOUT_FILENO) < 0)
+    {
+        perror("adxl362: dup2 failed.\n");
+        (void)close(fd);
+
+        return -1;
+    }
+
+    return fd;
+}
+
+/**
+ * @brief     give the stdout back
+ * @param[in] fd data fd from a_stdout_claim
+ * @note      none
+ */
+static void a_stdout_release(int fd)
+{
+    /* flush the text sent to the stderr */
+    (void)fflush(stdout);
+
+    /* restore the stdout */
+    (void)dup2(fd, STDOUT_FILENO);
+    (void)close(fd);
+}
 
 /**
  * @brief     interface fifo callback
@@ -86,6 +151,105 @@ static void a_fifo_callback(adxl362_frame_t *frame, uint16_t frame_len)
     }
 }
 
+/**
+ * @brief      pack the complete frames into triplets
+ * @param[in]  *frame pointer to a frame buffer
+ * @param[in]  frame_len length of frame
+ * @param[out] *xyz pointer to a packed x, y, z triplet buffer
+ * @param[in]  max max triplet count
+ * @return     triplet count
+ * @note       none
+ */
+static uint32_t a_pack_triplets(adxl362_frame_t *frame, uint16_t frame_len, int16_t *xyz, uint32_t max)
+{
+    uint16_t i;
+    uint32_t count;
+    int16_t t[3] = {0, 0, 0};
+
+    /* a triplet is complete on the z axis */
+    count = 0;
+    for (i = 0; i < frame_len; i++)
+    {
+        if (frame[i].type == ADXL362_FRAME_TYPE_X)
+        {
+            t[0] = frame[i].raw;
+        }
+        else if (frame[i].type == ADXL362_FRAME_TYPE_Y)
+        {
+            t[1] = frame[i].raw;
+        }
+        else if (frame[i].type == ADXL362_FRAME_TYPE_Z)
+        {
+            t[2] = frame[i].raw;
+            if (count < max)
+            {
+                xyz[count * 3 + 0] = t[0];
+                xyz[count * 3 + 1] = t[1];
+                xyz[count * 3 + 2] = t[2];
+                count++;
+            }
+        }
+    }
+
+    return count;
+}
+
+/**
+ * @brief     interface sink callback
+ * @param[in] *frame pointer to a frame buffer
+ * @param[in] frame_len length of frame
+ * @note      none
+ */
+static void a_sink_callback(adxl362_frame_t *frame, uint16_t frame_len)
+{
+    uint32_t count;
+
+    /* pack the complete triplets */
+    count = a_pack_triplets(frame, frame_len, gs_xyz, SINK_MAX_SAMPLES);
+
+    /* publish the block, the header carries the range in g */
+    (void)sink_publish(&gs_sink, timer_monotonic_ns(), (uint16_t)(2U << ADXL362_FIFO_DEFAULT_RANGE), gs_xyz, count);
+
+    /* flag happened */
+    g_flag = 1;
+}
+
+/**
+ * @brief  get the microsecond clock
+ * @return time in us
+ * @note   it wraps, only differences are used
+ */
+static uint32_t a_clock_us(void)
+{
+    return (uint32_t)(timer_monotonic_ns() / 1000U);
+}
+
+/**
+ * @brief     interface stream callback
+ * @param[in] *frame pointer to a frame buffer
+ * @param[in] frame_len length of frame
+ * @note      none
+ */
+static void a_stream_callback(adxl362_frame_t *frame, uint16_t frame_len)
+{
+    uint32_t count;
+
+    /* pack the complete triplets */
+    count = a_pack_triplets(frame, frame_len, gs_xyz, SINK_MAX_SAMPLES);
+
+    /* one write per fifo block */
+    if (output_triplets(&gs_output, gs_xyz, count, (uint8_t)ADXL362_ACQUISITION_DEFAULT_RANGE) != 0)
+    {
+        g_flag = 2;
+
+        return;
+    }
+    if (output_flush(&gs_output) != 0)
+    {
+        g_flag = 2;
+    }
+}
+
 /**
  * @brief     interface motion callback
  * @param[in] type irq type
@@ -173,10 +337,18 @@ uint8_t adxl362(uint8_t argc, char **argv)
         {"example", required_argument, NULL, 'e'},
         {"test", required_argument, NULL, 't'},
         {"times", required_argument, NULL, 1},
+        {"interval", required_argument, NULL, 2},
+        {"path", required_argument, NULL, 3},
+        {"format", required_argument, NULL, 4},
+        {"capture", required_argument, NULL, 5},
         {NULL, 0, NULL, 0},
     };
     char type[33] = "unknown";
     uint32_t times = 3;
+    uint32_t interval = 80;
+    char path[108] = SINK_DEFAULT_PATH;
+    output_format_t format = OUTPUT_FORMAT_CSV;
+    char capture[256] = {0};
 
     /* if no params */
     if (argc == 1)
@@ -256,6 +428,55 @@ uint8_t adxl362(uint8_t argc, char **argv)
                 break;
             }
 
+            /* polling interval */
+            case 2 :
+            {
+                /* set the interval */
+                interval = atol(optarg);
+
+                break;
+            }
+
+            /* sink path */
+            case 3 :
+            {
+                /* set the path */
+                memset(path, 0, sizeof(char) * 108);
+                strncpy(path, optarg, 107);
+
+                break;
+            }
+
+            /* stream format */
+            case 4 :
+            {
+                /* set the format */
+                if (strcmp("csv", optarg) == 0)
+                {
+                    format = OUTPUT_FORMAT_CSV;
+                }
+                else if (strcmp("bin", optarg) == 0)
+                {
+                    format = OUTPUT_FORMAT_BIN;
+                }
+                else
+                {
+                    return 5;
+                }
+
+                break;
+            }
+
+            /* capture file */
+            case 5 :
+            {
+                /* set the capture */
+                memset(capture, 0, sizeof(char) * 256);
+                strncpy(capture, optarg, 255);
+
+                break;
+            }
+
             /* the end */
             case -1 :
             {
@@ -361,6 +582,186 @@ uint8_t adxl362(uint8_t argc, char **argv)
 
         return 0;
     }
+    else if (strcmp("t_fft", type) == 0)
+    {
+        uint8_t res;
+
+        /* run fft test */
+        res = adxl362_fft_test(times);
+        if (res != 0)
+        {
+            return 1;
+        }
+
+        return 0;
+    }
+    else if (strcmp("t_tilt", type) == 0)
+    {
+        uint8_t res;
+
+        /* run tilt test */
+        res = adxl362_tilt_test(times);
+        if (res != 0)
+        {
+            return 1;
+        }
+
+        return 0;
+    }
+    else if (strcmp("t_trend", type) == 0)
+    {
+        uint8_t res;
+        FILE *fp;
+        long size;
+        int16_t *buf = NULL;
+        uint32_t len = 0;
+
+        /* load the packed int16 triplets written by --format=bin */
+        if (capture[0] != 0)
+        {
+            fp = fopen(capture, "rb");
+            if (fp == NULL)
+            {
+                adxl362_interface_debug_print("adxl362: open %s failed.\n", capture);
+
+                return 1;
+            }
+            (void)fseek(fp, 0, SEEK_END);
+            size = ftell(fp);
+            (void)fseek(fp, 0, SEEK_SET);
+            len = (size > 0) ? (uint32_t)(size / (long)(sizeof(int16_t) * 3)) : 0;
+            if (len == 0)
+            {
+                adxl362_interface_debug_print("adxl362: %s is empty.\n", capture);
+                (void)fclose(fp);
+
+                return 1;
+            }
+            buf = (int16_t *)malloc(sizeof(int16_t) * 3 * len);
+            if (buf == NULL)
+            {
+                (void)fclose(fp);
+
+                return 1;
+            }
+            len = (uint32_t)(fread(buf, sizeof(int16_t) * 3, len, fp));
+            (void)fclose(fp);
+        }
+
+        /* run trend test */
+        res = adxl362_trend_test(buf, len, times);
+        free(buf);
+        if (res != 0)
+        {
+            return 1;
+        }
+
+        return 0;
+    }
+    else if (strcmp("t_calibration", type) == 0)
+    {
+        uint8_t res;
+
+        /* run calibration test */
+        res = adxl362_calibration_test(times);
+        if (res != 0)
+        {
+            return 1;
+        }
+
+        return 0;
+    }
+    else if (strcmp("t_codec", type) == 0)
+    {
+        uint8_t res;
+
+        /* run codec test */
+        res = adxl362_codec_test(times);
+        if (res != 0)
+        {
+            return 1;
+        }
+
+        return 0;
+    }
+    else if (strcmp("t_histogram", type) == 0)
+    {
+        uint8_t res;
+
+        /* run histogram test */
+        res = adxl362_histogram_test(times);
+        if (res != 0)
+        {
+            return 1;
+        }
+
+        return 0;
+    }
+    else if (strcmp("t_threshold", type) == 0)
+    {
+        uint8_t res;
+
+        /* run threshold test */
+        res = adxl362_threshold_test(times);
+        if (res != 0)
+        {
+            return 1;
+        }
+
+        return 0;
+    }
+    else if (strcmp("t_step", type) == 0)
+    {
+        uint8_t res;
+
+        /* run step test */
+        res = adxl362_step_test(times);
+        if (res != 0)
+        {
+            return 1;
+        }
+
+        return 0;
+    }
+    else if (strcmp("t_impact", type) == 0)
+    {
+        uint8_t res;
+
+        /* run impact test */
+        res = adxl362_impact_test(times);
+        if (res != 0)
+        {
+            return 1;
+        }
+
+        return 0;
+    }
+    else if (strcmp("t_recorder", type) == 0)
+    {
+        uint8_t res;
+
+        /* run recorder test */
+        res = adxl362_recorder_test(times);
+        if (res != 0)
+        {
+            return 1;
+        }
+
+        return 0;
+    }
+    else if (strcmp("t_gesture", type) == 0)
+    {
+        uint8_t res;
+
+        /* run gesture test */
+        res = adxl362_gesture_test(times);
+        if (res != 0)
+        {
+            return 1;
+        }
+
+        return 0;
+    }
     else if (strcmp("e_basic", type) == 0)
     {
         uint8_t res;
@@ -404,6 +805,97 @@ uint8_t adxl362(uint8_t argc, char **argv)
 
         return 0;
     }
+    else if (strcmp("e_poll", type) == 0)
+    {
+        uint8_t res;
+        uint32_t i;
+        uint64_t t0;
+        uint64_t deadline;
+        uint64_t missed;
+        float g[3];
+        timer_handle_t timer;
+
+        /* check the interval */
+        if (interval == 0)
+        {
+            return 5;
+        }
+
+        /* basic init */
+        res = adxl362_basic_init();
+        if (res != 0)
+        {
+            return 1;
+        }
+
+        /* absolute periodic timer init */
+        res = timer_periodic_init(&timer, interval * 1000);
+        if (res != 0)
+        {
+            (void)adxl362_basic_deinit();
+
+            return 1;
+        }
+        t0 = timer.start_ns;
+
+        /* loop */
+        for (i = 0; i < times; i++)
+        {
+            /* wait for the next deadline */
+            res = timer_periodic_wait(&timer, &deadline, &missed);
+            if (res != 0)
+            {
+                (void)timer_periodic_deinit(&timer);
+                (void)adxl362_basic_deinit();
+
+                return 1;
+            }
+
+            /* read data */
+            res = adxl362_basic_read((float *)g);
+            if (res != 0)
+            {
+                (void)timer_periodic_deinit(&timer);
+                (void)adxl362_basic_deinit();
+
+                return 1;
+            }
+            timer_periodic_mark(&timer);
+
+            /* output */
+            if (missed != 0)
+            {
+                adxl362_interface_debug_print("adxl362: overrun, missed %d ticks.\n", (uint32_t)missed);
+            }
+            adxl362_interface_debug_print("%d/%d t=%0.3fms\n", i + 1, times, (double)(deadline - t0) / 1000000.0);
+            adxl362_interface_debug_print("adxl362: x is %0.3fg.\n", g[0]);
+            adxl362_interface_debug_print("adxl362: y is %0.3fg.\n", g[1]);
+            adxl362_interface_debug_print("adxl362: z is %0.3fg.\n", g[2]);
+        }
+
+        /* output the timing summary */
+        if (timer.stat.ticks != 0)
+        {
+            adxl362_interface_debug_print("adxl362: ticks %d, missed %d.\n",
+                                          (uint32_t)timer.stat.ticks, (uint32_t)timer.stat.missed);
+            adxl362_interface_debug_print("adxl362: jitter min %0.1fus, mean %0.1fus, max %0.1fus.\n",
+                                          (double)timer.stat.jitter_min_ns / 1000.0,
+                                          (double)timer.stat.jitter_sum_ns / 1000.0 / (double)timer.stat.ticks,
+                                          (double)timer.stat.jitter_max_ns / 1000.0);
+            adxl362_interface_debug_print("adxl362: read latency min %0.1fus, mean %0.1fus, max %0.1fus.\n",
+                                          (double)timer.stat.latency_min_ns / 1000.0,
+                                          (double)timer.stat.latency_sum_ns / 1000.0 / (double)timer.stat.ticks,
+                                          (double)timer.stat.latency_max_ns / 1000.0);
+        }
+
+        /* timer deinit */
+        (void)timer_periodic_deinit(&timer);
+
+        /* basic deinit */
+        (void)adxl362_basic_deinit();
+
+        return 0;
+    }
     else if (strcmp("e_fifo", type) == 0)
     {
         uint8_t res;
@@ -470,6 +962,207 @@ uint8_t adxl362(uint8_t argc, char **argv)
 
         return 0;
     }
+    else if (strcmp("e_sink", type) == 0)
+    {
+        uint8_t res;
+        uint32_t timeout;
+        int fd;
+
+        /* open the sink, "-" streams to the stdout pipe and the messages go to the stderr */
+        fd = -1;
+        if (strcmp(path, "-") == 0)
+        {
+            fd = a_stdout_claim();
+            if (fd < 0)
+            {
+                return 1;
+            }
+            res = sink_open_fd(&gs_sink, fd, 0);
+        }
+        else
+        {
+            res = sink_open_socket(&gs_sink, path, 0);
+        }
+        if (res != 0)
+        {
+            if (fd >= 0)
+            {
+                a_stdout_release(fd);
+            }
+
+            return 1;
+        }
+
+        /* gpio init */
+        res = gpio_interrupt_init();
+        if (res != 0)
+        {
+            sink_close(&gs_sink);
+            if (fd >= 0)
+            {
+                a_stdout_release(fd);
+            }
+
+            return 1;
+        }
+
+        /* set the gpio irq */
+        g_gpio_irq = adxl362_fifo_irq_handler;
+
+        /* set 0 */
+        g_flag = 0;
+
+        /* fifo init */
+        res = adxl362_fifo_init(a_sink_callback);
+        if (res != 0)
+        {
+            (void)gpio_interrupt_deinit();
+            g_gpio_irq = NULL;
+            sink_close(&gs_sink);
+            if (fd >= 0)
+            {
+                a_stdout_release(fd);
+            }
+
+            return 1;
+        }
+
+        /* set timeout */
+        timeout = 500;
+
+        /* loop */
+        while (times != 0)
+        {
+            /* check the flag */
+            if (g_flag != 0)
+            {
+                g_flag = 0;
+                timeout = 500;
+                times--;
+            }
+            timeout--;
+            /* check the timeout */
+            if (timeout == 0)
+            {
+                (void)gpio_interrupt_deinit();
+                (void)adxl362_fifo_deinit();
+                g_gpio_irq = NULL;
+                sink_close(&gs_sink);
+                adxl362_interface_debug_print("adxl362: fifo read timeout.\n");
+                if (fd >= 0)
+                {
+                    a_stdout_release(fd);
+                }
+
+                return 1;
+            }
+
+            /* delay 10ms */
+            adxl362_interface_delay_ms(10);
+        }
+
+        /* gpio deinit */
+        (void)gpio_interrupt_deinit();
+
+        /* fifo deinit */
+        (void)adxl362_fifo_deinit();
+        g_gpio_irq = NULL;
+
+        /* close the sink */
+        sink_close(&gs_sink);
+        if (fd >= 0)
+        {
+            a_stdout_release(fd);
+        }
+
+        return 0;
+    }
+    else if (strcmp("e_stream", type) == 0)
+    {
+        uint8_t res;
+        uint32_t i;
+        uint32_t overrun;
+        adxl362_acquisition_plan_t plan;
+        int fd;
+
+        /* the samples own the stdout pipe, the messages go to the stderr */
+        fd = a_stdout_claim();
+        if (fd < 0)
+        {
+            return 1;
+        }
+
+        /* init the output */
+        output_init(&gs_output, fd, format);
+
+        /* gpio init */
+        res = gpio_interrupt_init();
+        if (res != 0)
+        {
+            a_stdout_release(fd);
+
+            return 1;
+        }
+
+        /* set the gpio irq */
+        g_gpio_irq = adxl362_acquisition_irq_handler;
+
+        /* set 0 */
+        g_flag = 0;
+
+        /* measure the irq cost */
+        (void)adxl362_acquisition_set_clock(a_clock_us);
+
+        /* acquisition init at the full odr */
+        res = adxl362_acquisition_init(ADXL362_ODR_400HZ, 100, ADXL362_BOOL_TRUE, a_stream_callback);
+        if (res != 0)
+        {
+            (void)gpio_interrupt_deinit();
+            g_gpio_irq = NULL;
+            a_stdout_release(fd);
+
+            return 1;
+        }
+
+        /* loop, times is the stream seconds */
+        for (i = 0; i < times * 10; i++)
+        {
+            /* check the output */
+            if (g_flag == 2)
+            {
+                break;
+            }
+
+            /* get the plan */
+            (void)adxl362_acquisition_get_plan(&plan, &overrun);
+
+            /* drive the polling mode */
+            if (plan.mode == ADXL362_ACQUISITION_MODE_POLLING)
+            {
+                (void)adxl362_acquisition_poll();
+            }
+
+            /* delay 100ms */
+            adxl362_interface_delay_ms(100);
+        }
+
+        /* gpio deinit */
+        (void)gpio_interrupt_deinit();
+        g_gpio_irq = NULL;
+
+        /* acquisition deinit */
+        (void)adxl362_acquisition_deinit();
+
+        /* flush the rest */
+        res = output_flush(&gs_output);
+        a_stdout_release(fd);
+        if ((res != 0) || (g_flag == 2))
+        {
+            return 1;
+        }
+
+        return 0;
+    }
     else if (strcmp("e_motion", type) == 0)
     {
         uint8_t res;
@@ -545,17 +1238,36 @@ uint8_t adxl362(uint8_t argc, char **argv)
         adxl362_interface_debug_print("  adxl362 (-t read | --test=read) [--times=<num>]\n");
         adxl362_interface_debug_print("  adxl362 (-t fifo | --test=fifo) [--times=<num>]\n");
         adxl362_interface_debug_print("  adxl362 (-t motion | --test=motion) [--times=<num>]\n");
+        adxl362_interface_debug_print("  adxl362 (-t fft | --test=fft) [--times=<num>]\n");
+        adxl362_interface_debug_print("  adxl362 (-t tilt | --test=tilt) [--times=<num>]\n");
+        adxl362_interface_debug_print("  adxl362 (-t trend | --test=trend) [--times=<num>] [--capture=<path>]\n");
+        adxl362_interface_debug_print("  adxl362 (-t calibration | --test=calibration) [--times=<num>]\n");
+        adxl362_interface_debug_print("  adxl362 (-t codec | --test=codec) [--times=<num>]\n");
+        adxl362_interface_debug_print("  adxl362 (-t histogram | --test=histogram) [--times=<num>]\n");
+        adxl362_interface_debug_print("  adxl362 (-t threshold | --test=threshold) [--times=<num>]\n");
+        adxl362_interface_debug_print("  adxl362 (-t step | --test=step) [--times=<num>]\n");
+        adxl362_interface_debug_print("  adxl362 (-t impact | --test=impact) [--times=<num>]\n");
+        adxl362_interface_debug_print("  adxl362 (-t recorder | --test=recorder) [--times=<num>]\n");
+        adxl362_interface_debug_print("  adxl362 (-t gesture | --test=gesture) [--times=<num>]\n");
         adxl362_interface_debug_print("  adxl362 (-e basic | --example=basic) [--times=<num>]\n");
+        adxl362_interface_debug_print("  adxl362 (-e poll | --example=poll) [--times=<num>] [--interval=<ms>]\n");
         adxl362_interface_debug_print("  adxl362 (-e fifo | --example=fifo) [--times=<num>]\n");
+        adxl362_interface_debug_print("  adxl362 (-e sink | --example=sink) [--times=<num>] [--path=<path>]\n");
+        adxl362_interface_debug_print("  adxl362 (-e stream | --example=stream) [--times=<num>] [--format=<bin | csv>]\n");
         adxl362_interface_debug_print("  adxl362 (-e motion | --example=motion) [--times=<num>]\n");
         adxl362_interface_debug_print("\n");
         adxl362_interface_debug_print("Options:\n");
-        adxl362_interface_debug_print("  -e <basic | fifo | motion>, --example=<basic | fifo | motion>\n");
+        adxl362_interface_debug_print("      --capture=<path> Set the recorded capture of packed int16 triplets in mg.([default: synthetic])\n");
+        adxl362_interface_debug_print("  -e <basic | poll | fifo | sink | stream | motion>, --example=<basic | poll | fifo | sink | stream | motion>\n");
         adxl362_interface_debug_print("                       Run the driver example.\n");
+        adxl362_interface_debug_print("      --format=<bin | csv>\n");
+        adxl362_interface_debug_print("                       Set the stream format, csv lines of index,x,y,z in mg or packed int16 triplets in mg.([default: csv])\n");
         adxl362_interface_debug_print("  -h, --help           Show the help.\n");
         adxl362_interface_debug_print("  -i, --information    Show the chip information.\n");
+        adxl362_interface_debug_print("      --interval=<ms>  Set the polling interval.([default: 80])\n");
+        adxl362_interface_debug_print("      --path=<path>    Set the sink unix socket path, - streams to stdout.([default: /tmp/adxl362.sock])\n");
         adxl362_interface_debug_print("  -p, --port           Display the pin connections of the current board.\n");
-        adxl362_interface_debug_print("  -t <reg | read | fifo | motion>, --test=<reg | read | fifo | motion>\n");
+        adxl362_interface_debug_print("  -t <reg | read | fifo | motion | fft | tilt | trend | calibration | codec | histogram | threshold | step | impact | recorder | gesture>, --test=<reg | read | fifo | motion | fft | tilt | trend | calibration | codec | histogram | threshold | step | impact | recorder | gesture>\n");
         adxl362_interface_debug_print("                       Run the driver test.\n");
         adxl362_interface_debug_print("      --times=<num>    Set the running times.([default: 3])\n");
 
@@ -86,6 +86,31 @@
 #define ADXL362_REG_POWER_CTL             0x2D        /**< power register */
 #define ADXL362_REG_SELF_TEST             0x2E        /**< self register */
 
+/**
+ * @brief self test definition
+ */
+#define ADXL362_SELF_TEST_SETTLE          4           /**< odr periods to settle after a change */
+
+/**
+ * @brief self test limit definition
+ * @note  datasheet self test output change at 2.0V in mg, x and z move up and y moves down
+ */
+static const float gsc_adxl362_self_test_min_mg[3] = {450.0f, -710.0f, 350.0f};        /**< low limits */
+static const float gsc_adxl362_self_test_max_mg[3] = {710.0f, -450.0f, 650.0f};        /**< high limits */
+
+/**
+ * @brief self test supply definition
+ * @note  the self test force grows with the supply, typical response normalized to 2.0V
+ */
+static const float gsc_adxl362_self_test_supply_v[5] = {1.6f, 2.0f, 2.5f, 3.0f, 3.5f};         /**< supply points */
+static const float gsc_adxl362_self_test_factor[5] = {0.86f, 1.00f, 1.17f, 1.33f, 1.49f};      /**< response factors */
+
+/**
+ * @brief odr period definition
+ * @note  rounded up to whole ms
+ */
+static const uint8_t gsc_adxl362_odr_period_ms[6] = {80, 40, 20, 10, 5, 3};        /**< period of each odr */
+
 /**
  * @brief      read bytes
  * @param[in]  *handle pointer to an adxl362 handle structure
@@ -154,6 +179,121 @@ static uint8_t a_adxl362_read_fifo(adxl362_handle_t *handle, uint8_t *buf, uint1
     }
 }
 
+/**
+ * @brief      average one self test phase from the fifo
+ * @param[in]  *handle pointer to an adxl362 handle structure
+ * @param[in]  st self test register value of the phase
+ * @param[in]  fifo fifo control register value without the mode
+ * @param[in]  samples averaged xyz sets
+ * @param[in]  period_ms odr period in ms
+ * @param[out] *periods pointer to an odr periods counter
+ * @param[out] *mean pointer to a raw mean buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 6 fifo timeout
+ * @note       the phase takes at most samples + 2 * ADXL362_SELF_TEST_SETTLE odr periods
+ */
+static uint8_t a_adxl362_self_test_average(adxl362_handle_t *handle, uint8_t st, uint8_t fifo, uint8_t samples,
+                                           uint8_t period_ms, uint16_t *periods, float mean[3])
+{
+    uint8_t res;
+    uint8_t buf[2];
+    uint8_t type;
+    uint16_t i;
+    uint16_t len;
+    uint16_t word;
+    uint16_t count[3];
+    int32_t sum[3];
+    
+    res = a_adxl362_write(handle, ADXL362_REG_SELF_TEST, &st, 1);                      /* set the self test */
+    if (res != 0)                                                                      /* check the result */
+    {
+        handle->debug_print("adxl362: write self test failed.\n");                     /* write self test failed */
+       
+        return 1;                                                                      /* return error */
+    }
+    handle->delay_ms(period_ms * ADXL362_SELF_TEST_SETTLE);                            /* wait for the output to settle */
+    *periods += ADXL362_SELF_TEST_SETTLE;                                              /* add the periods */
+    buf[0] = fifo | ADXL362_FIFO_MODE_DISABLE;                                         /* disable clears the fifo */
+    buf[1] = fifo | ADXL362_FIFO_MODE_STREAM;                                          /* stream mode */
+    res = a_adxl362_write(handle, ADXL362_REG_FIFO_CONTROL, &buf[0], 1);               /* write fifo control */
+    if (res != 0)                                                                      /* check the result */
+    {
+        handle->debug_print("adxl362: write fifo control failed.\n");                  /* write fifo control failed */
+       
+        return 1;                                                                      /* return error */
+    }
+    res = a_adxl362_write(handle, ADXL362_REG_FIFO_CONTROL, &buf[1], 1);               /* write fifo control */
+    if (res != 0)                                                                      /* check the result */
+    {
+        handle->debug_print("adxl362: write fifo control failed.\n");                  /* write fifo control failed */
+       
+        return 1;                                                                      /* return error */
+    }
+    handle->delay_ms((uint32_t)period_ms * samples);                                   /* wait for the samples */
+    *periods += samples;                                                               /* add the periods */
+    for (i = 0; i <= ADXL362_SELF_TEST_SETTLE; i++)                                    /* bounded polling */
+    {
+        res = a_adxl362_read(handle, ADXL362_REG_FIFO_ENTRIES_L, buf, 2);              /* read fifo entries */
+        if (res != 0)                                                                  /* check the result */
+        {
+            handle->debug_print("adxl362: read fifo entries failed.\n");               /* read fifo entries failed */
+           
+            return 1;                                                                  /* return error */
+        }
+        len = ((uint16_t)((uint16_t)buf[1] << 8) | buf[0]) & 0x3FF;                    /* get the entries */
+        if (len >= (uint16_t)samples * 3)                                              /* check the entries */
+        {
+            break;                                                                     /* enough */
+        }
+        if (i == ADXL362_SELF_TEST_SETTLE)                                             /* check the polling */
+        {
+            handle->debug_print("adxl362: self test fifo timeout.\n");                 /* self test fifo timeout */
+            
+            return 6;                                                                  /* return error */
+        }
+        handle->delay_ms(period_ms);                                                   /* wait one period */
+        (*periods)++;                                                                  /* add one period */
+    }
+    len = (uint16_t)samples * 3;                                                       /* whole sets only */
+    res = a_adxl362_read_fifo(handle, handle->buf, len * 2);                           /* read from fifo */
+    if (res != 0)                                                                      /* check the result */
+    {
+        handle->debug_print("adxl362: read fifo failed.\n");                           /* read fifo failed */
+       
+        return 1;                                                                      /* return error */
+    }
+    sum[0] = 0;                                                                        /* init 0 */
+    sum[1] = 0;                                                                        /* init 0 */
+    sum[2] = 0;                                                                        /* init 0 */
+    count[0] = 0;                                                                      /* init 0 */
+    count[1] = 0;                                                                      /* init 0 */
+    count[2] = 0;                                                                      /* init 0 */
+    for (i = 0; i < len; i++)                                                          /* all entries */
+    {
+        word = (uint16_t)(handle->buf[i * 2 + 1]) << 8 | handle->buf[i * 2];           /* get the raw data */
+        type = (word >> 14) & 0x03;                                                    /* get the type */
+        if (type < 3)                                                                  /* x, y or z */
+        {
+            sum[type] += (int16_t)((uint16_t)(word << 2)) >> 2;                        /* sign extend and add */
+            count[type]++;                                                             /* add one */
+        }
+    }
+    for (i = 0; i < 3; i++)                                                            /* all axes */
+    {
+        if (count[i] == 0)                                                             /* check the count */
+        {
+            handle->debug_print("adxl362: self test fifo timeout.\n");                 /* self test fifo timeout */
+            
+            return 6;                                                                  /* return error */
+        }
+        mean[i] = (float)sum[i] / (float)count[i];                                     /* raw mean */
+    }
+    
+    return 0;                                                                          /* success return 0 */
+}
+
 /**
  * @brief      get the chip revision
  * @param[in]  *handle pointer to an adxl362 handle structure
@@ -2014,6 +2154,179 @@ uint8_t adxl362_get_self_test(adxl362_handle_t *handle, adxl362_bool_t *enable)
     return 0;                                                              /* success return 0 */
 }
 
+/**
+ * @brief      run the statistical self test
+ * @param[in]  *handle pointer to an adxl362 handle structure
+ * @param[in]  supply_v supply voltage in volt
+ * @param[in]  samples averaged xyz sets per phase
+ * @param[out] *report pointer to a self test report buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 run self test failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 supply voltage is invalid
+ *             - 5 samples is invalid
+ *             - 6 fifo timeout
+ *             - 7 report is NULL
+ * @note       1.6V <= supply_v <= 3.5V, 0 < samples <= 170
+ *             the board must be still, the current range and odr are used and the
+ *             power, fifo and self test settings are restored at the end,
+ *             it takes at most 2 * (samples + 2 * ADXL362_SELF_TEST_SETTLE) odr periods
+ */
+uint8_t adxl362_self_test(adxl362_handle_t *handle, float supply_v, uint8_t samples, adxl362_self_test_report_t *report)
+{
+    uint8_t res;
+    uint8_t ret;
+    uint8_t i;
+    uint8_t odr;
+    uint8_t filter;
+    uint8_t power;
+    uint8_t fifo;
+    uint8_t st;
+    uint8_t prev;
+    float lsb;
+    float factor;
+    float off[3];
+    float on[3];
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    if ((supply_v < SUPPLY_VOLTAGE_MIN) || (supply_v > SUPPLY_VOLTAGE_MAX))                /* check the supply */
+    {
+        handle->debug_print("adxl362: supply voltage is invalid.\n");                      /* supply voltage is invalid */
+       
+        return 4;                                                                          /* return error */
+    }
+    if ((samples == 0) || (samples > ADXL362_BLOCK_MAX_LEN))                               /* check the samples */
+    {
+        handle->debug_print("adxl362: samples is invalid.\n");                             /* samples is invalid */
+       
+        return 5;                                                                          /* return error */
+    }
+    if (report == NULL)                                                                    /* check the report */
+    {
+        handle->debug_print("adxl362: report is null.\n");                                 /* report is null */
+       
+        return 7;                                                                          /* return error */
+    }
+    
+    res = a_adxl362_read(handle, ADXL362_REG_FILTER_CTL, &filter, 1);                      /* read filter */
+    if (res != 0)                                                                          /* check the result */
+    {
+        handle->debug_print("adxl362: read filter failed.\n");                             /* read filter failed */
+       
+        return 1;                                                                          /* return error */
+    }
+    res = a_adxl362_read(handle, ADXL362_REG_POWER_CTL, &power, 1);                        /* read power */
+    if (res != 0)                                                                          /* check the result */
+    {
+        handle->debug_print("adxl362: read power failed.\n");                              /* read power failed */
+       
+        return 1;                                                                          /* return error */
+    }
+    res = a_adxl362_read(handle, ADXL362_REG_FIFO_CONTROL, &fifo, 1);                      /* read fifo control */
+    if (res != 0)                                                                          /* check the result */
+    {
+        handle->debug_print("adxl362: read fifo control failed.\n");                       /* read fifo control failed */
+       
+        return 1;                                                                          /* return error */
+    }
+    res = a_adxl362_read(handle, ADXL362_REG_SELF_TEST, &st, 1);                           /* read self test */
+    if (res != 0)                                                                          /* check the result */
+    {
+        handle->debug_print("adxl362: read self test failed.\n");                          /* read self test failed */
+       
+        return 1;                                                                          /* return error */
+    }
+    odr = filter & 0x07;                                                                   /* get the odr */
+    odr = odr < ADXL362_ODR_400HZ ? odr : ADXL362_ODR_400HZ;                               /* 400Hz and above */
+    lsb = ((filter & 0x80) != 0) ? 4.0f : (float)(1 << ((filter >> 6) & 0x01));            /* mg per lsb, 1x is 8g */
+    
+    /* measurement mode without autosleep and wake up, no temperature in the fifo */
+    prev = (power & ~0x0F) | ADXL362_MODE_MEASUREMENT;                                     /* measurement mode */
+    res = a_adxl362_write(handle, ADXL362_REG_POWER_CTL, &prev, 1);                        /* write power */
+    if (res != 0)                                                                          /* check the result */
+    {
+        handle->debug_print("adxl362: write power failed.\n");                             /* write power failed */
+       
+        return 1;                                                                          /* return error */
+    }
+    report->periods = 0;                                                                   /* init 0 */
+    ret = a_adxl362_self_test_average(handle, st & ~0x01, fifo & ~0x07, samples,
+                                      gsc_adxl362_odr_period_ms[odr], &report->periods, off);     /* self test off */
+    if (ret == 0)                                                                          /* check the result */
+    {
+        ret = a_adxl362_self_test_average(handle, st | 0x01, fifo & ~0x07, samples,
+                                          gsc_adxl362_odr_period_ms[odr], &report->periods, on);  /* self test on */
+    }
+    
+    /* restore the settings even if a phase failed */
+    prev = st & ~0x01;                                                                     /* self test off */
+    res = a_adxl362_write(handle, ADXL362_REG_SELF_TEST, &prev, 1);                        /* write self test */
+    if (res != 0)                                                                          /* check the result */
+    {
+        handle->debug_print("adxl362: write self test failed.\n");                         /* write self test failed */
+       
+        return 1;                                                                          /* return error */
+    }
+    res = a_adxl362_write(handle, ADXL362_REG_FIFO_CONTROL, &fifo, 1);                     /* write fifo control */
+    if (res != 0)                                                                          /* check the result */
+    {
+        handle->debug_print("adxl362: write fifo control failed.\n");                      /* write fifo control failed */
+       
+        return 1;                                                                          /* return error */
+    }
+    res = a_adxl362_write(handle, ADXL362_REG_POWER_CTL, &power, 1);                       /* write power */
+    if (res != 0)                                                                          /* check the result */
+    {
+        handle->debug_print("adxl362: write power failed.\n");                             /* write power failed */
+       
+        return 1;                                                                          /* return error */
+    }
+    if (ret != 0)                                                                          /* check the phases */
+    {
+        return ret;                                                                        /* return error */
+    }
+    
+    /* the limits follow the supply and widen by one lsb of the range */
+    for (i = 0; i < 4; i++)                                                                /* find the segment */
+    {
+        if (supply_v <= gsc_adxl362_self_test_supply_v[i + 1])                             /* check the supply */
+        {
+            break;                                                                         /* found */
+        }
+    }
+    i = i < 3 ? i : 3;                                                                     /* last segment */
+    factor = gsc_adxl362_self_test_factor[i] + 
+             (gsc_adxl362_self_test_factor[i + 1] - gsc_adxl362_self_test_factor[i]) * 
+             (supply_v - gsc_adxl362_self_test_supply_v[i]) / 
+             (gsc_adxl362_self_test_supply_v[i + 1] - gsc_adxl362_self_test_supply_v[i]);   /* interpolate */
+    report->pass_mask = 0;                                                                 /* init 0 */
+    for (i = 0; i < 3; i++)                                                                /* all axes */
+    {
+        report->off_mg[i] = off[i] * lsb;                                                  /* convert to mg */
+        report->on_mg[i] = on[i] * lsb;                                                    /* convert to mg */
+        report->delta_mg[i] = report->on_mg[i] - report->off_mg[i];                        /* self test response */
+        report->min_mg[i] = gsc_adxl362_self_test_min_mg[i] * factor - lsb;                /* scaled low limit */
+        report->max_mg[i] = gsc_adxl362_self_test_max_mg[i] * factor + lsb;                /* scaled high limit */
+        if ((report->delta_mg[i] >= report->min_mg[i]) && 
+            (report->delta_mg[i] <= report->max_mg[i]))                                    /* check the limits */
+        {
+            report->pass_mask |= (uint8_t)(1 << i);                                        /* axis passes */
+        }
+    }
+    report->pass = (report->pass_mask == 0x07) ? 1 : 0;                                    /* all axes pass */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
 /**
  * @brief     set the activity threshold
  * @param[in] *handle pointer to an adxl362 handle structure
@@ -3397,6 +3710,171 @@ uint8_t adxl362_read_fifo(adxl362_handle_t *handle, adxl362_frame_t *frame, uint
     return 0;                                                              /* success return 0 */
 }
 
+/**
+ * @brief         decode fifo entries into a block
+ * @param[in,out] *block pointer to a block buffer
+ * @param[in]     *buf pointer to the fifo bytes
+ * @param[in]     len entry count
+ * @param[in,out] *xy pointer to the x and y of the open set
+ * @param[in,out] *seen pointer to the open set flags, bit 0 is x and bit 1 is y
+ * @note          a set is only kept if its x, y and z arrived in order, entries
+ *                without their x are dropped
+ */
+static void a_adxl362_fifo_block_decode(adxl362_block_t *block, const uint8_t *buf, uint16_t len,
+                                        int16_t xy[2], uint8_t *seen)
+{
+    uint16_t i;
+    uint16_t word;
+    uint8_t type;
+    int16_t raw;
+    
+    for (i = 0; i < len; i++)                                              /* copy data */
+    {
+        word = (uint16_t)(buf[i * 2 + 1]) << 8 | buf[i * 2];               /* get the raw data */
+        type = (word >> 14) & 0x03;                                        /* get the type */
+        raw = (int16_t)((uint16_t)(word << 2)) >> 2;                       /* sign extend the valid part */
+        if (type == ADXL362_FRAME_TYPE_X)                                  /* x opens a set */
+        {
+            xy[0] = raw;                                                   /* save x */
+            *seen = 0x01;                                                  /* x seen */
+        }
+        else if (type == ADXL362_FRAME_TYPE_Y)                             /* y */
+        {
+            if (*seen == 0x01)                                             /* check x */
+            {
+                xy[1] = raw;                                               /* save y */
+                *seen = 0x03;                                              /* x and y seen */
+            }
+            else
+            {
+                *seen = 0x00;                                              /* drop the set */
+            }
+        }
+        else if (type == ADXL362_FRAME_TYPE_Z)                             /* z closes a set */
+        {
+            if ((*seen == 0x03) && (block->len < ADXL362_BLOCK_MAX_LEN))   /* check the set and the block */
+            {
+                block->x[block->len] = xy[0];                              /* set x */
+                block->y[block->len] = xy[1];                              /* set y */
+                block->z[block->len] = raw;                                /* set z */
+                block->len++;                                              /* next set */
+            }
+            *seen = 0x00;                                                  /* clear the flags */
+        }
+        else                                                               /* temperature */
+        {
+            block->temperature_raw = raw;                                  /* set temperature */
+            block->temperature_valid = 1;                                  /* set valid */
+            *seen = 0x00;                                                  /* clear the flags */
+        }
+    }
+}
+
+/**
+ * @brief      read the fifo into a structure of arrays block
+ * @param[in]  *handle pointer to an adxl362 handle structure
+ * @param[out] *block pointer to a block buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read fifo failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       only the complete xyz sets are kept and no float conversion is done,
+ *             this is the input format of the signal processing modules, a set cut by
+ *             the end of the read is completed from the fifo so the next read starts on x
+ */
+uint8_t adxl362_read_fifo_block(adxl362_handle_t *handle, adxl362_block_t *block)
+{
+    uint8_t res;
+    uint8_t prev;
+    uint8_t seen;
+    uint8_t buf[2];
+    uint8_t tail[4];
+    uint16_t len;
+    uint16_t need;
+    int16_t xy[2];
+    
+    if (handle == NULL)                                                    /* check handle */
+    {
+        return 2;                                                          /* return error */
+    }
+    if (handle->inited != 1)                                               /* check handle initialization */
+    {
+        return 3;                                                          /* return error */
+    }
+    
+    res = a_adxl362_read(handle, ADXL362_REG_FIFO_ENTRIES_L, buf, 2);      /* read fifo entries */
+    if (res != 0)                                                          /* check the result */
+    {
+        handle->debug_print("adxl362: read fifo entries failed.\n");       /* read fifo entries failed */
+       
+        return 1;                                                          /* return error */
+    }
+    len = (uint16_t)((uint16_t)buf[1] << 8) | buf[0];                      /* set the length */
+    len &= 0x3FF;                                                          /* mask the length */
+    res = a_adxl362_read(handle, ADXL362_REG_FIFO_CONTROL, &prev, 1);      /* read fifo control */
+    if (res != 0)                                                          /* check the result */
+    {
+        handle->debug_print("adxl362: read fifo control failed.\n");       /* read fifo control failed */
+       
+        return 1;                                                          /* return error */
+    }
+    if (((prev >> 2) & 0x01) != 0)                                         /* fifo has temperature */
+    {
+        len = (len / 4) * 4;                                               /* data alignment */
+    }
+    else                                                                   /* no temperature */
+    {
+        len = (len / 3) * 3;                                               /* data alignment */
+    }
+    len = len < 512 ? len : 512;                                           /* adjust to buffer */
+    res = a_adxl362_read_fifo(handle, handle->buf, len * 2);               /* read from fifo */
+    if (res != 0)                                                          /* check the result */
+    {
+        handle->debug_print("adxl362: read fifo failed.\n");               /* read fifo failed */
+       
+        return 1;                                                          /* return error */
+    }
+    res = a_adxl362_read(handle, ADXL362_REG_FILTER_CTL, &prev, 1);        /* read filter */
+    if (res != 0)                                                          /* check the result */
+    {
+        handle->debug_print("adxl362: read filter failed.\n");             /* read filter failed */
+       
+        return 1;                                                          /* return error */
+    }
+    prev = (prev >> 6) & 0x3;                                              /* get the range */
+    block->range = prev < 2 ? (adxl362_range_t)prev : ADXL362_RANGE_8G;   /* 1x is 8g */
+    block->temperature_valid = 0;                                          /* clear the temperature */
+    block->len = 0;                                                        /* init 0 */
+    seen = 0;                                                              /* no open set */
+    a_adxl362_fifo_block_decode(block, handle->buf, len, xy, &seen);       /* decode */
+    if (((seen & 0x01) != 0) && (block->len < ADXL362_BLOCK_MAX_LEN))      /* a set is cut by the read */
+    {
+        need = ((seen & 0x02) != 0) ? 1 : 2;                               /* entries up to z */
+        res = a_adxl362_read(handle, ADXL362_REG_FIFO_ENTRIES_L, buf, 2);  /* read fifo entries */
+        if (res != 0)                                                      /* check the result */
+        {
+            handle->debug_print("adxl362: read fifo entries failed.\n");   /* read fifo entries failed */
+           
+            return 1;                                                      /* return error */
+        }
+        len = (uint16_t)((uint16_t)buf[1] << 8) | buf[0];                  /* set the length */
+        if ((len & 0x3FF) >= need)                                         /* check the entries */
+        {
+            res = a_adxl362_read_fifo(handle, tail, need * 2);             /* read the rest of the set */
+            if (res != 0)                                                  /* check the result */
+            {
+                handle->debug_print("adxl362: read fifo failed.\n");       /* read fifo failed */
+               
+                return 1;                                                  /* return error */
+            }
+            a_adxl362_fifo_block_decode(block, tail, need, xy, &seen);     /* decode */
+        }
+    }
+    
+    return 0;                                                              /* success return 0 */
+}
+
 /**
  * @brief     irq handler
  * @param[in] *handle pointer to an adxl362 handle structure
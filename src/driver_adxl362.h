@@ -205,6 +205,40 @@ typedef struct adxl362_frame_s
     float data;                      /**< converted data */
 } adxl362_frame_t;
 
+/**
+ * @brief adxl362 block max definition
+ */
+#define ADXL362_BLOCK_MAX_LEN        170        /**< max xyz sets in the 512 entries fifo */
+
+/**
+ * @brief adxl362 block structure definition
+ */
+typedef struct adxl362_block_s
+{
+    int16_t x[ADXL362_BLOCK_MAX_LEN];        /**< x axis raw data */
+    int16_t y[ADXL362_BLOCK_MAX_LEN];        /**< y axis raw data */
+    int16_t z[ADXL362_BLOCK_MAX_LEN];        /**< z axis raw data */
+    uint16_t len;                            /**< xyz set length */
+    adxl362_range_t range;                   /**< range of the raw data */
+    uint8_t temperature_valid;               /**< 1 if temperature_raw is valid */
+    int16_t temperature_raw;                 /**< last temperature raw data */
+} adxl362_block_t;
+
+/**
+ * @brief adxl362 self test report structure definition
+ */
+typedef struct adxl362_self_test_report_s
+{
+    float off_mg[3];          /**< averaged output with the self test off in mg */
+    float on_mg[3];           /**< averaged output with the self test on in mg */
+    float delta_mg[3];        /**< self test response in mg */
+    float min_mg[3];          /**< scaled low limit in mg */
+    float max_mg[3];          /**< scaled high limit in mg */
+    uint8_t pass_mask;        /**< bit 0 x, bit 1 y, bit 2 z */
+    uint8_t pass;             /**< 1 if all axes pass */
+    uint16_t periods;         /**< odr periods spent */
+} adxl362_self_test_report_t;
+
 /**
  * @brief adxl362 handle structure definition
  */
@@ -409,6 +443,20 @@ uint8_t adxl362_read(adxl362_handle_t *handle, int16_t raw[3], float g[3]);
  */
 uint8_t adxl362_read_fifo(adxl362_handle_t *handle, adxl362_frame_t *frame, uint16_t *frame_len);
 
+/**
+ * @brief      read the fifo into a structure of arrays block
+ * @param[in]  *handle pointer to an adxl362 handle structure
+ * @param[out] *block pointer to a block buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read fifo failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       only the complete xyz sets are kept and no float conversion is done,
+ *             this is the input format of the signal processing modules
+ */
+uint8_t adxl362_read_fifo_block(adxl362_handle_t *handle, adxl362_block_t *block);
+
 /**
  * @brief      read the data with eight most significant bits
  * @param[in]  *handle pointer to an adxl362 handle structure
@@ -1279,6 +1327,27 @@ uint8_t adxl362_set_self_test(adxl362_handle_t *handle, adxl362_bool_t enable);
  */
 uint8_t adxl362_get_self_test(adxl362_handle_t *handle, adxl362_bool_t *enable);
 
+/**
+ * @brief      run the statistical self test
+ * @param[in]  *handle pointer to an adxl362 handle structure
+ * @param[in]  supply_v supply voltage in volt
+ * @param[in]  samples averaged xyz sets per phase
+ * @param[out] *report pointer to a self test report buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 run self test failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 supply voltage is invalid
+ *             - 5 samples is invalid
+ *             - 6 fifo timeout
+ *             - 7 report is NULL
+ * @note       1.6V <= supply_v <= 3.5V, 0 < samples <= 170
+ *             the board must be still, the current range and odr are used and the
+ *             power, fifo and self test settings are restored at the end
+ */
+uint8_t adxl362_self_test(adxl362_handle_t *handle, float supply_v, uint8_t samples, adxl362_self_test_report_t *report);
+
 /**
  * @}
  */
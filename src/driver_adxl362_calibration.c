@@ -0,0 +1,637 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_calibration.c
+ * @brief     driver adxl362 calibration source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_adxl362_calibration.h"
+#include <math.h>
+#include <string.h>
+
+/**
+ * @brief adxl362 calibration definition
+ */
+#define ADXL362_CALIBRATION_POSE_MG         800        /**< min reading of the vertical axis in mg */
+#define ADXL362_CALIBRATION_DETECT_MG       300        /**< max reading of the level axes to detect a pose in mg */
+#define ADXL362_CALIBRATION_LEVEL_MG        50.0f      /**< max mean of the level axes to accept a pose in mg */
+#define ADXL362_CALIBRATION_NOISE_MG        30.0f      /**< max standard deviation of a pose in mg */
+#define ADXL362_CALIBRATION_VERSION         1          /**< blob version */
+
+/**
+ * @brief adxl362 calibration blob magic definition
+ */
+static const uint8_t gsc_adxl362_calibration_magic[4] = {'A', 'X', 'C', 'L'};        /**< blob magic */
+
+/**
+ * @brief     detect the pose of a sample
+ * @param[in] x x axis raw data
+ * @param[in] y y axis raw data
+ * @param[in] z z axis raw data
+ * @param[in] range range of the raw data
+ * @return    pose
+ * @note      one lsb is 1mg, 2mg and 4mg in the 2g, 4g and 8g range
+ */
+static adxl362_calibration_pose_t a_adxl362_calibration_pose(int16_t x, int16_t y, int16_t z, adxl362_range_t range)
+{
+    int32_t v[3];
+    int32_t a[3];
+    uint8_t i;
+    
+    v[0] = (int32_t)x * (1 << (uint8_t)range);                                             /* x in mg */
+    v[1] = (int32_t)y * (1 << (uint8_t)range);                                             /* y in mg */
+    v[2] = (int32_t)z * (1 << (uint8_t)range);                                             /* z in mg */
+    for (i = 0; i < 3; i++)                                                                /* all axes */
+    {
+        a[i] = v[i] < 0 ? -v[i] : v[i];                                                    /* abs */
+    }
+    for (i = 0; i < 3; i++)                                                                /* all axes */
+    {
+        if ((a[i] >= ADXL362_CALIBRATION_POSE_MG) && 
+            (a[(i + 1) % 3] <= ADXL362_CALIBRATION_DETECT_MG) && 
+            (a[(i + 2) % 3] <= ADXL362_CALIBRATION_DETECT_MG))                              /* this axis is vertical */
+        {
+            return (adxl362_calibration_pose_t)(i * 2 + (v[i] < 0 ? 1 : 0));               /* up or down */
+        }
+    }
+    
+    return ADXL362_CALIBRATION_POSE_NONE;                                                  /* tilted */
+}
+
+/**
+ * @brief     crc16 ccitt
+ * @param[in] crc crc of the previous bytes, 0xFFFF to start
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len buffer length
+ * @return    crc
+ * @note      polynomial 0x1021
+ */
+static uint16_t a_adxl362_calibration_crc16(uint16_t crc, const uint8_t *buf, uint16_t len)
+{
+    uint16_t i;
+    uint8_t j;
+    
+    for (i = 0; i < len; i++)                                                              /* all bytes */
+    {
+        crc ^= (uint16_t)buf[i] << 8;                                                      /* add the byte */
+        for (j = 0; j < 8; j++)                                                            /* all bits */
+        {
+            crc = (crc & 0x8000) != 0 ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);    /* shift */
+        }
+    }
+    
+    return crc;                                                                            /* return the crc */
+}
+
+/**
+ * @brief     restart the current pose
+ * @param[in] *handle pointer to an adxl362 calibration handle structure
+ * @param[in] pose new pose
+ * @param[in] range range of the raw data
+ * @note      none
+ */
+static void a_adxl362_calibration_restart(adxl362_calibration_handle_t *handle, adxl362_calibration_pose_t pose,
+                                          adxl362_range_t range)
+{
+    handle->pose = pose;                                                                   /* set the pose */
+    handle->pose_range = range;                                                            /* set the range */
+    handle->count = 0;                                                                     /* clear the count */
+    memset(handle->sum, 0, sizeof(handle->sum));                                           /* clear the sums */
+    memset(handle->sum_sq, 0, sizeof(handle->sum_sq));                                     /* clear the square sums */
+}
+
+/**
+ * @brief     initialize the calibration
+ * @param[in] *handle pointer to an adxl362 calibration handle structure
+ * @param[in] samples samples averaged per pose
+ * @param[in] *callback pointer to a pose done callback function
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 samples is invalid
+ * @note      0 < samples <= 65535
+ */
+uint8_t adxl362_calibration_init(adxl362_calibration_handle_t *handle, uint32_t samples,
+                                 void (*callback)(adxl362_calibration_pose_t pose, uint8_t done_mask))
+{
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if ((samples == 0) || (samples > 65535))                                               /* check the samples */
+    {
+        return 4;                                                                          /* return error */
+    }
+    
+    memset(handle, 0, sizeof(adxl362_calibration_handle_t));                               /* clear the handle */
+    handle->receive_callback = callback;                                                   /* set the callback */
+    handle->samples = samples;                                                             /* set the samples */
+    handle->pose = ADXL362_CALIBRATION_POSE_NONE;                                          /* no pose */
+    handle->range = ADXL362_RANGE_2G;                                                      /* init the range */
+    handle->inited = 1;                                                                    /* flag finish initialization */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     collect the static poses
+ * @param[in] *handle pointer to an adxl362 calibration handle structure
+ * @param[in] *x pointer to an x axis raw buffer
+ * @param[in] *y pointer to a y axis raw buffer
+ * @param[in] *z pointer to a z axis raw buffer
+ * @param[in] len buffer length
+ * @param[in] range range of the raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the pose is detected from the data, so the operator only turns the board over, a pose
+ *            restarts if the board moves or turns before the samples are collected and a noisy
+ *            pose is dropped, the callback runs once per finished pose, the solve takes the vertical
+ *            axis as exactly 1g, so a pose is only kept if the level axes average within 50mg, which
+ *            bounds the gain error to 0.25%, use a fixture level to about 3 degrees
+ */
+uint8_t adxl362_calibration_update(adxl362_calibration_handle_t *handle, const int16_t *x, const int16_t *y,
+                                   const int16_t *z, uint16_t len, adxl362_range_t range)
+{
+    uint16_t i;
+    uint8_t a;
+    uint8_t noisy;
+    float mean;
+    float var;
+    float lsb;
+    adxl362_calibration_pose_t pose;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    for (i = 0; i < len; i++)                                                              /* all samples */
+    {
+        pose = a_adxl362_calibration_pose(x[i], y[i], z[i], range);                        /* detect the pose */
+        if ((pose == ADXL362_CALIBRATION_POSE_NONE) || 
+            (((handle->done_mask >> pose) & 0x01) != 0))                                   /* tilted or done */
+        {
+            a_adxl362_calibration_restart(handle, ADXL362_CALIBRATION_POSE_NONE, range);   /* wait */
+            
+            continue;                                                                      /* next sample */
+        }
+        if ((pose != handle->pose) || (range != handle->pose_range))                       /* new pose */
+        {
+            a_adxl362_calibration_restart(handle, pose, range);                            /* restart */
+        }
+        handle->sum[0] += x[i];                                                            /* add x */
+        handle->sum[1] += y[i];                                                            /* add y */
+        handle->sum[2] += z[i];                                                            /* add z */
+        handle->sum_sq[0] += (uint64_t)((int32_t)x[i] * x[i]);                             /* add x^2 */
+        handle->sum_sq[1] += (uint64_t)((int32_t)y[i] * y[i]);                             /* add y^2 */
+        handle->sum_sq[2] += (uint64_t)((int32_t)z[i] * z[i]);                             /* add z^2 */
+        handle->count++;                                                                   /* add one */
+        if (handle->count < handle->samples)                                               /* check the count */
+        {
+            continue;                                                                      /* next sample */
+        }
+        
+        /* the pose is complete, keep it only if the board was still and level */
+        lsb = (float)(1 << (uint8_t)range);                                                /* mg per lsb */
+        noisy = 0;                                                                         /* init 0 */
+        for (a = 0; a < 3; a++)                                                            /* all axes */
+        {
+            mean = (float)handle->sum[a] / (float)handle->count;                           /* raw mean */
+            var = (float)((double)handle->sum_sq[a] / (double)handle->count - 
+                          (double)mean * (double)mean);                                    /* raw variance */
+            if (sqrtf(var > 0.0f ? var : 0.0f) * lsb > ADXL362_CALIBRATION_NOISE_MG)       /* check the noise */
+            {
+                noisy = 1;                                                                 /* moved */
+            }
+            if ((a != (uint8_t)pose / 2) && 
+                (fabsf(mean * lsb) > ADXL362_CALIBRATION_LEVEL_MG))                        /* check the tilt */
+            {
+                noisy = 1;                                                                 /* tilted */
+            }
+            handle->mean[pose][a] = mean * lsb / 1000.0f;                                  /* mean in g */
+        }
+        a_adxl362_calibration_restart(handle, ADXL362_CALIBRATION_POSE_NONE, range);       /* next pose */
+        if (noisy != 0)                                                                    /* check the noise */
+        {
+            continue;                                                                      /* collect again */
+        }
+        handle->done_mask |= (uint8_t)(1 << pose);                                         /* pose done */
+        if (handle->receive_callback != NULL)                                              /* check the callback */
+        {
+            handle->receive_callback(pose, handle->done_mask);                             /* run the callback */
+        }
+    }
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     collect the static poses from a fifo block
+ * @param[in] *handle pointer to an adxl362 calibration handle structure
+ * @param[in] *block pointer to a block read by adxl362_read_fifo_block
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 block is NULL
+ * @note      none
+ */
+uint8_t adxl362_calibration_update_block(adxl362_calibration_handle_t *handle, const adxl362_block_t *block)
+{
+    if (block == NULL)                                                                     /* check the block */
+    {
+        return 4;                                                                          /* return error */
+    }
+    
+    return adxl362_calibration_update(handle, block->x, block->y, block->z, block->len, block->range);        /* update */
+}
+
+/**
+ * @brief      get the next missing pose
+ * @param[in]  *handle pointer to an adxl362 calibration handle structure
+ * @param[out] *pose pointer to a pose buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       ADXL362_CALIBRATION_POSE_NONE means all poses are done
+ */
+uint8_t adxl362_calibration_get_next_pose(adxl362_calibration_handle_t *handle, adxl362_calibration_pose_t *pose)
+{
+    uint8_t i;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    for (i = 0; i < 6; i++)                                                                /* all poses */
+    {
+        if (((handle->done_mask >> i) & 0x01) == 0)                                        /* missing */
+        {
+            break;                                                                         /* found */
+        }
+    }
+    *pose = (adxl362_calibration_pose_t)i;                                                 /* 6 is none */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     solve the offset and gain
+ * @param[in] *handle pointer to an adxl362 calibration handle structure
+ * @param[in] cross_axis bool value, true also solves the cross axis terms
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 poses are missing
+ *            - 5 solve failed
+ * @note      the offset is the mean of the opposite poses and column j of the sensitivity
+ *            is half of their difference, the correction is its inverse or its diagonal inverse
+ */
+uint8_t adxl362_calibration_solve(adxl362_calibration_handle_t *handle, adxl362_bool_t cross_axis)
+{
+    uint8_t i;
+    uint8_t j;
+    float s[3][3];
+    float det;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    if (handle->done_mask != 0x3F)                                                         /* check the poses */
+    {
+        return 4;                                                                          /* return error */
+    }
+    
+    for (i = 0; i < 3; i++)                                                                /* all axes */
+    {
+        handle->offset[i] = (handle->mean[0][i] + handle->mean[1][i] + handle->mean[2][i] + 
+                             handle->mean[3][i] + handle->mean[4][i] + handle->mean[5][i]) / 6.0f;     /* offset */
+        for (j = 0; j < 3; j++)                                                            /* all poses */
+        {
+            s[i][j] = (handle->mean[j * 2][i] - handle->mean[j * 2 + 1][i]) * 0.5f;        /* sensitivity */
+        }
+    }
+    memset(handle->matrix, 0, sizeof(handle->matrix));                                     /* clear the matrix */
+    if (cross_axis == ADXL362_BOOL_TRUE)                                                   /* full inverse */
+    {
+        det = s[0][0] * (s[1][1] * s[2][2] - s[1][2] * s[2][1]) - 
+              s[0][1] * (s[1][0] * s[2][2] - s[1][2] * s[2][0]) + 
+              s[0][2] * (s[1][0] * s[2][1] - s[1][1] * s[2][0]);                           /* determinant */
+        if (fabsf(det) < 0.125f)                                                           /* check the determinant */
+        {
+            return 5;                                                                      /* return error */
+        }
+        handle->matrix[0][0] = (s[1][1] * s[2][2] - s[1][2] * s[2][1]) / det;              /* cofactor */
+        handle->matrix[0][1] = (s[0][2] * s[2][1] - s[0][1] * s[2][2]) / det;              /* cofactor */
+        handle->matrix[0][2] = (s[0][1] * s[1][2] - s[0][2] * s[1][1]) / det;              /* cofactor */
+        handle->matrix[1][0] = (s[1][2] * s[2][0] - s[1][0] * s[2][2]) / det;              /* cofactor */
+        handle->matrix[1][1] = (s[0][0] * s[2][2] - s[0][2] * s[2][0]) / det;              /* cofactor */
+        handle->matrix[1][2] = (s[0][2] * s[1][0] - s[0][0] * s[1][2]) / det;              /* cofactor */
+        handle->matrix[2][0] = (s[1][0] * s[2][1] - s[1][1] * s[2][0]) / det;              /* cofactor */
+        handle->matrix[2][1] = (s[0][1] * s[2][0] - s[0][0] * s[2][1]) / det;              /* cofactor */
+        handle->matrix[2][2] = (s[0][0] * s[1][1] - s[0][1] * s[1][0]) / det;              /* cofactor */
+    }
+    else
+    {
+        for (i = 0; i < 3; i++)                                                            /* all axes */
+        {
+            if (s[i][i] < 0.5f)                                                            /* check the gain */
+            {
+                return 5;                                                                  /* return error */
+            }
+            handle->matrix[i][i] = 1.0f / s[i][i];                                         /* inverse gain */
+        }
+    }
+    handle->cross_axis = (cross_axis == ADXL362_BOOL_TRUE) ? 1 : 0;                        /* set the cross axis */
+    handle->solved = 1;                                                                    /* solved */
+    handle->fused = 0;                                                                     /* fuse again */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief      export the calibration blob
+ * @param[in]  *handle pointer to an adxl362 calibration handle structure
+ * @param[out] *blob pointer to a 32 bytes buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 calibration is not solved
+ *             - 5 calibration is out of the blob range
+ * @note       little endian, magic "AXCL", version, flags, crc16 ccitt of all but the crc,
+ *             offsets in 0.1mg and the matrix minus identity in q16, both int16
+ */
+uint8_t adxl362_calibration_export(adxl362_calibration_handle_t *handle, uint8_t blob[ADXL362_CALIBRATION_BLOB_SIZE])
+{
+    uint8_t i;
+    uint16_t crc;
+    float v[12];
+    int32_t q;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    if (handle->solved != 1)                                                               /* check the calibration */
+    {
+        return 4;                                                                          /* return error */
+    }
+    
+    for (i = 0; i < 3; i++)                                                                /* all axes */
+    {
+        v[i] = handle->offset[i] * 10000.0f;                                               /* 0.1mg */
+    }
+    for (i = 0; i < 9; i++)                                                                /* all matrix entries */
+    {
+        v[3 + i] = (handle->matrix[i / 3][i % 3] - ((i % 4) == 0 ? 1.0f : 0.0f)) * 65536.0f;    /* q16 of matrix - i */
+    }
+    memcpy(blob, gsc_adxl362_calibration_magic, 4);                                        /* set the magic */
+    blob[4] = ADXL362_CALIBRATION_VERSION;                                                 /* set the version */
+    blob[5] = handle->cross_axis;                                                          /* set the flags */
+    for (i = 0; i < 12; i++)                                                               /* all values */
+    {
+        q = (int32_t)floorf(v[i] + 0.5f);                                                  /* round */
+        if ((q > 32767) || (q < -32768))                                                   /* check the range */
+        {
+            return 5;                                                                      /* return error */
+        }
+        blob[8 + i * 2] = (uint8_t)(q & 0xFF);                                             /* low byte */
+        blob[9 + i * 2] = (uint8_t)((q >> 8) & 0xFF);                                      /* high byte */
+    }
+    crc = a_adxl362_calibration_crc16(0xFFFF, blob, 6);                                    /* header crc */
+    crc = a_adxl362_calibration_crc16(crc, &blob[8], ADXL362_CALIBRATION_BLOB_SIZE - 8);   /* payload crc */
+    blob[6] = (uint8_t)(crc & 0xFF);                                                       /* low byte */
+    blob[7] = (uint8_t)(crc >> 8);                                                         /* high byte */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     import a calibration blob
+ * @param[in] *handle pointer to an adxl362 calibration handle structure
+ * @param[in] *blob pointer to a 32 bytes blob
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 blob header is invalid
+ *            - 5 blob crc is invalid
+ * @note      none
+ */
+uint8_t adxl362_calibration_import(adxl362_calibration_handle_t *handle, const uint8_t blob[ADXL362_CALIBRATION_BLOB_SIZE])
+{
+    uint8_t i;
+    uint16_t crc;
+    int16_t q;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    if ((memcmp(blob, gsc_adxl362_calibration_magic, 4) != 0) || 
+        (blob[4] != ADXL362_CALIBRATION_VERSION) || (blob[5] > 1))                         /* check the header */
+    {
+        return 4;                                                                          /* return error */
+    }
+    crc = a_adxl362_calibration_crc16(0xFFFF, blob, 6);                                    /* header crc */
+    crc = a_adxl362_calibration_crc16(crc, &blob[8], ADXL362_CALIBRATION_BLOB_SIZE - 8);   /* payload crc */
+    if (crc != (uint16_t)(blob[6] | ((uint16_t)blob[7] << 8)))                             /* check the crc */
+    {
+        return 5;                                                                          /* return error */
+    }
+    
+    for (i = 0; i < 12; i++)                                                               /* all values */
+    {
+        q = (int16_t)(uint16_t)(blob[8 + i * 2] | ((uint16_t)blob[9 + i * 2] << 8));      /* get the value */
+        if (i < 3)                                                                         /* offset */
+        {
+            handle->offset[i] = (float)q / 10000.0f;                                       /* g */
+        }
+        else                                                                               /* matrix */
+        {
+            handle->matrix[(i - 3) / 3][(i - 3) % 3] = (float)q / 65536.0f + 
+                                                      (((i - 3) % 4) == 0 ? 1.0f : 0.0f);  /* add the identity */
+        }
+    }
+    handle->cross_axis = blob[5];                                                          /* set the cross axis */
+    handle->solved = 1;                                                                    /* solved */
+    handle->fused = 0;                                                                     /* fuse again */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief      decode raw samples with the calibration
+ * @param[in]  *handle pointer to an adxl362 calibration handle structure
+ * @param[in]  *x pointer to an x axis raw buffer
+ * @param[in]  *y pointer to a y axis raw buffer
+ * @param[in]  *z pointer to a z axis raw buffer
+ * @param[in]  len buffer length
+ * @param[in]  range range of the raw data
+ * @param[out] *gx pointer to an x axis buffer in g
+ * @param[out] *gy pointer to a y axis buffer in g
+ * @param[out] *gz pointer to a z axis buffer in g
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 calibration is not solved
+ * @note       the range scale, gain and offset are fused into one multiply add per axis,
+ *             three with the cross axis terms, so it costs the same as the nominal decode
+ */
+uint8_t adxl362_calibration_decode(adxl362_calibration_handle_t *handle, const int16_t *x, const int16_t *y,
+                                   const int16_t *z, uint16_t len, adxl362_range_t range,
+                                   float *gx, float *gy, float *gz)
+{
+    uint16_t i;
+    uint8_t r;
+    uint8_t c;
+    float scale;
+    float c00, c01, c02, c10, c11, c12, c20, c21, c22;
+    float b0, b1, b2;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    if (handle->solved != 1)                                                               /* check the calibration */
+    {
+        return 4;                                                                          /* return error */
+    }
+    
+    if ((handle->fused == 0) || (handle->range != range))                                  /* fuse once per range */
+    {
+        /* g = m * (raw * scale - offset) = (m * scale) * raw - m * offset */
+        scale = (float)(1 << (uint8_t)range) / 1000.0f;                                    /* g per lsb */
+        for (r = 0; r < 3; r++)                                                            /* all rows */
+        {
+            handle->bias[r] = 0.0f;                                                        /* init 0 */
+            for (c = 0; c < 3; c++)                                                        /* all columns */
+            {
+                handle->coefficient[r][c] = handle->matrix[r][c] * scale;                  /* fused gain */
+                handle->bias[r] -= handle->matrix[r][c] * handle->offset[c];               /* fused offset */
+            }
+        }
+        handle->range = range;                                                             /* set the range */
+        handle->fused = 1;                                                                 /* fused */
+    }
+    
+    c00 = handle->coefficient[0][0];                                                       /* get the coefficient */
+    c11 = handle->coefficient[1][1];                                                       /* get the coefficient */
+    c22 = handle->coefficient[2][2];                                                       /* get the coefficient */
+    b0 = handle->bias[0];                                                                  /* get the x bias */
+    b1 = handle->bias[1];                                                                  /* get the y bias */
+    b2 = handle->bias[2];                                                                  /* get the z bias */
+    if (handle->cross_axis == 0)                                                           /* diagonal */
+    {
+        for (i = 0; i < len; i++)                                                          /* all samples */
+        {
+            gx[i] = (float)x[i] * c00 + b0;                                                /* x */
+            gy[i] = (float)y[i] * c11 + b1;                                                /* y */
+            gz[i] = (float)z[i] * c22 + b2;                                                /* z */
+        }
+    }
+    else
+    {
+        c01 = handle->coefficient[0][1];                                                   /* get the coefficient */
+        c02 = handle->coefficient[0][2];                                                   /* get the coefficient */
+        c10 = handle->coefficient[1][0];                                                   /* get the coefficient */
+        c12 = handle->coefficient[1][2];                                                   /* get the coefficient */
+        c20 = handle->coefficient[2][0];                                                   /* get the coefficient */
+        c21 = handle->coefficient[2][1];                                                   /* get the coefficient */
+        for (i = 0; i < len; i++)                                                          /* all samples */
+        {
+            gx[i] = (float)x[i] * c00 + (float)y[i] * c01 + (float)z[i] * c02 + b0;        /* x */
+            gy[i] = (float)x[i] * c10 + (float)y[i] * c11 + (float)z[i] * c12 + b1;        /* y */
+            gz[i] = (float)x[i] * c20 + (float)y[i] * c21 + (float)z[i] * c22 + b2;        /* z */
+        }
+    }
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief      decode a fifo block with the calibration
+ * @param[in]  *handle pointer to an adxl362 calibration handle structure
+ * @param[in]  *block pointer to a block read by adxl362_read_fifo_block
+ * @param[out] *gx pointer to an x axis buffer in g
+ * @param[out] *gy pointer to a y axis buffer in g
+ * @param[out] *gz pointer to a z axis buffer in g
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 calibration is not solved or block is NULL
+ * @note       none
+ */
+uint8_t adxl362_calibration_decode_block(adxl362_calibration_handle_t *handle, const adxl362_block_t *block,
+                                         float *gx, float *gy, float *gz)
+{
+    if (block == NULL)                                                                     /* check the block */
+    {
+        return 4;                                                                          /* return error */
+    }
+    
+    return adxl362_calibration_decode(handle, block->x, block->y, block->z, block->len, block->range,
+                                      gx, gy, gz);                                         /* decode */
+}
@@ -0,0 +1,249 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_calibration.h
+ * @brief     driver adxl362 calibration header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADXL362_CALIBRATION_H
+#define DRIVER_ADXL362_CALIBRATION_H
+
+#include "driver_adxl362.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup adxl362_calibration_driver adxl362 calibration driver function
+ * @brief    adxl362 calibration driver modules
+ * @ingroup  adxl362_driver
+ * @{
+ */
+
+/**
+ * @brief adxl362 calibration blob size definition
+ */
+#define ADXL362_CALIBRATION_BLOB_SIZE        32        /**< header, crc, offsets and matrix */
+
+/**
+ * @brief adxl362 calibration pose enumeration definition
+ */
+typedef enum
+{
+    ADXL362_CALIBRATION_POSE_X_UP   = 0x00,        /**< x axis points up */
+    ADXL362_CALIBRATION_POSE_X_DOWN = 0x01,        /**< x axis points down */
+    ADXL362_CALIBRATION_POSE_Y_UP   = 0x02,        /**< y axis points up */
+    ADXL362_CALIBRATION_POSE_Y_DOWN = 0x03,        /**< y axis points down */
+    ADXL362_CALIBRATION_POSE_Z_UP   = 0x04,        /**< z axis points up */
+    ADXL362_CALIBRATION_POSE_Z_DOWN = 0x05,        /**< z axis points down */
+    ADXL362_CALIBRATION_POSE_NONE   = 0x06,        /**< no valid pose */
+} adxl362_calibration_pose_t;
+
+/**
+ * @brief adxl362 calibration handle structure definition
+ */
+typedef struct adxl362_calibration_handle_s
+{
+    void (*receive_callback)(adxl362_calibration_pose_t pose, uint8_t done_mask);      /**< point to a receive_callback function address */
+    uint32_t samples;                                                                   /**< samples averaged per pose */
+    adxl362_calibration_pose_t pose;                                                    /**< pose being collected */
+    adxl362_range_t pose_range;                                                         /**< range of the pose sums */
+    uint32_t count;                                                                     /**< samples of the current pose */
+    int32_t sum[3];                                                                     /**< x, y, z raw sums */
+    uint64_t sum_sq[3];                                                                 /**< x, y, z raw square sums */
+    float mean[6][3];                                                                   /**< x, y, z mean of every pose in g */
+    uint8_t done_mask;                                                                  /**< bit n is set if pose n is done */
+    float matrix[3][3];                                                                 /**< correction matrix */
+    float offset[3];                                                                    /**< x, y, z offset in g */
+    uint8_t cross_axis;                                                                 /**< 1 if the matrix has cross axis terms */
+    uint8_t solved;                                                                     /**< 1 if the correction is valid */
+    adxl362_range_t range;                                                              /**< range of the fused coefficients */
+    uint8_t fused;                                                                      /**< 1 if the fused coefficients are valid */
+    float coefficient[3][3];                                                            /**< matrix times g per lsb */
+    float bias[3];                                                                      /**< x, y, z bias in g */
+    uint8_t inited;                                                                     /**< inited flag */
+} adxl362_calibration_handle_t;
+
+/**
+ * @brief     initialize the calibration
+ * @param[in] *handle pointer to an adxl362 calibration handle structure
+ * @param[in] samples samples averaged per pose
+ * @param[in] *callback pointer to a pose done callback function
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 samples is invalid
+ * @note      0 < samples <= 65535
+ */
+uint8_t adxl362_calibration_init(adxl362_calibration_handle_t *handle, uint32_t samples,
+                                 void (*callback)(adxl362_calibration_pose_t pose, uint8_t done_mask));
+
+/**
+ * @brief     collect the static poses
+ * @param[in] *handle pointer to an adxl362 calibration handle structure
+ * @param[in] *x pointer to an x axis raw buffer
+ * @param[in] *y pointer to a y axis raw buffer
+ * @param[in] *z pointer to a z axis raw buffer
+ * @param[in] len buffer length
+ * @param[in] range range of the raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the pose is detected from the data, so the operator only turns the board over, a pose
+ *            restarts if the board moves or turns before the samples are collected and a noisy
+ *            pose is dropped, the callback runs once per finished pose, the solve takes the vertical
+ *            axis as exactly 1g, so a pose is only kept if the level axes average within 50mg, which
+ *            bounds the gain error to 0.25%, use a fixture level to about 3 degrees
+ */
+uint8_t adxl362_calibration_update(adxl362_calibration_handle_t *handle, const int16_t *x, const int16_t *y,
+                                   const int16_t *z, uint16_t len, adxl362_range_t range);
+
+/**
+ * @brief     collect the static poses from a fifo block
+ * @param[in] *handle pointer to an adxl362 calibration handle structure
+ * @param[in] *block pointer to a block read by adxl362_read_fifo_block
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 block is NULL
+ * @note      none
+ */
+uint8_t adxl362_calibration_update_block(adxl362_calibration_handle_t *handle, const adxl362_block_t *block);
+
+/**
+ * @brief      get the next missing pose
+ * @param[in]  *handle pointer to an adxl362 calibration handle structure
+ * @param[out] *pose pointer to a pose buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       ADXL362_CALIBRATION_POSE_NONE means all poses are done
+ */
+uint8_t adxl362_calibration_get_next_pose(adxl362_calibration_handle_t *handle, adxl362_calibration_pose_t *pose);
+
+/**
+ * @brief     solve the offset and gain
+ * @param[in] *handle pointer to an adxl362 calibration handle structure
+ * @param[in] cross_axis bool value, true also solves the cross axis terms
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 poses are missing
+ *            - 5 solve failed
+ * @note      the offset is the mean of the opposite poses and column j of the sensitivity
+ *            is half of their difference, the correction is its inverse or its diagonal inverse
+ */
+uint8_t adxl362_calibration_solve(adxl362_calibration_handle_t *handle, adxl362_bool_t cross_axis);
+
+/**
+ * @brief      export the calibration blob
+ * @param[in]  *handle pointer to an adxl362 calibration handle structure
+ * @param[out] *blob pointer to a 32 bytes buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 calibration is not solved
+ *             - 5 calibration is out of the blob range
+ * @note       little endian, magic "AXCL", version, flags, crc16 ccitt of all but the crc,
+ *             offsets in 0.1mg and the matrix minus identity in q16, both int16
+ */
+uint8_t adxl362_calibration_export(adxl362_calibration_handle_t *handle, uint8_t blob[ADXL362_CALIBRATION_BLOB_SIZE]);
+
+/**
+ * @brief     import a calibration blob
+ * @param[in] *handle pointer to an adxl362 calibration handle structure
+ * @param[in] *blob pointer to a 32 bytes blob
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 blob header is invalid
+ *            - 5 blob crc is invalid
+ * @note      none
+ */
+uint8_t adxl362_calibration_import(adxl362_calibration_handle_t *handle, const uint8_t blob[ADXL362_CALIBRATION_BLOB_SIZE]);
+
+/**
+ * @brief      decode raw samples with the calibration
+ * @param[in]  *handle pointer to an adxl362 calibration handle structure
+ * @param[in]  *x pointer to an x axis raw buffer
+ * @param[in]  *y pointer to a y axis raw buffer
+ * @param[in]  *z pointer to a z axis raw buffer
+ * @param[in]  len buffer length
+ * @param[in]  range range of the raw data
+ * @param[out] *gx pointer to an x axis buffer in g
+ * @param[out] *gy pointer to a y axis buffer in g
+ * @param[out] *gz pointer to a z axis buffer in g
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 calibration is not solved
+ * @note       the range scale, gain and offset are fused into one multiply add per axis,
+ *             three with the cross axis terms, so it costs the same as the nominal decode
+ */
+uint8_t adxl362_calibration_decode(adxl362_calibration_handle_t *handle, const int16_t *x, const int16_t *y,
+                                   const int16_t *z, uint16_t len, adxl362_range_t range,
+                                   float *gx, float *gy, float *gz);
+
+/**
+ * @brief      decode a fifo block with the calibration
+ * @param[in]  *handle pointer to an adxl362 calibration handle structure
+ * @param[in]  *block pointer to a block read by adxl362_read_fifo_block
+ * @param[out] *gx pointer to an x axis buffer in g
+ * @param[out] *gy pointer to a y axis buffer in g
+ * @param[out] *gz pointer to a z axis buffer in g
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 calibration is not solved or block is NULL
+ * @note       none
+ */
+uint8_t adxl362_calibration_decode_block(adxl362_calibration_handle_t *handle, const adxl362_block_t *block,
+                                         float *gx, float *gy, float *gz);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,484 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_codec.c
+ * @brief     driver adxl362 codec source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_adxl362_codec.h"
+#include <string.h>
+
+/**
+ * @brief adxl362 codec definition
+ */
+#define ADXL362_CODEC_SYNC           0xA5        /**< block sync byte */
+#define ADXL362_CODEC_VERSION        1           /**< format version */
+#define ADXL362_CODEC_PACKED         15          /**< parameter of a 12 bits packed axis */
+#define ADXL362_CODEC_ESCAPE         16          /**< unary length of an escaped value */
+#define ADXL362_CODEC_ZIGZAG_BITS    13          /**< bits of an escaped zigzag delta */
+
+/**
+ * @brief adxl362 codec bit stream structure definition
+ */
+typedef struct adxl362_codec_bits_s
+{
+    uint8_t *out;              /**< output buffer */
+    const uint8_t *in;         /**< input buffer */
+    uint16_t pos;              /**< byte position */
+    uint16_t size;             /**< input size */
+    uint64_t acc;              /**< bit accumulator */
+    uint8_t bits;              /**< bits in the accumulator */
+    uint8_t error;             /**< read past the end */
+} adxl362_codec_bits_t;
+
+/**
+ * @brief         write bits msb first
+ * @param[in,out] *s pointer to a bit stream
+ * @param[in]     v value
+ * @param[in]     n bits, at most 32
+ * @note          none
+ */
+static inline void a_adxl362_codec_put(adxl362_codec_bits_t *s, uint32_t v, uint8_t n)
+{
+    s->acc = (s->acc << n) | v;                                                            /* append */
+    s->bits += n;                                                                          /* add the bits */
+    while (s->bits >= 8)                                                                   /* whole bytes */
+    {
+        s->bits -= 8;                                                                      /* one byte less */
+        s->out[s->pos++] = (uint8_t)(s->acc >> s->bits);                                   /* write the byte */
+    }
+}
+
+/**
+ * @brief         read bits msb first
+ * @param[in,out] *s pointer to a bit stream
+ * @param[in]     n bits, at most 16
+ * @return        value
+ * @note          reading past the end returns zeros and sets the error
+ */
+static inline uint32_t a_adxl362_codec_get(adxl362_codec_bits_t *s, uint8_t n)
+{
+    while (s->bits < n)                                                                    /* refill */
+    {
+        if (s->pos >= s->size)                                                             /* check the end */
+        {
+            s->error = 1;                                                                  /* flag the error */
+            s->acc <<= 8;                                                                  /* pad with zeros */
+        }
+        else
+        {
+            s->acc = (s->acc << 8) | s->in[s->pos++];                                      /* next byte */
+        }
+        s->bits += 8;                                                                      /* add the bits */
+    }
+    s->bits -= n;                                                                          /* consume */
+    
+    return (uint32_t)(s->acc >> s->bits) & ((1U << n) - 1);                                /* return the bits */
+}
+
+/**
+ * @brief      choose the coding of one axis
+ * @param[in]  *v pointer to the raw samples
+ * @param[in]  len sample length
+ * @param[out] *u pointer to a zigzag buffer
+ * @param[out] *k pointer to a parameter buffer
+ * @param[out] *cost pointer to a bits buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 sample is not 12 bits
+ * @note       the rice parameter is the smallest k with (len - 1) * 2^k >= sum of u, then the exact
+ *             rice size is compared with 12 bits packing
+ */
+static uint8_t a_adxl362_codec_plan(const int16_t *v, uint16_t len, uint16_t *u, uint8_t *k, uint32_t *cost)
+{
+    uint16_t i;
+    uint16_t n;
+    int32_t d;
+    int32_t lo;
+    int32_t hi;
+    uint32_t sum;
+    uint32_t bits;
+    uint32_t q;
+    
+    lo = 0;                                                                                /* init 0 */
+    hi = 0;                                                                                /* init 0 */
+    for (i = 0; i < len; i++)                                                              /* all samples */
+    {
+        lo = v[i] < lo ? v[i] : lo;                                                        /* min */
+        hi = v[i] > hi ? v[i] : hi;                                                        /* max */
+    }
+    if ((lo < -2048) || (hi > 2047))                                                       /* check 12 bits */
+    {
+        return 1;                                                                          /* return error */
+    }
+    n = len > 0 ? len - 1 : 0;                                                             /* coded samples */
+    sum = 0;                                                                               /* init 0 */
+    for (i = 0; i < n; i++)                                                                /* all deltas */
+    {
+        d = (int32_t)v[i + 1] - v[i];                                                      /* delta */
+        u[i] = (uint16_t)((uint32_t)(d * 2) ^ (uint32_t)(d >> 31));                        /* zigzag */
+        sum += u[i];                                                                       /* add */
+    }
+    *k = 0;                                                                                /* init 0 */
+    while (((uint32_t)n << *k) < sum)                                                      /* find the parameter */
+    {
+        (*k)++;                                                                            /* next */
+    }
+    bits = 0;                                                                              /* init 0 */
+    for (i = 0; i < n; i++)                                                                /* all deltas */
+    {
+        q = (uint32_t)u[i] >> *k;                                                          /* quotient */
+        bits += q < ADXL362_CODEC_ESCAPE ? q + 1 + *k : 
+                ADXL362_CODEC_ESCAPE + ADXL362_CODEC_ZIGZAG_BITS;                          /* rice or escape */
+    }
+    if (bits >= (uint32_t)n * 12)                                                          /* packing is smaller */
+    {
+        *k = ADXL362_CODEC_PACKED;                                                         /* pack */
+        bits = (uint32_t)n * 12;                                                           /* 12 bits each */
+    }
+    *cost = bits;                                                                          /* set the cost */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     initialize the codec
+ * @param[in] *handle pointer to an adxl362 codec handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      none
+ */
+uint8_t adxl362_codec_init(adxl362_codec_handle_t *handle)
+{
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    
+    memset(handle, 0, sizeof(adxl362_codec_handle_t));                                     /* clear the handle */
+    handle->inited = 1;                                                                    /* flag finish initialization */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief      encode a fifo block
+ * @param[in]  *handle pointer to an adxl362 codec handle structure
+ * @param[in]  *block pointer to a block read by adxl362_read_fifo_block
+ * @param[out] *out pointer to an output buffer
+ * @param[in]  size output buffer size
+ * @param[out] *out_len pointer to an encoded length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 block is NULL or invalid
+ *             - 5 output buffer is too small
+ * @note       each axis is coded as the delta of the previous sample, zigzag mapped and rice coded,
+ *             an axis is bit packed in 12 bits when rice would be larger, a size of
+ *             ADXL362_CODEC_MAX_SIZE always fits
+ */
+uint8_t adxl362_codec_encode_block(adxl362_codec_handle_t *handle, const adxl362_block_t *block,
+                                   uint8_t *out, uint16_t size, uint16_t *out_len)
+{
+    uint8_t a;
+    uint8_t k[3];
+    uint16_t i;
+    uint16_t n;
+    uint16_t payload;
+    uint32_t q;
+    uint32_t cost[3];
+    const int16_t *v[3];
+    adxl362_codec_bits_t s;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    if ((block == NULL) || (block->len > ADXL362_BLOCK_MAX_LEN) || 
+        ((uint8_t)block->range > 2))                                                       /* check the block */
+    {
+        return 4;                                                                          /* return error */
+    }
+    
+    v[0] = block->x;                                                                       /* x */
+    v[1] = block->y;                                                                       /* y */
+    v[2] = block->z;                                                                       /* z */
+    for (a = 0; a < 3; a++)                                                                /* all axes */
+    {
+        if (a_adxl362_codec_plan(v[a], block->len, handle->zigzag[a], &k[a], &cost[a]) != 0)          /* plan the axis */
+        {
+            return 4;                                                                      /* return error */
+        }
+    }
+    payload = (uint16_t)((cost[0] + cost[1] + cost[2] + 7) / 8);                           /* payload bytes */
+    if (size < ADXL362_CODEC_HEADER_SIZE + payload)                                        /* check the size */
+    {
+        return 5;                                                                          /* return error */
+    }
+    
+    /* header, little endian */
+    out[0] = ADXL362_CODEC_SYNC;                                                           /* sync */
+    out[1] = (uint8_t)((ADXL362_CODEC_VERSION << 4) | 
+                       ((block->temperature_valid != 0 ? 1 : 0) << 2) | (uint8_t)block->range);      /* version and flags */
+    out[2] = (uint8_t)(block->len & 0xFF);                                                 /* length low */
+    out[3] = (uint8_t)(block->len >> 8);                                                   /* length high */
+    out[4] = (uint8_t)(payload & 0xFF);                                                    /* payload low */
+    out[5] = (uint8_t)(payload >> 8);                                                      /* payload high */
+    out[6] = (uint8_t)((uint16_t)block->temperature_raw & 0xFF);                           /* temperature low */
+    out[7] = (uint8_t)((uint16_t)block->temperature_raw >> 8);                             /* temperature high */
+    out[8] = (uint8_t)(k[0] | (k[1] << 4));                                                /* x and y parameters */
+    out[9] = k[2];                                                                         /* z parameter */
+    for (a = 0; a < 3; a++)                                                                /* first samples */
+    {
+        n = block->len > 0 ? (uint16_t)v[a][0] : 0;                                        /* first sample */
+        out[10 + a * 2] = (uint8_t)(n & 0xFF);                                             /* low */
+        out[11 + a * 2] = (uint8_t)(n >> 8);                                               /* high */
+    }
+    
+    /* payload, msb first, the axes follow each other without padding */
+    s.out = &out[ADXL362_CODEC_HEADER_SIZE];                                               /* payload */
+    s.pos = 0;                                                                             /* init 0 */
+    s.acc = 0;                                                                             /* init 0 */
+    s.bits = 0;                                                                            /* init 0 */
+    n = block->len > 0 ? block->len - 1 : 0;                                               /* coded samples */
+    for (a = 0; a < 3; a++)                                                                /* all axes */
+    {
+        if (k[a] == ADXL362_CODEC_PACKED)                                                  /* packed */
+        {
+            for (i = 0; i < n; i++)                                                        /* all samples */
+            {
+                a_adxl362_codec_put(&s, (uint32_t)(uint16_t)v[a][i + 1] & 0xFFF, 12);      /* 12 bits */
+            }
+            continue;                                                                      /* next axis */
+        }
+        for (i = 0; i < n; i++)                                                            /* all deltas */
+        {
+            q = (uint32_t)handle->zigzag[a][i] >> k[a];                                    /* quotient */
+            if (q < ADXL362_CODEC_ESCAPE)                                                  /* rice */
+            {
+                a_adxl362_codec_put(&s, (((1U << q) - 1) << (k[a] + 1)) | 
+                                    (handle->zigzag[a][i] & ((1U << k[a]) - 1)), 
+                                    (uint8_t)(q + 1 + k[a]));                              /* unary, stop and remainder */
+            }
+            else                                                                           /* escape */
+            {
+                a_adxl362_codec_put(&s, (1U << ADXL362_CODEC_ESCAPE) - 1, ADXL362_CODEC_ESCAPE);        /* escape */
+                a_adxl362_codec_put(&s, handle->zigzag[a][i], ADXL362_CODEC_ZIGZAG_BITS);               /* raw zigzag */
+            }
+        }
+    }
+    if (s.bits > 0)                                                                        /* last byte */
+    {
+        a_adxl362_codec_put(&s, 0, (uint8_t)(8 - s.bits));                                 /* pad with zeros */
+    }
+    *out_len = ADXL362_CODEC_HEADER_SIZE + payload;                                        /* set the length */
+    handle->blocks++;                                                                      /* add one */
+    handle->raw_bytes += (uint32_t)block->len * 6;                                         /* fifo bytes */
+    handle->coded_bytes += *out_len;                                                       /* coded bytes */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief      decode one encoded block
+ * @param[in]  *handle pointer to an adxl362 codec handle structure
+ * @param[in]  *in pointer to an encoded buffer
+ * @param[in]  size encoded buffer size
+ * @param[out] *block pointer to a block buffer
+ * @param[out] *used pointer to a used bytes buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 a buffer is NULL or the input is shorter than the block
+ *             - 5 header is invalid
+ *             - 6 payload is invalid
+ * @note       used is the size of the decoded block, the next block starts right after it,
+ *             the block has no checksum so the storage or radio layer must provide one
+ */
+uint8_t adxl362_codec_decode_block(adxl362_codec_handle_t *handle, const uint8_t *in, uint16_t size,
+                                   adxl362_block_t *block, uint16_t *used)
+{
+    uint8_t a;
+    uint8_t k[3];
+    uint16_t i;
+    uint16_t n;
+    uint16_t len;
+    uint16_t payload;
+    uint32_t q;
+    uint32_t u;
+    int32_t v;
+    int16_t *out[3];
+    adxl362_codec_bits_t s;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    if ((in == NULL) || (block == NULL) || (used == NULL) || 
+        (size < ADXL362_CODEC_HEADER_SIZE))                                                /* check the header size */
+    {
+        return 4;                                                                          /* return error */
+    }
+    
+    len = (uint16_t)(in[2] | (in[3] << 8));                                                /* get the length */
+    payload = (uint16_t)(in[4] | (in[5] << 8));                                            /* get the payload */
+    k[0] = in[8] & 0x0F;                                                                   /* x parameter */
+    k[1] = in[8] >> 4;                                                                     /* y parameter */
+    k[2] = in[9] & 0x0F;                                                                   /* z parameter */
+    if ((in[0] != ADXL362_CODEC_SYNC) || ((in[1] >> 4) != ADXL362_CODEC_VERSION) || 
+        ((in[1] & 0x03) > 2) || ((in[1] & 0x08) != 0) || (len > ADXL362_BLOCK_MAX_LEN) || 
+        ((in[9] & 0xF0) != 0))                                                             /* check the header */
+    {
+        return 5;                                                                          /* return error */
+    }
+    for (a = 0; a < 3; a++)                                                                /* all parameters */
+    {
+        if ((k[a] > ADXL362_CODEC_ZIGZAG_BITS) && (k[a] != ADXL362_CODEC_PACKED))          /* check the parameter */
+        {
+            return 5;                                                                      /* return error */
+        }
+    }
+    if (size < ADXL362_CODEC_HEADER_SIZE + payload)                                        /* check the block size */
+    {
+        return 4;                                                                          /* return error */
+    }
+    
+    block->len = len;                                                                      /* set the length */
+    block->range = (adxl362_range_t)(in[1] & 0x03);                                        /* set the range */
+    block->temperature_valid = (in[1] >> 2) & 0x01;                                        /* set the temperature flag */
+    block->temperature_raw = (int16_t)(uint16_t)(in[6] | (in[7] << 8));                   /* set the temperature */
+    out[0] = block->x;                                                                     /* x */
+    out[1] = block->y;                                                                     /* y */
+    out[2] = block->z;                                                                     /* z */
+    s.in = &in[ADXL362_CODEC_HEADER_SIZE];                                                 /* payload */
+    s.size = payload;                                                                      /* payload size */
+    s.pos = 0;                                                                             /* init 0 */
+    s.acc = 0;                                                                             /* init 0 */
+    s.bits = 0;                                                                            /* init 0 */
+    s.error = 0;                                                                           /* init 0 */
+    n = len > 0 ? len - 1 : 0;                                                             /* coded samples */
+    for (a = 0; a < 3; a++)                                                                /* all axes */
+    {
+        if (len == 0)                                                                      /* empty block */
+        {
+            break;                                                                         /* nothing to decode */
+        }
+        v = (int16_t)(uint16_t)(in[10 + a * 2] | (in[11 + a * 2] << 8));                   /* first sample */
+        if ((v < -2048) || (v > 2047))                                                     /* check the first sample */
+        {
+            return 5;                                                                      /* return error */
+        }
+        out[a][0] = (int16_t)v;                                                            /* set the first sample */
+        for (i = 0; i < n; i++)                                                            /* all samples */
+        {
+            if (k[a] == ADXL362_CODEC_PACKED)                                              /* packed */
+            {
+                u = a_adxl362_codec_get(&s, 12);                                           /* 12 bits */
+                v = (int32_t)(u ^ 0x800) - 0x800;                                          /* sign extend */
+            }
+            else                                                                           /* rice */
+            {
+                q = 0;                                                                     /* init 0 */
+                while ((q < ADXL362_CODEC_ESCAPE) && (a_adxl362_codec_get(&s, 1) != 0))    /* unary */
+                {
+                    q++;                                                                   /* add one */
+                }
+                if (q == ADXL362_CODEC_ESCAPE)                                             /* escape */
+                {
+                    u = a_adxl362_codec_get(&s, ADXL362_CODEC_ZIGZAG_BITS);                /* raw zigzag */
+                }
+                else
+                {
+                    u = (q << k[a]) | (k[a] > 0 ? a_adxl362_codec_get(&s, k[a]) : 0);      /* quotient and remainder */
+                }
+                v += (int32_t)(u >> 1) ^ -(int32_t)(u & 1);                                /* undo the zigzag and delta */
+            }
+            if ((v < -2048) || (v > 2047) || (s.error != 0))                               /* check the sample */
+            {
+                return 6;                                                                  /* return error */
+            }
+            out[a][i + 1] = (int16_t)v;                                                    /* set the sample */
+        }
+    }
+    if (s.pos != payload)                                                                  /* check the payload */
+    {
+        return 6;                                                                          /* return error */
+    }
+    *used = ADXL362_CODEC_HEADER_SIZE + payload;                                           /* set the used bytes */
+    handle->blocks++;                                                                      /* add one */
+    handle->raw_bytes += (uint32_t)len * 6;                                                /* fifo bytes */
+    handle->coded_bytes += *used;                                                          /* coded bytes */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief      get the codec totals
+ * @param[in]  *handle pointer to an adxl362 codec handle structure
+ * @param[out] *blocks pointer to a coded blocks buffer
+ * @param[out] *raw_bytes pointer to a fifo bytes buffer
+ * @param[out] *coded_bytes pointer to a coded bytes buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the fifo bytes count 2 bytes per axis sample as read from the chip
+ */
+uint8_t adxl362_codec_get_stats(adxl362_codec_handle_t *handle, uint32_t *blocks, uint32_t *raw_bytes,
+                                uint32_t *coded_bytes)
+{
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    *blocks = handle->blocks;                                                              /* get the blocks */
+    *raw_bytes = handle->raw_bytes;                                                        /* get the fifo bytes */
+    *coded_bytes = handle->coded_bytes;                                                    /* get the coded bytes */
+    
+    return 0;                                                                              /* success return 0 */
+}
@@ -0,0 +1,145 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_codec.h
+ * @brief     driver adxl362 codec header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADXL362_CODEC_H
+#define DRIVER_ADXL362_CODEC_H
+
+#include "driver_adxl362.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup adxl362_codec_driver adxl362 codec driver function
+ * @brief    adxl362 codec driver modules
+ * @ingroup  adxl362_driver
+ * @{
+ */
+
+/**
+ * @brief adxl362 codec size definition
+ */
+#define ADXL362_CODEC_HEADER_SIZE        16                                                                  /**< block header bytes */
+#define ADXL362_CODEC_MAX_SIZE           (ADXL362_CODEC_HEADER_SIZE + (ADXL362_BLOCK_MAX_LEN * 3 * 12 + 7) / 8)        /**< max encoded block bytes */
+
+/**
+ * @brief adxl362 codec handle structure definition
+ * @note  the handle keeps the running totals, every encoded block is self contained
+ */
+typedef struct adxl362_codec_handle_s
+{
+    uint32_t blocks;                                         /**< coded blocks */
+    uint32_t raw_bytes;                                      /**< fifo bytes of the coded blocks */
+    uint32_t coded_bytes;                                    /**< coded bytes */
+    uint16_t zigzag[3][ADXL362_BLOCK_MAX_LEN];               /**< zigzag deltas */
+    uint8_t inited;                                          /**< inited flag */
+} adxl362_codec_handle_t;
+
+/**
+ * @brief     initialize the codec
+ * @param[in] *handle pointer to an adxl362 codec handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      none
+ */
+uint8_t adxl362_codec_init(adxl362_codec_handle_t *handle);
+
+/**
+ * @brief      encode a fifo block
+ * @param[in]  *handle pointer to an adxl362 codec handle structure
+ * @param[in]  *block pointer to a block read by adxl362_read_fifo_block
+ * @param[out] *out pointer to an output buffer
+ * @param[in]  size output buffer size
+ * @param[out] *out_len pointer to an encoded length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 block is NULL or invalid
+ *             - 5 output buffer is too small
+ * @note       each axis is coded as the delta of the previous sample, zigzag mapped and rice coded,
+ *             an axis is bit packed in 12 bits when rice would be larger, a size of
+ *             ADXL362_CODEC_MAX_SIZE always fits
+ */
+uint8_t adxl362_codec_encode_block(adxl362_codec_handle_t *handle, const adxl362_block_t *block,
+                                   uint8_t *out, uint16_t size, uint16_t *out_len);
+
+/**
+ * @brief      decode one encoded block
+ * @param[in]  *handle pointer to an adxl362 codec handle structure
+ * @param[in]  *in pointer to an encoded buffer
+ * @param[in]  size encoded buffer size
+ * @param[out] *block pointer to a block buffer
+ * @param[out] *used pointer to a used bytes buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 a buffer is NULL or the input is shorter than the block
+ *             - 5 header is invalid
+ *             - 6 payload is invalid
+ * @note       used is the size of the decoded block, the next block starts right after it,
+ *             the block has no checksum so the storage or radio layer must provide one
+ */
+uint8_t adxl362_codec_decode_block(adxl362_codec_handle_t *handle, const uint8_t *in, uint16_t size,
+                                   adxl362_block_t *block, uint16_t *used);
+
+/**
+ * @brief      get the codec totals
+ * @param[in]  *handle pointer to an adxl362 codec handle structure
+ * @param[out] *blocks pointer to a coded blocks buffer
+ * @param[out] *raw_bytes pointer to a fifo bytes buffer
+ * @param[out] *coded_bytes pointer to a coded bytes buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the fifo bytes count 2 bytes per axis sample as read from the chip
+ */
+uint8_t adxl362_codec_get_stats(adxl362_codec_handle_t *handle, uint32_t *blocks, uint32_t *raw_bytes,
+                                uint32_t *coded_bytes);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
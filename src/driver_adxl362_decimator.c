@@ -0,0 +1,254 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_decimator.c
+ * @brief     driver adxl362 decimator source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_adxl362_decimator.h"
+#include <string.h>
+
+/**
+ * @brief adxl362 decimator center tap definition
+ */
+#define ADXL362_DECIMATOR_CENTER        ((ADXL362_DECIMATOR_TAPS - 1) / 2)        /**< center tap index */
+
+/**
+ * @brief adxl362 decimator half band coefficients in q15
+ * @note  kaiser windowed sinc with beta 5, the even taps are 0 except the 16384 center tap,
+ *        entry j is the tap at center +- (2j + 1), the sum of all taps is 32768
+ */
+static const int16_t gsc_adxl362_decimator_coeff[(ADXL362_DECIMATOR_TAPS + 1) / 4] =
+{
+    10352, -3216, 1671, -954, 541, -287, 134, -49,
+};
+
+/**
+ * @brief      run one half band stage on one axis
+ * @param[in]  *w pointer to the history followed by the new samples
+ * @param[in]  n new sample number
+ * @param[in]  phase first output position
+ * @param[out] *out pointer to an output buffer
+ * @return     output number
+ * @note       only every second position is computed, which is the polyphase form of the
+ *             decimate by 2 filter, the symmetric taps are folded so one output costs 9 multiplies
+ */
+static uint16_t a_adxl362_decimator_axis(const int16_t *w, uint16_t n, uint8_t phase, int16_t *out)
+{
+    uint16_t i;
+    uint16_t m;
+    uint8_t j;
+    int32_t acc;
+    const int16_t *c;
+    
+    m = 0;                                                                               /* init 0 */
+    for (i = phase; i < n; i += 2)                                                       /* every second sample */
+    {
+        c = &w[i + ADXL362_DECIMATOR_CENTER];                                            /* center of the window */
+        acc = (int32_t)c[0] * 16384 + 16384;                                             /* center tap and rounding */
+        for (j = 0; j < (ADXL362_DECIMATOR_TAPS + 1) / 4; j++)                           /* folded odd taps */
+        {
+            acc += (int32_t)gsc_adxl362_decimator_coeff[j] * 
+                   ((int32_t)c[-(2 * j + 1)] + c[2 * j + 1]);                            /* pair */
+        }
+        acc >>= 15;                                                                      /* back to raw */
+        out[m++] = (int16_t)(acc > 32767 ? 32767 : (acc < -32768 ? -32768 : acc));       /* saturate */
+    }
+    
+    return m;                                                                            /* return the number */
+}
+
+/**
+ * @brief     initialize the decimator
+ * @param[in] *handle pointer to an adxl362 decimator handle structure
+ * @param[in] stages stage number
+ * @param[in] output_mask bit n set emits the stage n output
+ * @param[in] *callback pointer to an output callback function
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 stages is invalid
+ *            - 5 output_mask is invalid
+ * @note      the passband is flat to 0.4 of the output rate and the stopband from 0.6 of the output rate
+ *            is below -52dB, so at 400Hz a 5 stages bank with mask 0x10 gives the 12.5Hz trend stream
+ */
+uint8_t adxl362_decimator_init(adxl362_decimator_handle_t *handle, uint8_t stages, uint8_t output_mask,
+                               void (*callback)(uint8_t stage, const int16_t *x, const int16_t *y,
+                                                const int16_t *z, uint16_t len))
+{
+    if (handle == NULL)                                                                  /* check handle */
+    {
+        return 2;                                                                        /* return error */
+    }
+    if ((stages == 0) || (stages > ADXL362_DECIMATOR_MAX_STAGES))                        /* check the stages */
+    {
+        return 4;                                                                        /* return error */
+    }
+    if ((output_mask == 0) || ((output_mask >> stages) != 0))                            /* check the mask */
+    {
+        return 5;                                                                        /* return error */
+    }
+    
+    handle->receive_callback = callback;                                                 /* set the callback */
+    handle->stages = stages;                                                             /* set the stages */
+    handle->output_mask = output_mask;                                                   /* set the mask */
+    memset(handle->history, 0, sizeof(handle->history));                                 /* clear the history */
+    memset(handle->phase, 0, sizeof(handle->phase));                                     /* clear the phase */
+    handle->inited = 1;                                                                  /* flag finish initialization */
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief     reset the filter history
+ * @param[in] *handle pointer to an adxl362 decimator handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      call it after a range or odr change
+ */
+uint8_t adxl362_decimator_reset(adxl362_decimator_handle_t *handle)
+{
+    if (handle == NULL)                                                                  /* check handle */
+    {
+        return 2;                                                                        /* return error */
+    }
+    if (handle->inited != 1)                                                             /* check handle initialization */
+    {
+        return 3;                                                                        /* return error */
+    }
+    
+    memset(handle->history, 0, sizeof(handle->history));                                 /* clear the history */
+    memset(handle->phase, 0, sizeof(handle->phase));                                     /* clear the phase */
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief     run the decimator
+ * @param[in] *handle pointer to an adxl362 decimator handle structure
+ * @param[in] *x pointer to an x axis raw buffer
+ * @param[in] *y pointer to a y axis raw buffer
+ * @param[in] *z pointer to a z axis raw buffer
+ * @param[in] len buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      every selected stage calls the callback once per processed chunk with its new samples
+ */
+uint8_t adxl362_decimator_process(adxl362_decimator_handle_t *handle, const int16_t *x, const int16_t *y,
+                                  const int16_t *z, uint16_t len)
+{
+    uint8_t s;
+    uint8_t a;
+    uint16_t n;
+    uint16_t m;
+    const int16_t *in[3];
+    
+    if (handle == NULL)                                                                  /* check handle */
+    {
+        return 2;                                                                        /* return error */
+    }
+    if (handle->inited != 1)                                                             /* check handle initialization */
+    {
+        return 3;                                                                        /* return error */
+    }
+    
+    while (len != 0)                                                                     /* run all chunks */
+    {
+        n = len < ADXL362_DECIMATOR_BLOCK ? len : ADXL362_DECIMATOR_BLOCK;               /* chunk length */
+        in[0] = x;                                                                       /* x input */
+        in[1] = y;                                                                       /* y input */
+        in[2] = z;                                                                       /* z input */
+        for (s = 0; s < handle->stages; s++)                                             /* run the stages block by block */
+        {
+            m = 0;                                                                       /* init 0 */
+            for (a = 0; a < 3; a++)                                                      /* run all axes */
+            {
+                memcpy(handle->work[a], handle->history[s][a], 
+                       sizeof(int16_t) * (ADXL362_DECIMATOR_TAPS - 1));                  /* history first */
+                memcpy(&handle->work[a][ADXL362_DECIMATOR_TAPS - 1], in[a], 
+                       sizeof(int16_t) * n);                                             /* then the input */
+                memcpy(handle->history[s][a], &handle->work[a][n], 
+                       sizeof(int16_t) * (ADXL362_DECIMATOR_TAPS - 1));                  /* save the tail */
+                m = a_adxl362_decimator_axis(handle->work[a], n, handle->phase[s], 
+                                             handle->out[a]);                            /* filter and decimate */
+            }
+            handle->phase[s] = (uint8_t)((handle->phase[s] + n) & 0x01);                 /* next output position */
+            if ((m != 0) && (((handle->output_mask >> s) & 0x01) != 0) && 
+                (handle->receive_callback != NULL))                                      /* check the output */
+            {
+                handle->receive_callback(s, handle->out[0], handle->out[1], 
+                                         handle->out[2], m);                             /* run the callback */
+            }
+            if (m == 0)                                                                  /* nothing for the next stage */
+            {
+                break;                                                                   /* stop */
+            }
+            
+            /* the output is the input of the next stage, copied by the memcpy above */
+            in[0] = handle->out[0];                                                      /* x input */
+            in[1] = handle->out[1];                                                      /* y input */
+            in[2] = handle->out[2];                                                      /* z input */
+            n = m;                                                                       /* next length */
+        }
+        x += (len < ADXL362_DECIMATOR_BLOCK ? len : ADXL362_DECIMATOR_BLOCK);            /* next x */
+        y += (len < ADXL362_DECIMATOR_BLOCK ? len : ADXL362_DECIMATOR_BLOCK);            /* next y */
+        z += (len < ADXL362_DECIMATOR_BLOCK ? len : ADXL362_DECIMATOR_BLOCK);            /* next z */
+        len -= (len < ADXL362_DECIMATOR_BLOCK ? len : ADXL362_DECIMATOR_BLOCK);          /* remaining samples */
+    }
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief     run the decimator with a fifo block
+ * @param[in] *handle pointer to an adxl362 decimator handle structure
+ * @param[in] *block pointer to a block read by adxl362_read_fifo_block
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 block is NULL
+ * @note      the output keeps the block range
+ */
+uint8_t adxl362_decimator_process_block(adxl362_decimator_handle_t *handle, const adxl362_block_t *block)
+{
+    if (block == NULL)                                                                   /* check the block */
+    {
+        return 4;                                                                        /* return error */
+    }
+    
+    return adxl362_decimator_process(handle, block->x, block->y, block->z, block->len);        /* process */
+}
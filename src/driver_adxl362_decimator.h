@@ -0,0 +1,143 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_decimator.h
+ * @brief     driver adxl362 decimator header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADXL362_DECIMATOR_H
+#define DRIVER_ADXL362_DECIMATOR_H
+
+#include "driver_adxl362.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup adxl362_decimator_driver adxl362 decimator driver function
+ * @brief    adxl362 decimator driver modules
+ * @ingroup  adxl362_driver
+ * @{
+ */
+
+/**
+ * @brief adxl362 decimator definition
+ */
+#define ADXL362_DECIMATOR_MAX_STAGES        6         /**< 400Hz down to 6.25Hz */
+#define ADXL362_DECIMATOR_TAPS              31        /**< half band filter length */
+#define ADXL362_DECIMATOR_BLOCK             256       /**< samples per processing chunk */
+
+/**
+ * @brief adxl362 decimator handle structure definition
+ * @note  every stage is a half band decimate by 2 filter, stage n outputs odr / 2^(n + 1)
+ */
+typedef struct adxl362_decimator_handle_s
+{
+    void (*receive_callback)(uint8_t stage, const int16_t *x, const int16_t *y,
+                             const int16_t *z, uint16_t len);                           /**< point to a receive_callback function address */
+    int16_t history[ADXL362_DECIMATOR_MAX_STAGES][3][ADXL362_DECIMATOR_TAPS - 1];       /**< filter history of every stage */
+    int16_t work[3][ADXL362_DECIMATOR_TAPS - 1 + ADXL362_DECIMATOR_BLOCK];             /**< history and input of the running stage */
+    int16_t out[3][ADXL362_DECIMATOR_BLOCK / 2 + 1];                                   /**< output of the running stage */
+    uint8_t phase[ADXL362_DECIMATOR_MAX_STAGES];                                        /**< 0 if the next input is an output position */
+    uint8_t stages;                                                                     /**< stage number */
+    uint8_t output_mask;                                                                /**< bit n emits the stage n output */
+    uint8_t inited;                                                                     /**< inited flag */
+} adxl362_decimator_handle_t;
+
+/**
+ * @brief     initialize the decimator
+ * @param[in] *handle pointer to an adxl362 decimator handle structure
+ * @param[in] stages stage number
+ * @param[in] output_mask bit n set emits the stage n output
+ * @param[in] *callback pointer to an output callback function
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 stages is invalid
+ *            - 5 output_mask is invalid
+ * @note      the passband is flat to 0.4 of the output rate and the stopband from 0.6 of the output rate
+ *            is below -52dB, so at 400Hz a 5 stages bank with mask 0x10 gives the 12.5Hz trend stream
+ */
+uint8_t adxl362_decimator_init(adxl362_decimator_handle_t *handle, uint8_t stages, uint8_t output_mask,
+                               void (*callback)(uint8_t stage, const int16_t *x, const int16_t *y,
+                                                const int16_t *z, uint16_t len));
+
+/**
+ * @brief     run the decimator
+ * @param[in] *handle pointer to an adxl362 decimator handle structure
+ * @param[in] *x pointer to an x axis raw buffer
+ * @param[in] *y pointer to a y axis raw buffer
+ * @param[in] *z pointer to a z axis raw buffer
+ * @param[in] len buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      every selected stage calls the callback once per processed chunk with its new samples
+ */
+uint8_t adxl362_decimator_process(adxl362_decimator_handle_t *handle, const int16_t *x, const int16_t *y,
+                                  const int16_t *z, uint16_t len);
+
+/**
+ * @brief     run the decimator with a fifo block
+ * @param[in] *handle pointer to an adxl362 decimator handle structure
+ * @param[in] *block pointer to a block read by adxl362_read_fifo_block
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 block is NULL
+ * @note      the output keeps the block range
+ */
+uint8_t adxl362_decimator_process_block(adxl362_decimator_handle_t *handle, const adxl362_block_t *block);
+
+/**
+ * @brief     reset the filter history
+ * @param[in] *handle pointer to an adxl362 decimator handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      call it after a range or odr change
+ */
+uint8_t adxl362_decimator_reset(adxl362_decimator_handle_t *handle);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
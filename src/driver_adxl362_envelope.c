@@ -0,0 +1,514 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_envelope.c
+ * @brief     driver adxl362 envelope source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_adxl362_envelope.h"
+#include <math.h>
+#include <string.h>
+
+/**
+ * @brief pi definition
+ */
+#define ADXL362_ENVELOPE_PI        3.14159265358979323846        /**< pi */
+
+/**
+ * @brief adxl362 envelope g per lsb table
+ */
+static const float gsc_adxl362_envelope_scale[3] =
+{
+    1.0f / 1000.0f,        /**< 2g */
+    1.0f / 500.0f,         /**< 4g */
+    1.0f / 250.0f,         /**< 8g */
+};
+
+/**
+ * @brief     check the pipeline parameters
+ * @param[in] odr output data rate in Hz
+ * @param[in] band_low band pass low edge in Hz
+ * @param[in] band_high band pass high edge in Hz
+ * @param[in] envelope_hz envelope low pass cutoff in Hz
+ * @param[in] decimation envelope decimation
+ * @return    status code
+ *            - 0 success
+ *            - 5 decimation is invalid
+ *            - 6 band is invalid
+ *            - 7 envelope cutoff is invalid
+ * @note      none
+ */
+static uint8_t a_adxl362_envelope_check(float odr, float band_low, float band_high, float envelope_hz, uint8_t decimation)
+{
+    if ((decimation == 0) || (decimation > ADXL362_ENVELOPE_MAX_DECIMATION))              /* check the decimation */
+    {
+        return 5;                                                                          /* return error */
+    }
+    if ((band_low <= 0.0f) || (band_high <= band_low) || (band_high >= odr * 0.5f))        /* check the band */
+    {
+        return 6;                                                                          /* return error */
+    }
+    if ((envelope_hz <= 0.0f) || (envelope_hz >= odr * 0.5f / (float)decimation))          /* check the envelope */
+    {
+        return 7;                                                                          /* return error */
+    }
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief      design a butterworth biquad
+ * @param[in]  fc cutoff frequency in Hz
+ * @param[in]  odr output data rate in Hz
+ * @param[in]  high_pass 1 for a high pass, 0 for a low pass
+ * @param[out] *c pointer to a b0, b1, b2, a1, a2 buffer
+ * @note       bilinear transform with q = 1 / sqrt(2)
+ */
+static void a_adxl362_envelope_design(double fc, double odr, uint8_t high_pass, double c[5])
+{
+    double w;
+    double cs;
+    double alpha;
+    double a0;
+    
+    w = 2.0 * ADXL362_ENVELOPE_PI * fc / odr;                                              /* normalized frequency */
+    cs = cos(w);                                                                           /* cos */
+    alpha = sin(w) / (2.0 * 0.70710678118654752);                                          /* bandwidth term */
+    a0 = 1.0 + alpha;                                                                      /* normalization */
+    if (high_pass != 0)                                                                    /* high pass */
+    {
+        c[0] = (1.0 + cs) * 0.5 / a0;                                                      /* b0 */
+        c[1] = -(1.0 + cs) / a0;                                                           /* b1 */
+    }
+    else                                                                                   /* low pass */
+    {
+        c[0] = (1.0 - cs) * 0.5 / a0;                                                      /* b0 */
+        c[1] = (1.0 - cs) / a0;                                                            /* b1 */
+    }
+    c[2] = c[0];                                                                           /* b2 */
+    c[3] = -2.0 * cs / a0;                                                                 /* a1 */
+    c[4] = (1.0 - alpha) / a0;                                                             /* a2 */
+}
+
+/**
+ * @brief         run one float biquad
+ * @param[in]     *c pointer to the coefficients
+ * @param[in,out] *s pointer to the states
+ * @param[in]     x input sample
+ * @return        output sample
+ * @note          transposed direct form 2
+ */
+static inline float a_adxl362_envelope_biquad(const float *c, float *s, float x)
+{
+    float y;
+    
+    y = c[0] * x + s[0];                                                                   /* output */
+    s[0] = c[1] * x - c[3] * y + s[1];                                                     /* first state */
+    s[1] = c[2] * x - c[4] * y;                                                            /* second state */
+    
+    return y;                                                                              /* return the output */
+}
+
+/**
+ * @brief         run one q14 biquad
+ * @param[in]     *c pointer to the q14 coefficients
+ * @param[in,out] *s pointer to the x1, x2, y1, y2 states
+ * @param[in]     x input sample
+ * @return        output sample
+ * @note          direct form 1 with a 64 bits accumulator, it cannot overflow
+ */
+static inline int32_t a_adxl362_envelope_biquad_q14(const int32_t *c, int32_t *s, int32_t x)
+{
+    int64_t acc;
+    int32_t y;
+    
+    acc = (int64_t)c[0] * x + (int64_t)c[1] * s[0] + (int64_t)c[2] * s[1] - 
+          (int64_t)c[3] * s[2] - (int64_t)c[4] * s[3];                                     /* accumulate */
+    y = (int32_t)((acc + (1 << 13)) >> 14);                                                /* round to the sample */
+    s[1] = s[0];                                                                           /* shift x */
+    s[0] = x;                                                                              /* save x */
+    s[3] = s[2];                                                                           /* shift y */
+    s[2] = y;                                                                              /* save y */
+    
+    return y;                                                                              /* return the output */
+}
+
+/**
+ * @brief     initialize the float envelope pipeline
+ * @param[in] *handle pointer to an adxl362 envelope handle structure
+ * @param[in] *fft pointer to an initialized fft handle of the envelope rate
+ * @param[in] odr output data rate in Hz
+ * @param[in] band_low band pass low edge in Hz
+ * @param[in] band_high band pass high edge in Hz
+ * @param[in] envelope_hz envelope low pass cutoff in Hz
+ * @param[in] decimation envelope decimation
+ * @param[in] *callback pointer to an envelope spectrum callback function
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 fft is invalid
+ *            - 5 decimation is invalid
+ *            - 6 band is invalid
+ *            - 7 envelope cutoff is invalid
+ * @note      the fft runs at odr / decimation, 0 < band_low < band_high < odr / 2,
+ *            0 < envelope_hz < odr / (2 * decimation), 0 < decimation <= 16
+ */
+uint8_t adxl362_envelope_init(adxl362_envelope_handle_t *handle, adxl362_fft_handle_t *fft, float odr,
+                              float band_low, float band_high, float envelope_hz, uint8_t decimation,
+                              void (*callback)(const float *spectrum, uint16_t len))
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t j;
+    double c[3][5];
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if ((fft == NULL) || (fft->inited != 1))                                               /* check the fft */
+    {
+        return 4;                                                                          /* return error */
+    }
+    res = a_adxl362_envelope_check(odr, band_low, band_high, envelope_hz, decimation);    /* check the parameters */
+    if (res != 0)                                                                          /* check the result */
+    {
+        return res;                                                                        /* return error */
+    }
+    if (fabsf(fft->odr * (float)decimation - odr) > odr * 0.001f)                          /* check the fft rate */
+    {
+        return 4;                                                                          /* return error */
+    }
+    
+    memset(handle, 0, sizeof(adxl362_envelope_handle_t));                                  /* clear the handle */
+    a_adxl362_envelope_design(band_low, odr, 1, c[0]);                                     /* band high pass */
+    a_adxl362_envelope_design(band_high, odr, 0, c[1]);                                    /* band low pass */
+    a_adxl362_envelope_design(envelope_hz, odr, 0, c[2]);                                  /* envelope low pass */
+    for (i = 0; i < 3; i++)                                                                /* all biquads */
+    {
+        for (j = 0; j < 5; j++)                                                            /* all coefficients */
+        {
+            handle->coefficient[i][j] = (float)c[i][j];                                    /* set the coefficient */
+        }
+    }
+    handle->receive_callback = callback;                                                   /* set the callback */
+    handle->fft = fft;                                                                     /* set the fft */
+    handle->decimation = decimation;                                                       /* set the decimation */
+    handle->inited = 1;                                                                    /* flag finish initialization */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief         run the envelope pipeline in place
+ * @param[in]     *handle pointer to an adxl362 envelope handle structure
+ * @param[in,out] *buf pointer to a decoded sample buffer of one axis
+ * @param[in]     len buffer length
+ * @return        status code
+ *                - 0 success
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ * @note          buf is replaced by the full rate envelope, the callback runs with the
+ *                envelope spectrum every time a frame of the fft length is complete
+ */
+uint8_t adxl362_envelope_process(adxl362_envelope_handle_t *handle, float *buf, uint16_t len)
+{
+    uint16_t i;
+    float v;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    for (i = 0; i < len; i++)                                                              /* all samples */
+    {
+        v = a_adxl362_envelope_biquad(handle->coefficient[0], handle->state[0], buf[i]);   /* band high pass */
+        v = a_adxl362_envelope_biquad(handle->coefficient[1], handle->state[1], v);        /* band low pass */
+        v = fabsf(v);                                                                      /* full wave rectify */
+        v = a_adxl362_envelope_biquad(handle->coefficient[2], handle->state[2], v);        /* envelope low pass */
+        buf[i] = v;                                                                        /* save the envelope */
+        handle->phase++;                                                                   /* next phase */
+        if (handle->phase < handle->decimation)                                            /* check the phase */
+        {
+            continue;                                                                      /* next sample */
+        }
+        handle->phase = 0;                                                                 /* reset the phase */
+        handle->frame[handle->count] = v;                                                  /* save to the frame */
+        handle->count++;                                                                   /* add one */
+        if (handle->count < handle->fft->len)                                              /* check the frame */
+        {
+            continue;                                                                      /* next sample */
+        }
+        handle->count = 0;                                                                 /* next frame */
+        
+        /* the envelope mean is the rectified band energy, remove it before the transform */
+        (void)adxl362_fft_load_float(handle->fft, handle->frame, ADXL362_BOOL_TRUE, handle->frame);      /* window */
+        (void)adxl362_fft_forward(handle->fft, handle->frame);                                           /* transform */
+        (void)adxl362_fft_magnitude(handle->fft, handle->frame, handle->spectrum);                       /* amplitude */
+        if (handle->receive_callback != NULL)                                              /* check the callback */
+        {
+            handle->receive_callback(handle->spectrum, handle->fft->len / 2 + 1);          /* run the callback */
+        }
+    }
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief      decode raw data and run the envelope pipeline
+ * @param[in]  *handle pointer to an adxl362 envelope handle structure
+ * @param[in]  *in pointer to a raw buffer of one axis
+ * @param[in]  len buffer length
+ * @param[in]  range range of the raw data
+ * @param[out] *buf pointer to a len envelope buffer in g
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 range is invalid
+ * @note       none
+ */
+uint8_t adxl362_envelope_process_raw(adxl362_envelope_handle_t *handle, const int16_t *in, uint16_t len,
+                                     adxl362_range_t range, float *buf)
+{
+    uint16_t i;
+    float scale;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    if ((uint8_t)range > (uint8_t)ADXL362_RANGE_8G)                                        /* check the range */
+    {
+        return 4;                                                                          /* return error */
+    }
+    
+    scale = gsc_adxl362_envelope_scale[range];                                             /* g per lsb */
+    for (i = 0; i < len; i++)                                                              /* all samples */
+    {
+        buf[i] = (float)in[i] * scale;                                                     /* decode */
+    }
+    
+    return adxl362_envelope_process(handle, buf, len);                                     /* run in place */
+}
+
+/**
+ * @brief     reset the envelope pipeline
+ * @param[in] *handle pointer to an adxl362 envelope handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t adxl362_envelope_reset(adxl362_envelope_handle_t *handle)
+{
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    memset(handle->state, 0, sizeof(handle->state));                                       /* clear the states */
+    handle->phase = 0;                                                                     /* clear the phase */
+    handle->count = 0;                                                                     /* clear the frame */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     initialize the q15 envelope pipeline
+ * @param[in] *handle pointer to an adxl362 envelope q15 handle structure
+ * @param[in] *fft pointer to an initialized q15 fft handle
+ * @param[in] odr output data rate in Hz
+ * @param[in] band_low band pass low edge in Hz
+ * @param[in] band_high band pass high edge in Hz
+ * @param[in] envelope_hz envelope low pass cutoff in Hz
+ * @param[in] decimation envelope decimation
+ * @param[in] *callback pointer to an envelope spectrum callback function
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 fft is invalid
+ *            - 5 decimation is invalid
+ *            - 6 band is invalid
+ *            - 7 envelope cutoff is invalid
+ * @note      the same limits as adxl362_envelope_init, the coefficients are built with float
+ *            math once, the pipeline itself is integer only
+ */
+uint8_t adxl362_envelope_q15_init(adxl362_envelope_q15_handle_t *handle, adxl362_fft_q15_handle_t *fft, float odr,
+                                  float band_low, float band_high, float envelope_hz, uint8_t decimation,
+                                  void (*callback)(const uint16_t *spectrum, uint16_t len))
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t j;
+    double c[3][5];
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if ((fft == NULL) || (fft->inited != 1))                                               /* check the fft */
+    {
+        return 4;                                                                          /* return error */
+    }
+    res = a_adxl362_envelope_check(odr, band_low, band_high, envelope_hz, decimation);    /* check the parameters */
+    if (res != 0)                                                                          /* check the result */
+    {
+        return res;                                                                        /* return error */
+    }
+    if (fabsf(fft->odr * (float)decimation - odr) > odr * 0.001f)                          /* check the fft rate */
+    {
+        return 4;                                                                          /* return error */
+    }
+    
+    memset(handle, 0, sizeof(adxl362_envelope_q15_handle_t));                              /* clear the handle */
+    a_adxl362_envelope_design(band_low, odr, 1, c[0]);                                     /* band high pass */
+    a_adxl362_envelope_design(band_high, odr, 0, c[1]);                                    /* band low pass */
+    a_adxl362_envelope_design(envelope_hz, odr, 0, c[2]);                                  /* envelope low pass */
+    for (i = 0; i < 3; i++)                                                                /* all biquads */
+    {
+        for (j = 0; j < 5; j++)                                                            /* all coefficients */
+        {
+            handle->coefficient[i][j] = (int32_t)floor(c[i][j] * 16384.0 + 0.5);           /* q14 */
+        }
+    }
+    handle->receive_callback = callback;                                                   /* set the callback */
+    handle->fft = fft;                                                                     /* set the fft */
+    handle->decimation = decimation;                                                       /* set the decimation */
+    handle->inited = 1;                                                                    /* flag finish initialization */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief         run the q15 envelope pipeline in place
+ * @param[in]     *handle pointer to an adxl362 envelope q15 handle structure
+ * @param[in,out] *buf pointer to a raw buffer of one axis
+ * @param[in]     len buffer length
+ * @return        status code
+ *                - 0 success
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ * @note          buf is replaced by the full rate envelope in raw lsb, the spectrum is in raw lsb / 4
+ *                like adxl362_fft_q15_magnitude, keep the range fixed while it runs
+ */
+uint8_t adxl362_envelope_q15_process(adxl362_envelope_q15_handle_t *handle, int16_t *buf, uint16_t len)
+{
+    uint16_t i;
+    int32_t v;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    for (i = 0; i < len; i++)                                                              /* all samples */
+    {
+        v = (int32_t)buf[i] * 4;                                                           /* use the headroom */
+        v = a_adxl362_envelope_biquad_q14(handle->coefficient[0], handle->state[0], v);    /* band high pass */
+        v = a_adxl362_envelope_biquad_q14(handle->coefficient[1], handle->state[1], v);    /* band low pass */
+        v = v < 0 ? -v : v;                                                                /* full wave rectify */
+        v = a_adxl362_envelope_biquad_q14(handle->coefficient[2], handle->state[2], v);    /* envelope low pass */
+        v = (v + 2) >> 2;                                                                  /* back to raw lsb */
+        v = v > 32767 ? 32767 : (v < -32768 ? -32768 : v);                                 /* saturate */
+        buf[i] = (int16_t)v;                                                               /* save the envelope */
+        handle->phase++;                                                                   /* next phase */
+        if (handle->phase < handle->decimation)                                            /* check the phase */
+        {
+            continue;                                                                      /* next sample */
+        }
+        handle->phase = 0;                                                                 /* reset the phase */
+        handle->frame[handle->count] = (int16_t)v;                                         /* save to the frame */
+        handle->count++;                                                                   /* add one */
+        if (handle->count < handle->fft->len)                                              /* check the frame */
+        {
+            continue;                                                                      /* next sample */
+        }
+        handle->count = 0;                                                                 /* next frame */
+        
+        /* the envelope mean is the rectified band energy, remove it before the transform */
+        (void)adxl362_fft_q15_load_raw(handle->fft, handle->frame, ADXL362_BOOL_TRUE, handle->frame);    /* window */
+        (void)adxl362_fft_q15_forward(handle->fft, handle->frame);                                       /* transform */
+        (void)adxl362_fft_q15_magnitude(handle->fft, handle->frame, handle->spectrum);                   /* amplitude */
+        if (handle->receive_callback != NULL)                                              /* check the callback */
+        {
+            handle->receive_callback(handle->spectrum, handle->fft->len / 2 + 1);          /* run the callback */
+        }
+    }
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     reset the q15 envelope pipeline
+ * @param[in] *handle pointer to an adxl362 envelope q15 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t adxl362_envelope_q15_reset(adxl362_envelope_q15_handle_t *handle)
+{
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    memset(handle->state, 0, sizeof(handle->state));                                       /* clear the states */
+    handle->phase = 0;                                                                     /* clear the phase */
+    handle->count = 0;                                                                     /* clear the frame */
+    
+    return 0;                                                                              /* success return 0 */
+}
@@ -0,0 +1,218 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_envelope.h
+ * @brief     driver adxl362 envelope header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADXL362_ENVELOPE_H
+#define DRIVER_ADXL362_ENVELOPE_H
+
+#include "driver_adxl362_fft.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup adxl362_envelope_driver adxl362 envelope driver function
+ * @brief    adxl362 envelope driver modules
+ * @ingroup  adxl362_driver
+ * @{
+ */
+
+/**
+ * @brief adxl362 envelope definition
+ */
+#define ADXL362_ENVELOPE_MAX_DECIMATION        16        /**< max envelope decimation */
+
+/**
+ * @brief adxl362 envelope handle structure definition
+ * @note  the band pass is a butterworth high pass and low pass pair, the envelope low pass is a
+ *        butterworth biquad, all three run in one pass over the samples
+ */
+typedef struct adxl362_envelope_handle_s
+{
+    void (*receive_callback)(const float *spectrum, uint16_t len);        /**< point to an envelope spectrum callback function address */
+    adxl362_fft_handle_t *fft;                                            /**< envelope spectrum fft */
+    float coefficient[3][5];                                              /**< b0, b1, b2, a1, a2 of each biquad */
+    float state[3][2];                                                    /**< transposed direct form 2 states */
+    uint8_t decimation;                                                   /**< envelope decimation */
+    uint8_t phase;                                                        /**< decimation phase */
+    uint16_t count;                                                       /**< envelope samples in the frame */
+    float frame[ADXL362_FFT_MAX_LEN];                                     /**< envelope frame */
+    float spectrum[ADXL362_FFT_MAX_LEN / 2 + 1];                          /**< envelope amplitude spectrum */
+    uint8_t inited;                                                       /**< inited flag */
+} adxl362_envelope_handle_t;
+
+/**
+ * @brief adxl362 envelope q15 handle structure definition
+ * @note  the coefficients are q14 and the samples are raw lsb * 4 like the q15 fft
+ */
+typedef struct adxl362_envelope_q15_handle_s
+{
+    void (*receive_callback)(const uint16_t *spectrum, uint16_t len);     /**< point to an envelope spectrum callback function address */
+    adxl362_fft_q15_handle_t *fft;                                        /**< envelope spectrum fft */
+    int32_t coefficient[3][5];                                            /**< b0, b1, b2, a1, a2 of each biquad in q14 */
+    int32_t state[3][4];                                                  /**< x1, x2, y1, y2 of each biquad */
+    uint8_t decimation;                                                   /**< envelope decimation */
+    uint8_t phase;                                                        /**< decimation phase */
+    uint16_t count;                                                       /**< envelope samples in the frame */
+    int16_t frame[ADXL362_FFT_MAX_LEN];                                   /**< envelope frame in raw lsb */
+    uint16_t spectrum[ADXL362_FFT_MAX_LEN / 2 + 1];                       /**< envelope amplitude spectrum */
+    uint8_t inited;                                                       /**< inited flag */
+} adxl362_envelope_q15_handle_t;
+
+/**
+ * @brief     initialize the float envelope pipeline
+ * @param[in] *handle pointer to an adxl362 envelope handle structure
+ * @param[in] *fft pointer to an initialized fft handle of the envelope rate
+ * @param[in] odr output data rate in Hz
+ * @param[in] band_low band pass low edge in Hz
+ * @param[in] band_high band pass high edge in Hz
+ * @param[in] envelope_hz envelope low pass cutoff in Hz
+ * @param[in] decimation envelope decimation
+ * @param[in] *callback pointer to an envelope spectrum callback function
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 fft is invalid
+ *            - 5 decimation is invalid
+ *            - 6 band is invalid
+ *            - 7 envelope cutoff is invalid
+ * @note      the fft runs at odr / decimation, 0 < band_low < band_high < odr / 2,
+ *            0 < envelope_hz < odr / (2 * decimation), 0 < decimation <= 16
+ */
+uint8_t adxl362_envelope_init(adxl362_envelope_handle_t *handle, adxl362_fft_handle_t *fft, float odr,
+                              float band_low, float band_high, float envelope_hz, uint8_t decimation,
+                              void (*callback)(const float *spectrum, uint16_t len));
+
+/**
+ * @brief         run the envelope pipeline in place
+ * @param[in]     *handle pointer to an adxl362 envelope handle structure
+ * @param[in,out] *buf pointer to a decoded sample buffer of one axis
+ * @param[in]     len buffer length
+ * @return        status code
+ *                - 0 success
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ * @note          buf is replaced by the full rate envelope, the callback runs with the
+ *                envelope spectrum every time a frame of the fft length is complete
+ */
+uint8_t adxl362_envelope_process(adxl362_envelope_handle_t *handle, float *buf, uint16_t len);
+
+/**
+ * @brief      decode raw data and run the envelope pipeline
+ * @param[in]  *handle pointer to an adxl362 envelope handle structure
+ * @param[in]  *in pointer to a raw buffer of one axis
+ * @param[in]  len buffer length
+ * @param[in]  range range of the raw data
+ * @param[out] *buf pointer to a len envelope buffer in g
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 range is invalid
+ * @note       none
+ */
+uint8_t adxl362_envelope_process_raw(adxl362_envelope_handle_t *handle, const int16_t *in, uint16_t len,
+                                     adxl362_range_t range, float *buf);
+
+/**
+ * @brief     reset the envelope pipeline
+ * @param[in] *handle pointer to an adxl362 envelope handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t adxl362_envelope_reset(adxl362_envelope_handle_t *handle);
+
+/**
+ * @brief     initialize the q15 envelope pipeline
+ * @param[in] *handle pointer to an adxl362 envelope q15 handle structure
+ * @param[in] *fft pointer to an initialized q15 fft handle
+ * @param[in] odr output data rate in Hz
+ * @param[in] band_low band pass low edge in Hz
+ * @param[in] band_high band pass high edge in Hz
+ * @param[in] envelope_hz envelope low pass cutoff in Hz
+ * @param[in] decimation envelope decimation
+ * @param[in] *callback pointer to an envelope spectrum callback function
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 fft is invalid
+ *            - 5 decimation is invalid
+ *            - 6 band is invalid
+ *            - 7 envelope cutoff is invalid
+ * @note      the same limits as adxl362_envelope_init, the coefficients are built with float
+ *            math once, the pipeline itself is integer only
+ */
+uint8_t adxl362_envelope_q15_init(adxl362_envelope_q15_handle_t *handle, adxl362_fft_q15_handle_t *fft, float odr,
+                                  float band_low, float band_high, float envelope_hz, uint8_t decimation,
+                                  void (*callback)(const uint16_t *spectrum, uint16_t len));
+
+/**
+ * @brief         run the q15 envelope pipeline in place
+ * @param[in]     *handle pointer to an adxl362 envelope q15 handle structure
+ * @param[in,out] *buf pointer to a raw buffer of one axis
+ * @param[in]     len buffer length
+ * @return        status code
+ *                - 0 success
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ * @note          buf is replaced by the full rate envelope in raw lsb, the spectrum is in raw lsb / 4
+ *                like adxl362_fft_q15_magnitude, keep the range fixed while it runs
+ */
+uint8_t adxl362_envelope_q15_process(adxl362_envelope_q15_handle_t *handle, int16_t *buf, uint16_t len);
+
+/**
+ * @brief     reset the q15 envelope pipeline
+ * @param[in] *handle pointer to an adxl362 envelope q15 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t adxl362_envelope_q15_reset(adxl362_envelope_q15_handle_t *handle);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
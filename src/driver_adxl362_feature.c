@@ -0,0 +1,327 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_feature.c
+ * @brief     driver adxl362 feature source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_adxl362_feature.h"
+#include <math.h>
+#include <string.h>
+
+/**
+ * @brief adxl362 feature sums structure definition
+ */
+typedef struct adxl362_feature_sums_s
+{
+    int64_t abs;             /**< sum of |x * n - sum| */
+    int64_t c3;              /**< sum of c^3 */
+    uint64_t c4;             /**< sum of c^4 */
+    int64_t c2;              /**< sum of c^2 */
+    int64_t square;          /**< sum of x^2 */
+    int32_t peak;            /**< max of |x * n - sum| */
+    int32_t crossing;        /**< mean crossings */
+} adxl362_feature_sums_t;
+
+/**
+ * @brief      accumulate one channel of a window
+ * @param[in]  *v pointer to a contiguous window in mg
+ * @param[in]  n window length
+ * @param[in]  sum sum of the window
+ * @param[in]  m rounded mean of the window
+ * @param[out] *s pointer to a sums buffer
+ * @note       one fused integer pass, x * n - sum is the deviation from the exact mean
+ *             scaled by n and c = x - m keeps the powers small
+ */
+static void a_adxl362_feature_sums(const int16_t *v, uint16_t n, int32_t sum, int32_t m, adxl362_feature_sums_t *s)
+{
+    uint16_t i;
+    int32_t d;
+    int32_t p;
+    int32_t a;
+    int32_t c;
+    int32_t c2;
+    int64_t abs_sum;
+    int64_t c2_sum;
+    int64_t c3_sum;
+    uint64_t c4_sum;
+    int64_t square;
+    int32_t peak;
+    int32_t crossing;
+    
+    d = (int32_t)v[0] * n - sum;                                                           /* first deviation */
+    c = (int32_t)v[0] - m;                                                                 /* first centered */
+    peak = d < 0 ? -d : d;                                                                 /* init the peak */
+    abs_sum = peak;                                                                        /* init the sum */
+    c2_sum = c * c;                                                                        /* init the sum */
+    c3_sum = (int64_t)c * c * c;                                                           /* init the sum */
+    c4_sum = (uint64_t)((int64_t)c * c) * (uint64_t)((int64_t)c * c);                      /* init the sum */
+    square = (int32_t)v[0] * v[0];                                                         /* init the sum */
+    crossing = 0;                                                                          /* init 0 */
+    for (i = 1; i < n; i++)                                                                /* all samples */
+    {
+        d = (int32_t)v[i] * n - sum;                                                       /* deviation * n */
+        p = (int32_t)v[i - 1] * n - sum;                                                   /* previous deviation * n */
+        a = d < 0 ? -d : d;                                                                /* abs */
+        peak = a > peak ? a : peak;                                                        /* peak */
+        abs_sum += a;                                                                      /* mad sum */
+        crossing += (int32_t)(((uint32_t)(d ^ p)) >> 31);                                  /* sign change */
+        c = (int32_t)v[i] - m;                                                             /* centered */
+        c2 = c * c;                                                                        /* c^2 */
+        c2_sum += c2;                                                                      /* c^2 sum */
+        c3_sum += (int64_t)c2 * c;                                                         /* c^3 sum */
+        c4_sum += (uint64_t)c2 * (uint64_t)c2;                                             /* c^4 sum */
+        square += (int32_t)v[i] * v[i];                                                    /* x^2 sum */
+    }
+    s->abs = abs_sum;                                                                      /* set the sum */
+    s->c2 = c2_sum;                                                                        /* set the sum */
+    s->c3 = c3_sum;                                                                        /* set the sum */
+    s->c4 = c4_sum;                                                                        /* set the sum */
+    s->square = square;                                                                    /* set the sum */
+    s->peak = peak;                                                                        /* set the peak */
+    s->crossing = crossing;                                                                /* set the crossings */
+}
+
+/**
+ * @brief     make the features of the current window
+ * @param[in] *handle pointer to an adxl362 feature handle structure
+ * @note      the mean comes from the running sum, so each channel needs one pass
+ */
+static void a_adxl362_feature_emit(adxl362_feature_handle_t *handle)
+{
+    uint8_t ch;
+    int32_t m;
+    int32_t sum;
+    double n;
+    double e1;
+    double e2;
+    double e3;
+    double e4;
+    double m2;
+    double m3;
+    double m4;
+    adxl362_feature_sums_t s;
+    adxl362_feature_t *f;
+    
+    f = &handle->feature;                                                                  /* feature buffer */
+    n = (double)handle->window;                                                            /* window length */
+    for (ch = 0; ch < 4; ch++)                                                             /* all channels */
+    {
+        sum = handle->sum[ch];                                                             /* window sum */
+        m = (sum >= 0) ? (sum + handle->window / 2) / handle->window : 
+                         -((-sum + handle->window / 2) / handle->window);                  /* rounded mean */
+        a_adxl362_feature_sums(&handle->ring[ch][handle->pos], handle->window, sum, m, &s);          /* one pass */
+        
+        /* central moments from the moments around the rounded mean */
+        e1 = (double)sum / n - (double)m;                                                  /* mean offset */
+        e2 = (double)s.c2 / n;                                                             /* second moment */
+        e3 = (double)s.c3 / n;                                                             /* third moment */
+        e4 = (double)s.c4 / n;                                                             /* fourth moment */
+        m2 = e2 - e1 * e1;                                                                 /* variance */
+        m3 = e3 - 3.0 * e1 * e2 + 2.0 * e1 * e1 * e1;                                      /* third central */
+        m4 = e4 - 4.0 * e1 * e3 + 6.0 * e1 * e1 * e2 - 3.0 * e1 * e1 * e1 * e1;           /* fourth central */
+        f->mean[ch] = (float)((double)sum / n / 1000.0);                                   /* mean in g */
+        f->zero_crossing[ch] = (float)s.crossing / (float)(handle->window - 1);            /* crossing rate */
+        f->energy[ch] = (float)((double)s.square / n / 1000000.0);                         /* mean square in g^2 */
+        f->mad[ch] = (float)((double)s.abs / (n * n) / 1000.0);                            /* mad in g */
+        if (m2 > 1e-9)                                                                     /* check the variance */
+        {
+            f->skewness[ch] = (float)(m3 / (m2 * sqrt(m2)));                               /* skewness */
+            f->kurtosis[ch] = (float)(m4 / (m2 * m2));                                     /* kurtosis */
+            f->crest[ch] = (float)((double)s.peak / n / sqrt(m2));                         /* crest factor */
+        }
+        else                                                                               /* constant window */
+        {
+            f->skewness[ch] = 0.0f;                                                        /* no skewness */
+            f->kurtosis[ch] = 0.0f;                                                        /* no kurtosis */
+            f->crest[ch] = 0.0f;                                                           /* no crest */
+        }
+    }
+    f->index = handle->index;                                                              /* set the index */
+    f->window = handle->window;                                                            /* set the window */
+    handle->index++;                                                                       /* next window */
+    if (handle->receive_callback != NULL)                                                  /* check the callback */
+    {
+        handle->receive_callback(f);                                                       /* run the callback */
+    }
+}
+
+/**
+ * @brief     initialize the feature extractor
+ * @param[in] *handle pointer to an adxl362 feature handle structure
+ * @param[in] window samples per window
+ * @param[in] hop samples between windows
+ * @param[in] *callback pointer to a feature callback function
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 window is invalid
+ *            - 5 hop is invalid
+ * @note      2 <= window <= 512, 0 < hop <= window
+ */
+uint8_t adxl362_feature_init(adxl362_feature_handle_t *handle, uint16_t window, uint16_t hop,
+                             void (*callback)(const adxl362_feature_t *feature))
+{
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if ((window < 2) || (window > ADXL362_FEATURE_MAX_WINDOW))                             /* check the window */
+    {
+        return 4;                                                                          /* return error */
+    }
+    if ((hop == 0) || (hop > window))                                                      /* check the hop */
+    {
+        return 5;                                                                          /* return error */
+    }
+    
+    memset(handle, 0, sizeof(adxl362_feature_handle_t));                                   /* clear the handle */
+    handle->receive_callback = callback;                                                   /* set the callback */
+    handle->window = window;                                                               /* set the window */
+    handle->hop = hop;                                                                     /* set the hop */
+    handle->inited = 1;                                                                    /* flag finish initialization */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     update the feature extractor with raw samples
+ * @param[in] *handle pointer to an adxl362 feature handle structure
+ * @param[in] *x pointer to an x axis raw buffer
+ * @param[in] *y pointer to a y axis raw buffer
+ * @param[in] *z pointer to a z axis raw buffer
+ * @param[in] len buffer length
+ * @param[in] range range of the raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the callback runs every hop samples once the first window is full
+ */
+uint8_t adxl362_feature_update(adxl362_feature_handle_t *handle, const int16_t *x, const int16_t *y,
+                               const int16_t *z, uint16_t len, adxl362_range_t range)
+{
+    uint16_t i;
+    uint16_t pos;
+    uint8_t ch;
+    int32_t v[4];
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    for (i = 0; i < len; i++)                                                              /* all samples */
+    {
+        v[0] = (int32_t)x[i] * (1 << (uint8_t)range);                                      /* x in mg */
+        v[1] = (int32_t)y[i] * (1 << (uint8_t)range);                                      /* y in mg */
+        v[2] = (int32_t)z[i] * (1 << (uint8_t)range);                                      /* z in mg */
+        v[3] = (int32_t)(sqrtf((float)(v[0] * v[0] + v[1] * v[1] + v[2] * v[2])) + 0.5f); /* magnitude in mg */
+        pos = handle->pos;                                                                 /* write position */
+        for (ch = 0; ch < 4; ch++)                                                         /* all channels */
+        {
+            if (handle->filled == handle->window)                                          /* ring is full */
+            {
+                handle->sum[ch] -= handle->ring[ch][pos];                                  /* drop the oldest */
+            }
+            handle->sum[ch] += v[ch];                                                      /* add the newest */
+            handle->ring[ch][pos] = (int16_t)v[ch];                                        /* write */
+            handle->ring[ch][pos + handle->window] = (int16_t)v[ch];                       /* write the mirror */
+        }
+        handle->pos = (pos + 1 == handle->window) ? 0 : pos + 1;                           /* next position */
+        if (handle->filled < handle->window)                                               /* check the ring */
+        {
+            handle->filled++;                                                              /* add one */
+        }
+        handle->since++;                                                                   /* add one */
+        if ((handle->filled == handle->window) && (handle->since >= handle->hop))          /* window ready */
+        {
+            handle->since = 0;                                                             /* next hop */
+            a_adxl362_feature_emit(handle);                                                /* make the features */
+        }
+    }
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     update the feature extractor with a fifo block
+ * @param[in] *handle pointer to an adxl362 feature handle structure
+ * @param[in] *block pointer to a block read by adxl362_read_fifo_block
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 block is NULL
+ * @note      none
+ */
+uint8_t adxl362_feature_update_block(adxl362_feature_handle_t *handle, const adxl362_block_t *block)
+{
+    if (block == NULL)                                                                     /* check the block */
+    {
+        return 4;                                                                          /* return error */
+    }
+    
+    return adxl362_feature_update(handle, block->x, block->y, block->z, block->len, block->range);        /* update */
+}
+
+/**
+ * @brief     reset the feature extractor
+ * @param[in] *handle pointer to an adxl362 feature handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t adxl362_feature_reset(adxl362_feature_handle_t *handle)
+{
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    memset(handle->sum, 0, sizeof(handle->sum));                                           /* clear the sums */
+    handle->pos = 0;                                                                       /* clear the position */
+    handle->filled = 0;                                                                    /* clear the ring */
+    handle->since = 0;                                                                     /* clear the hop */
+    
+    return 0;                                                                              /* success return 0 */
+}
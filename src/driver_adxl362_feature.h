@@ -0,0 +1,170 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_feature.h
+ * @brief     driver adxl362 feature header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADXL362_FEATURE_H
+#define DRIVER_ADXL362_FEATURE_H
+
+#include "driver_adxl362.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup adxl362_feature_driver adxl362 feature driver function
+ * @brief    adxl362 feature driver modules
+ * @ingroup  adxl362_driver
+ * @{
+ */
+
+/**
+ * @brief adxl362 feature max window definition
+ */
+#define ADXL362_FEATURE_MAX_WINDOW        512        /**< keeps the fourth power sums exact in 64 bits */
+
+/**
+ * @brief adxl362 feature channel enumeration definition
+ */
+typedef enum
+{
+    ADXL362_FEATURE_CHANNEL_X         = 0x00,        /**< x axis */
+    ADXL362_FEATURE_CHANNEL_Y         = 0x01,        /**< y axis */
+    ADXL362_FEATURE_CHANNEL_Z         = 0x02,        /**< z axis */
+    ADXL362_FEATURE_CHANNEL_MAGNITUDE = 0x03,        /**< magnitude */
+} adxl362_feature_channel_t;
+
+/**
+ * @brief adxl362 feature structure definition
+ * @note  every array is indexed by adxl362_feature_channel_t
+ */
+typedef struct adxl362_feature_s
+{
+    uint32_t index;              /**< window index */
+    uint16_t window;             /**< samples per window */
+    float mean[4];               /**< mean in g */
+    float zero_crossing[4];      /**< mean crossings per sample */
+    float kurtosis[4];           /**< kurtosis, 3 for a normal distribution */
+    float skewness[4];           /**< skewness */
+    float crest[4];              /**< peak deviation from the mean over the standard deviation */
+    float energy[4];             /**< mean square in g^2 */
+    float mad[4];                /**< mean absolute deviation from the mean in g */
+} adxl362_feature_t;
+
+/**
+ * @brief adxl362 feature handle structure definition
+ * @note  every sample is written twice into a mirrored ring so any window is contiguous
+ */
+typedef struct adxl362_feature_handle_s
+{
+    void (*receive_callback)(const adxl362_feature_t *feature);        /**< point to a receive_callback function address */
+    uint16_t window;                                                   /**< samples per window */
+    uint16_t hop;                                                      /**< samples between windows */
+    uint16_t pos;                                                      /**< ring write position */
+    uint16_t filled;                                                   /**< samples in the ring */
+    uint16_t since;                                                    /**< samples since the last window */
+    uint32_t index;                                                    /**< window index */
+    int32_t sum[4];                                                    /**< running sum of the window in mg */
+    int16_t ring[4][ADXL362_FEATURE_MAX_WINDOW * 2];                   /**< mirrored ring in mg */
+    adxl362_feature_t feature;                                         /**< feature buffer */
+    uint8_t inited;                                                    /**< inited flag */
+} adxl362_feature_handle_t;
+
+/**
+ * @brief     initialize the feature extractor
+ * @param[in] *handle pointer to an adxl362 feature handle structure
+ * @param[in] window samples per window
+ * @param[in] hop samples between windows
+ * @param[in] *callback pointer to a feature callback function
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 window is invalid
+ *            - 5 hop is invalid
+ * @note      2 <= window <= 512, 0 < hop <= window
+ */
+uint8_t adxl362_feature_init(adxl362_feature_handle_t *handle, uint16_t window, uint16_t hop,
+                             void (*callback)(const adxl362_feature_t *feature));
+
+/**
+ * @brief     update the feature extractor with raw samples
+ * @param[in] *handle pointer to an adxl362 feature handle structure
+ * @param[in] *x pointer to an x axis raw buffer
+ * @param[in] *y pointer to a y axis raw buffer
+ * @param[in] *z pointer to a z axis raw buffer
+ * @param[in] len buffer length
+ * @param[in] range range of the raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the callback runs every hop samples once the first window is full
+ */
+uint8_t adxl362_feature_update(adxl362_feature_handle_t *handle, const int16_t *x, const int16_t *y,
+                               const int16_t *z, uint16_t len, adxl362_range_t range);
+
+/**
+ * @brief     update the feature extractor with a fifo block
+ * @param[in] *handle pointer to an adxl362 feature handle structure
+ * @param[in] *block pointer to a block read by adxl362_read_fifo_block
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 block is NULL
+ * @note      none
+ */
+uint8_t adxl362_feature_update_block(adxl362_feature_handle_t *handle, const adxl362_block_t *block);
+
+/**
+ * @brief     reset the feature extractor
+ * @param[in] *handle pointer to an adxl362 feature handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t adxl362_feature_reset(adxl362_feature_handle_t *handle);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,827 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_fft.c
+ * @brief     driver adxl362 fft source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_adxl362_fft.h"
+#include <math.h>
+
+/**
+ * @brief pi definition
+ */
+#define ADXL362_FFT_PI        3.14159265358979323846        /**< pi */
+
+/**
+ * @brief adxl362 fft g per lsb table
+ */
+static const float gsc_adxl362_fft_scale[3] =
+{
+    1.0f / 1000.0f,        /**< 2g */
+    1.0f / 500.0f,         /**< 4g */
+    1.0f / 250.0f,         /**< 8g */
+};
+
+/**
+ * @brief     check the transform length
+ * @param[in] len transform length
+ * @return    1 if valid else 0
+ * @note      none
+ */
+static uint8_t a_adxl362_fft_len_valid(uint16_t len)
+{
+    if ((len < ADXL362_FFT_MIN_LEN) || (len > ADXL362_FFT_MAX_LEN))        /* check the range */
+    {
+        return 0;                                                          /* invalid */
+    }
+    if ((len & (len - 1)) != 0)                                            /* check power of 2 */
+    {
+        return 0;                                                          /* invalid */
+    }
+    
+    return 1;                                                              /* valid */
+}
+
+/**
+ * @brief     get a window coefficient
+ * @param[in] window window type
+ * @param[in] i sample index
+ * @param[in] len window length
+ * @return    coefficient
+ * @note      periodic windows, the spectral analysis form
+ */
+static double a_adxl362_fft_window(adxl362_fft_window_t window, uint16_t i, uint16_t len)
+{
+    double x;
+    
+    x = 2.0 * ADXL362_FFT_PI * (double)i / (double)len;                   /* get the phase */
+    if (window == ADXL362_FFT_WINDOW_HANN)                                 /* hann */
+    {
+        return 0.5 - 0.5 * cos(x);                                         /* hann */
+    }
+    else if (window == ADXL362_FFT_WINDOW_FLAT_TOP)                        /* flat top */
+    {
+        return 0.21557895 - 0.41663158 * cos(x) + 0.277263158 * cos(2.0 * x) - 
+               0.083578947 * cos(3.0 * x) + 0.006947368 * cos(4.0 * x);    /* flat top */
+    }
+    else                                                                   /* rectangle */
+    {
+        return 1.0;                                                        /* rectangle */
+    }
+}
+
+/**
+ * @brief      make the bit reverse table
+ * @param[out] *table pointer to a table buffer
+ * @param[in]  m complex transform length
+ * @note       none
+ */
+static void a_adxl362_fft_bit_reverse(uint16_t *table, uint16_t m)
+{
+    uint16_t i;
+    uint16_t j;
+    uint16_t bit;
+    
+    j = 0;                                                                 /* init 0 */
+    for (i = 0; i < m; i++)                                                /* run all index */
+    {
+        table[i] = j;                                                      /* save */
+        bit = m >> 1;                                                      /* highest bit */
+        while ((j & bit) != 0)                                             /* carry */
+        {
+            j ^= bit;                                                      /* clear */
+            bit >>= 1;                                                     /* next bit */
+        }
+        j |= bit;                                                          /* set */
+    }
+}
+
+/**
+ * @brief     initialize the float fft handle
+ * @param[in] *handle pointer to an adxl362 fft handle structure
+ * @param[in] len transform length
+ * @param[in] window window type
+ * @param[in] odr output data rate in Hz
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 len is invalid
+ *            - 5 odr is invalid
+ * @note      len is a power of 2 in [64, 1024]
+ */
+uint8_t adxl362_fft_init(adxl362_fft_handle_t *handle, uint16_t len, adxl362_fft_window_t window, float odr)
+{
+    uint16_t i;
+    uint16_t j;
+    uint16_t half;
+    uint16_t m;
+    double w;
+    double s1;
+    double s2;
+    
+    if (handle == NULL)                                                    /* check handle */
+    {
+        return 2;                                                          /* return error */
+    }
+    if (a_adxl362_fft_len_valid(len) == 0)                                 /* check the length */
+    {
+        return 4;                                                          /* return error */
+    }
+    if (!(odr > 0.0f))                                                     /* check the odr */
+    {
+        return 5;                                                          /* return error */
+    }
+    
+    m = len / 2;                                                           /* complex length */
+    s1 = 0.0;                                                              /* init 0 */
+    s2 = 0.0;                                                              /* init 0 */
+    for (i = 0; i < len; i++)                                              /* make the window */
+    {
+        w = a_adxl362_fft_window(window, i, len);                          /* get the coefficient */
+        handle->window[i] = (float)w;                                      /* save */
+        s1 += w;                                                           /* sum */
+        s2 += w * w;                                                       /* square sum */
+    }
+    for (half = 1; half < m; half <<= 1)                                   /* run all stages */
+    {
+        for (j = 0; j < half; j++)                                         /* stage twiddles */
+        {
+            handle->stage_cos[half - 1 + j] = (float)cos(ADXL362_FFT_PI * (double)j / (double)half);        /* cos */
+            handle->stage_sin[half - 1 + j] = (float)sin(ADXL362_FFT_PI * (double)j / (double)half);        /* sin */
+        }
+    }
+    for (i = 0; i <= len / 4; i++)                                         /* split twiddles */
+    {
+        handle->split_cos[i] = (float)cos(2.0 * ADXL362_FFT_PI * (double)i / (double)len);                  /* cos */
+        handle->split_sin[i] = (float)sin(2.0 * ADXL362_FFT_PI * (double)i / (double)len);                  /* sin */
+    }
+    a_adxl362_fft_bit_reverse(handle->bit_reverse, m);                     /* make the bit reverse table */
+    handle->len = len;                                                     /* set the length */
+    handle->odr = odr;                                                     /* set the odr */
+    handle->window_sum = (float)s1;                                        /* set the window sum */
+    handle->window_square_sum = (float)s2;                                 /* set the window square sum */
+    handle->inited = 1;                                                    /* flag finish initialization */
+    
+    return 0;                                                              /* success return 0 */
+}
+
+/**
+ * @brief      window raw data into a transform buffer
+ * @param[in]  *handle pointer to an adxl362 fft handle structure
+ * @param[in]  *in pointer to len raw samples of one axis
+ * @param[in]  range range of the raw data
+ * @param[in]  detrend bool value, remove the block mean first
+ * @param[out] *buf pointer to a len transform buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 range is invalid
+ * @note       buf is in g
+ */
+uint8_t adxl362_fft_load_raw(adxl362_fft_handle_t *handle, const int16_t *in, adxl362_range_t range,
+                             adxl362_bool_t detrend, float *buf)
+{
+    uint16_t i;
+    int32_t sum;
+    float mean;
+    float scale;
+    
+    if (handle == NULL)                                                    /* check handle */
+    {
+        return 2;                                                          /* return error */
+    }
+    if (handle->inited != 1)                                               /* check handle initialization */
+    {
+        return 3;                                                          /* return error */
+    }
+    if ((uint8_t)range > (uint8_t)ADXL362_RANGE_8G)                        /* check the range */
+    {
+        return 4;                                                          /* return error */
+    }
+    
+    mean = 0.0f;                                                           /* init 0 */
+    if (detrend == ADXL362_BOOL_TRUE)                                      /* remove the mean */
+    {
+        sum = 0;                                                           /* init 0 */
+        for (i = 0; i < handle->len; i++)                                  /* sum */
+        {
+            sum += in[i];                                                  /* add */
+        }
+        mean = (float)sum / (float)handle->len;                            /* get the mean */
+    }
+    scale = gsc_adxl362_fft_scale[range];                                  /* get the scale */
+    for (i = 0; i < handle->len; i++)                                      /* window */
+    {
+        buf[i] = ((float)in[i] - mean) * scale * handle->window[i];        /* convert and window */
+    }
+    
+    return 0;                                                              /* success return 0 */
+}
+
+/**
+ * @brief      window float data into a transform buffer
+ * @param[in]  *handle pointer to an adxl362 fft handle structure
+ * @param[in]  *in pointer to len samples of one axis
+ * @param[in]  detrend bool value, remove the block mean first
+ * @param[out] *buf pointer to a len transform buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       in and buf may be the same buffer
+ */
+uint8_t adxl362_fft_load_float(adxl362_fft_handle_t *handle, const float *in, adxl362_bool_t detrend, float *buf)
+{
+    uint16_t i;
+    float mean;
+    
+    if (handle == NULL)                                                    /* check handle */
+    {
+        return 2;                                                          /* return error */
+    }
+    if (handle->inited != 1)                                               /* check handle initialization */
+    {
+        return 3;                                                          /* return error */
+    }
+    
+    mean = 0.0f;                                                           /* init 0 */
+    if (detrend == ADXL362_BOOL_TRUE)                                      /* remove the mean */
+    {
+        for (i = 0; i < handle->len; i++)                                  /* sum */
+        {
+            mean += in[i];                                                 /* add */
+        }
+        mean /= (float)handle->len;                                        /* get the mean */
+    }
+    for (i = 0; i < handle->len; i++)                                      /* window */
+    {
+        buf[i] = (in[i] - mean) * handle->window[i];                       /* window */
+    }
+    
+    return 0;                                                              /* success return 0 */
+}
+
+/**
+ * @brief         run the real fft in place
+ * @param[in]     *handle pointer to an adxl362 fft handle structure
+ * @param[in,out] *buf pointer to a len transform buffer
+ * @return        status code
+ *                - 0 success
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ * @note          the output is packed, buf[0] is bin 0, buf[1] is bin len / 2,
+ *                buf[2k] and buf[2k + 1] are the real and imaginary part of bin k
+ */
+uint8_t adxl362_fft_forward(adxl362_fft_handle_t *handle, float *buf)
+{
+    uint16_t i;
+    uint16_t j;
+    uint16_t k;
+    uint16_t m;
+    uint16_t half;
+    uint16_t r;
+    float t;
+    float ar;
+    float ai;
+    float br;
+    float bi;
+    float tr;
+    float ti;
+    float er;
+    float ei;
+    float fr;
+    float fi;
+    
+    if (handle == NULL)                                                    /* check handle */
+    {
+        return 2;                                                          /* return error */
+    }
+    if (handle->inited != 1)                                               /* check handle initialization */
+    {
+        return 3;                                                          /* return error */
+    }
+    
+    m = handle->len / 2;                                                   /* complex length */
+    for (i = 0; i < m; i++)                                                /* bit reverse */
+    {
+        r = handle->bit_reverse[i];                                        /* get the index */
+        if (i < r)                                                         /* swap once */
+        {
+            t = buf[2 * i];                                                /* swap real */
+            buf[2 * i] = buf[2 * r];                                       /* swap real */
+            buf[2 * r] = t;                                                /* swap real */
+            t = buf[2 * i + 1];                                            /* swap imaginary */
+            buf[2 * i + 1] = buf[2 * r + 1];                               /* swap imaginary */
+            buf[2 * r + 1] = t;                                            /* swap imaginary */
+        }
+    }
+    for (k = 0; k < m; k += 2)                                             /* first stage has no multiply */
+    {
+        ar = buf[2 * k];                                                   /* get a */
+        ai = buf[2 * k + 1];                                               /* get a */
+        br = buf[2 * k + 2];                                               /* get b */
+        bi = buf[2 * k + 3];                                               /* get b */
+        buf[2 * k] = ar + br;                                              /* a + b */
+        buf[2 * k + 1] = ai + bi;                                          /* a + b */
+        buf[2 * k + 2] = ar - br;                                          /* a - b */
+        buf[2 * k + 3] = ai - bi;                                          /* a - b */
+    }
+    for (half = 2; half < m; half <<= 1)                                   /* run the other stages */
+    {
+        const float *wc = &handle->stage_cos[half - 1];                    /* stage cos */
+        const float *ws = &handle->stage_sin[half - 1];                    /* stage sin */
+        
+        for (k = 0; k < m; k += 2 * half)                                  /* run all groups */
+        {
+            float *a = &buf[2 * k];                                        /* top half */
+            float *b = &buf[2 * (k + half)];                               /* bottom half */
+            
+            for (j = 0; j < half; j++)                                     /* contiguous butterflies, vectorized */
+            {
+                tr = b[2 * j] * wc[j] + b[2 * j + 1] * ws[j];              /* b * conj(w) real */
+                ti = b[2 * j + 1] * wc[j] - b[2 * j] * ws[j];              /* b * conj(w) imaginary */
+                b[2 * j] = a[2 * j] - tr;                                  /* a - t */
+                b[2 * j + 1] = a[2 * j + 1] - ti;                          /* a - t */
+                a[2 * j] = a[2 * j] + tr;                                  /* a + t */
+                a[2 * j + 1] = a[2 * j + 1] + ti;                          /* a + t */
+            }
+        }
+    }
+    
+    t = buf[0];                                                            /* save z0 real */
+    buf[0] = t + buf[1];                                                   /* bin 0 */
+    buf[1] = t - buf[1];                                                   /* bin len / 2 */
+    for (k = 1; k <= m / 2; k++)                                           /* split the real spectrum */
+    {
+        ar = buf[2 * k];                                                   /* z[k] */
+        ai = buf[2 * k + 1];                                               /* z[k] */
+        br = buf[2 * (m - k)];                                             /* z[m - k] */
+        bi = buf[2 * (m - k) + 1];                                         /* z[m - k] */
+        er = 0.5f * (ar + br);                                             /* even part */
+        ei = 0.5f * (ai - bi);                                             /* even part */
+        fr = 0.5f * (ai + bi);                                             /* odd part */
+        fi = -0.5f * (ar - br);                                            /* odd part */
+        tr = fr * handle->split_cos[k] + fi * handle->split_sin[k];        /* w * odd real */
+        ti = fi * handle->split_cos[k] - fr * handle->split_sin[k];        /* w * odd imaginary */
+        buf[2 * k] = er + tr;                                              /* bin k */
+        buf[2 * k + 1] = ei + ti;                                          /* bin k */
+        buf[2 * (m - k)] = er - tr;                                        /* bin m - k */
+        buf[2 * (m - k) + 1] = -(ei - ti);                                 /* bin m - k */
+    }
+    
+    return 0;                                                              /* success return 0 */
+}
+
+/**
+ * @brief      get the single sided amplitude spectrum
+ * @param[in]  *handle pointer to an adxl362 fft handle structure
+ * @param[in]  *buf pointer to a transformed buffer
+ * @param[out] *out pointer to a len / 2 + 1 amplitude buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the amplitude is corrected by the window gain, a sine of a g peak reads a
+ */
+uint8_t adxl362_fft_magnitude(adxl362_fft_handle_t *handle, const float *buf, float *out)
+{
+    uint16_t k;
+    uint16_t m;
+    float gain;
+    
+    if (handle == NULL)                                                    /* check handle */
+    {
+        return 2;                                                          /* return error */
+    }
+    if (handle->inited != 1)                                               /* check handle initialization */
+    {
+        return 3;                                                          /* return error */
+    }
+    
+    m = handle->len / 2;                                                   /* half length */
+    gain = 2.0f / handle->window_sum;                                      /* single sided gain */
+    out[0] = fabsf(buf[0]) * 0.5f * gain;                                  /* bin 0 */
+    out[m] = fabsf(buf[1]) * 0.5f * gain;                                  /* bin len / 2 */
+    for (k = 1; k < m; k++)                                                /* other bins */
+    {
+        out[k] = sqrtf(buf[2 * k] * buf[2 * k] + buf[2 * k + 1] * buf[2 * k + 1]) * gain;        /* amplitude */
+    }
+    
+    return 0;                                                              /* success return 0 */
+}
+
+/**
+ * @brief      get the single sided power spectral density
+ * @param[in]  *handle pointer to an adxl362 fft handle structure
+ * @param[in]  *buf pointer to a transformed buffer
+ * @param[out] *out pointer to a len / 2 + 1 psd buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the unit is g^2/Hz, the bin width is odr / len
+ */
+uint8_t adxl362_fft_psd(adxl362_fft_handle_t *handle, const float *buf, float *out)
+{
+    uint16_t k;
+    uint16_t m;
+    float gain;
+    
+    if (handle == NULL)                                                    /* check handle */
+    {
+        return 2;                                                          /* return error */
+    }
+    if (handle->inited != 1)                                               /* check handle initialization */
+    {
+        return 3;                                                          /* return error */
+    }
+    
+    m = handle->len / 2;                                                   /* half length */
+    gain = 2.0f / (handle->odr * handle->window_square_sum);               /* single sided density gain */
+    out[0] = buf[0] * buf[0] * 0.5f * gain;                                /* bin 0 */
+    out[m] = buf[1] * buf[1] * 0.5f * gain;                                /* bin len / 2 */
+    for (k = 1; k < m; k++)                                                /* other bins */
+    {
+        out[k] = (buf[2 * k] * buf[2 * k] + buf[2 * k + 1] * buf[2 * k + 1]) * gain;              /* density */
+    }
+    
+    return 0;                                                              /* success return 0 */
+}
+
+/**
+ * @brief     convert to q15
+ * @param[in] v value in [-1, 1]
+ * @return    q15 value
+ * @note      none
+ */
+static int16_t a_adxl362_fft_q15(double v)
+{
+    double q;
+    
+    q = floor(v * 32768.0 + 0.5);                                          /* round */
+    if (q > 32767.0)                                                       /* check max */
+    {
+        q = 32767.0;                                                       /* saturate */
+    }
+    if (q < -32768.0)                                                      /* check min */
+    {
+        q = -32768.0;                                                      /* saturate */
+    }
+    
+    return (int16_t)q;                                                     /* return the value */
+}
+
+/**
+ * @brief     q15 multiply
+ * @param[in] a q15 value
+ * @param[in] b q15 value
+ * @return    rounded product
+ * @note      none
+ */
+static inline int32_t a_adxl362_fft_q15_mul(int32_t a, int32_t b)
+{
+    return (a * b + 16384) >> 15;                                          /* multiply and round */
+}
+
+/**
+ * @brief     integer square root
+ * @param[in] v value
+ * @return    floor of the square root
+ * @note      none
+ */
+static uint32_t a_adxl362_fft_isqrt(uint32_t v)
+{
+    uint32_t r;
+    uint32_t bit;
+    
+    r = 0;                                                                 /* init 0 */
+    bit = 1UL << 30;                                                       /* highest power of 4 */
+    while (bit > v)                                                        /* find the start */
+    {
+        bit >>= 2;                                                         /* next */
+    }
+    while (bit != 0)                                                       /* run all bits */
+    {
+        if (v >= r + bit)                                                  /* check the bit */
+        {
+            v -= r + bit;                                                  /* sub */
+            r = (r >> 1) + bit;                                            /* set the bit */
+        }
+        else
+        {
+            r >>= 1;                                                       /* shift */
+        }
+        bit >>= 2;                                                         /* next */
+    }
+    
+    return r;                                                              /* return the root */
+}
+
+/**
+ * @brief     initialize the q15 fft handle
+ * @param[in] *handle pointer to an adxl362 fft q15 handle structure
+ * @param[in] len transform length
+ * @param[in] window window type
+ * @param[in] odr output data rate in Hz
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 len is invalid
+ *            - 5 odr is invalid
+ * @note      len is a power of 2 in [64, 1024],
+ *            the tables are built with float math once, the transform itself is integer only
+ */
+uint8_t adxl362_fft_q15_init(adxl362_fft_q15_handle_t *handle, uint16_t len, adxl362_fft_window_t window, float odr)
+{
+    uint16_t i;
+    uint16_t j;
+    uint16_t half;
+    uint16_t m;
+    double s1;
+    
+    if (handle == NULL)                                                    /* check handle */
+    {
+        return 2;                                                          /* return error */
+    }
+    if (a_adxl362_fft_len_valid(len) == 0)                                 /* check the length */
+    {
+        return 4;                                                          /* return error */
+    }
+    if (!(odr > 0.0f))                                                     /* check the odr */
+    {
+        return 5;                                                          /* return error */
+    }
+    
+    m = len / 2;                                                           /* complex length */
+    s1 = 0.0;                                                              /* init 0 */
+    for (i = 0; i < len; i++)                                              /* make the window */
+    {
+        handle->window[i] = a_adxl362_fft_q15(a_adxl362_fft_window(window, i, len));        /* save */
+        s1 += (double)handle->window[i] / 32768.0;                                           /* sum */
+    }
+    for (half = 1; half < m; half <<= 1)                                   /* run all stages */
+    {
+        for (j = 0; j < half; j++)                                         /* stage twiddles */
+        {
+            handle->stage_cos[half - 1 + j] = a_adxl362_fft_q15(cos(ADXL362_FFT_PI * (double)j / (double)half));        /* cos */
+            handle->stage_sin[half - 1 + j] = a_adxl362_fft_q15(sin(ADXL362_FFT_PI * (double)j / (double)half));        /* sin */
+        }
+    }
+    for (i = 0; i <= len / 4; i++)                                         /* split twiddles */
+    {
+        handle->split_cos[i] = a_adxl362_fft_q15(cos(2.0 * ADXL362_FFT_PI * (double)i / (double)len));                  /* cos */
+        handle->split_sin[i] = a_adxl362_fft_q15(sin(2.0 * ADXL362_FFT_PI * (double)i / (double)len));                  /* sin */
+    }
+    a_adxl362_fft_bit_reverse(handle->bit_reverse, m);                     /* make the bit reverse table */
+    handle->len = len;                                                     /* set the length */
+    handle->odr = odr;                                                     /* set the odr */
+    handle->inverse_gain = (uint16_t)floor((double)len / s1 * 4096.0 + 0.5);        /* len / window sum in q12 */
+    handle->inited = 1;                                                    /* flag finish initialization */
+    
+    return 0;                                                              /* success return 0 */
+}
+
+/**
+ * @brief      window raw data into a q15 transform buffer
+ * @param[in]  *handle pointer to an adxl362 fft q15 handle structure
+ * @param[in]  *in pointer to len raw samples of one axis
+ * @param[in]  detrend bool value, remove the block mean first
+ * @param[out] *buf pointer to a len transform buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the 12 bits raw data is scaled by 4 to use the q15 headroom
+ */
+uint8_t adxl362_fft_q15_load_raw(adxl362_fft_q15_handle_t *handle, const int16_t *in, adxl362_bool_t detrend,
+                                 int16_t *buf)
+{
+    uint16_t i;
+    int32_t sum;
+    int32_t mean;
+    int32_t v;
+    
+    if (handle == NULL)                                                    /* check handle */
+    {
+        return 2;                                                          /* return error */
+    }
+    if (handle->inited != 1)                                               /* check handle initialization */
+    {
+        return 3;                                                          /* return error */
+    }
+    
+    mean = 0;                                                              /* init 0 */
+    if (detrend == ADXL362_BOOL_TRUE)                                      /* remove the mean */
+    {
+        sum = 0;                                                           /* init 0 */
+        for (i = 0; i < handle->len; i++)                                  /* sum */
+        {
+            sum += in[i];                                                  /* add */
+        }
+        mean = (sum * 4) / (int32_t)handle->len;                           /* get the mean * 4 */
+    }
+    for (i = 0; i < handle->len; i++)                                      /* window */
+    {
+        v = (int32_t)in[i] * 4 - mean;                                     /* scale and detrend */
+        v = v > 16383 ? 16383 : (v < -16384 ? -16384 : v);                 /* keep the headroom */
+        buf[i] = (int16_t)a_adxl362_fft_q15_mul(v, handle->window[i]);     /* window */
+    }
+    
+    return 0;                                                              /* success return 0 */
+}
+
+/**
+ * @brief         run the q15 real fft in place
+ * @param[in]     *handle pointer to an adxl362 fft q15 handle structure
+ * @param[in,out] *buf pointer to a len transform buffer
+ * @return        status code
+ *                - 0 success
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ * @note          every stage scales by 1/2 so it never overflows, the output is the spectrum / len,
+ *                packed like adxl362_fft_forward
+ */
+uint8_t adxl362_fft_q15_forward(adxl362_fft_q15_handle_t *handle, int16_t *buf)
+{
+    uint16_t i;
+    uint16_t j;
+    uint16_t k;
+    uint16_t m;
+    uint16_t half;
+    uint16_t r;
+    int16_t t;
+    int32_t ar;
+    int32_t ai;
+    int32_t br;
+    int32_t bi;
+    int32_t tr;
+    int32_t ti;
+    int32_t er;
+    int32_t ei;
+    int32_t fr;
+    int32_t fi;
+    
+    if (handle == NULL)                                                    /* check handle */
+    {
+        return 2;                                                          /* return error */
+    }
+    if (handle->inited != 1)                                               /* check handle initialization */
+    {
+        return 3;                                                          /* return error */
+    }
+    
+    m = handle->len / 2;                                                   /* complex length */
+    for (i = 0; i < m; i++)                                                /* bit reverse */
+    {
+        r = handle->bit_reverse[i];                                        /* get the index */
+        if (i < r)                                                         /* swap once */
+        {
+            t = buf[2 * i];                                                /* swap real */
+            buf[2 * i] = buf[2 * r];                                       /* swap real */
+            buf[2 * r] = t;                                                /* swap real */
+            t = buf[2 * i + 1];                                            /* swap imaginary */
+            buf[2 * i + 1] = buf[2 * r + 1];                               /* swap imaginary */
+            buf[2 * r + 1] = t;                                            /* swap imaginary */
+        }
+    }
+    for (k = 0; k < m; k += 2)                                             /* first stage has no multiply */
+    {
+        ar = buf[2 * k];                                                   /* get a */
+        ai = buf[2 * k + 1];                                               /* get a */
+        br = buf[2 * k + 2];                                               /* get b */
+        bi = buf[2 * k + 3];                                               /* get b */
+        buf[2 * k] = (int16_t)((ar + br) >> 1);                            /* (a + b) / 2 */
+        buf[2 * k + 1] = (int16_t)((ai + bi) >> 1);                        /* (a + b) / 2 */
+        buf[2 * k + 2] = (int16_t)((ar - br) >> 1);                        /* (a - b) / 2 */
+        buf[2 * k + 3] = (int16_t)((ai - bi) >> 1);                        /* (a - b) / 2 */
+    }
+    for (half = 2; half < m; half <<= 1)                                   /* run the other stages */
+    {
+        const int16_t *wc = &handle->stage_cos[half - 1];                  /* stage cos */
+        const int16_t *ws = &handle->stage_sin[half - 1];                  /* stage sin */
+        
+        for (k = 0; k < m; k += 2 * half)                                  /* run all groups */
+        {
+            int16_t *a = &buf[2 * k];                                      /* top half */
+            int16_t *b = &buf[2 * (k + half)];                             /* bottom half */
+            
+            for (j = 0; j < half; j++)                                     /* contiguous butterflies */
+            {
+                tr = ((int32_t)b[2 * j] * wc[j] + (int32_t)b[2 * j + 1] * ws[j] + 16384) >> 15;        /* t real */
+                ti = ((int32_t)b[2 * j + 1] * wc[j] - (int32_t)b[2 * j] * ws[j] + 16384) >> 15;        /* t imaginary */
+                ar = a[2 * j];                                             /* get a */
+                ai = a[2 * j + 1];                                         /* get a */
+                b[2 * j] = (int16_t)((ar - tr) >> 1);                      /* (a - t) / 2 */
+                b[2 * j + 1] = (int16_t)((ai - ti) >> 1);                  /* (a - t) / 2 */
+                a[2 * j] = (int16_t)((ar + tr) >> 1);                      /* (a + t) / 2 */
+                a[2 * j + 1] = (int16_t)((ai + ti) >> 1);                  /* (a + t) / 2 */
+            }
+        }
+    }
+    
+    ar = buf[0];                                                           /* z0 real */
+    ai = buf[1];                                                           /* z0 imaginary */
+    buf[0] = (int16_t)((ar + ai) >> 1);                                    /* bin 0 / 2 */
+    buf[1] = (int16_t)((ar - ai) >> 1);                                    /* bin len / 2 / 2 */
+    for (k = 1; k <= m / 2; k++)                                           /* split the real spectrum */
+    {
+        ar = buf[2 * k];                                                   /* z[k] */
+        ai = buf[2 * k + 1];                                               /* z[k] */
+        br = buf[2 * (m - k)];                                             /* z[m - k] */
+        bi = buf[2 * (m - k) + 1];                                         /* z[m - k] */
+        er = (ar + br) >> 1;                                               /* even part */
+        ei = (ai - bi) >> 1;                                               /* even part */
+        fr = (ai + bi) >> 1;                                               /* odd part */
+        fi = (br - ar) >> 1;                                               /* odd part */
+        tr = a_adxl362_fft_q15_mul(fr, handle->split_cos[k]) + 
+             a_adxl362_fft_q15_mul(fi, handle->split_sin[k]);              /* w * odd real */
+        ti = a_adxl362_fft_q15_mul(fi, handle->split_cos[k]) - 
+             a_adxl362_fft_q15_mul(fr, handle->split_sin[k]);              /* w * odd imaginary */
+        buf[2 * k] = (int16_t)((er + tr) >> 1);                            /* bin k / 2 */
+        buf[2 * k + 1] = (int16_t)((ei + ti) >> 1);                        /* bin k / 2 */
+        buf[2 * (m - k)] = (int16_t)((er - tr) >> 1);                      /* bin m - k / 2 */
+        buf[2 * (m - k) + 1] = (int16_t)((ti - ei) >> 1);                  /* bin m - k / 2 */
+    }
+    
+    return 0;                                                              /* success return 0 */
+}
+
+/**
+ * @brief      get the q15 single sided amplitude spectrum
+ * @param[in]  *handle pointer to an adxl362 fft q15 handle structure
+ * @param[in]  *buf pointer to a transformed buffer
+ * @param[out] *out pointer to a len / 2 + 1 amplitude buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the amplitude is in raw lsb / 4 and corrected by the window gain
+ */
+uint8_t adxl362_fft_q15_magnitude(adxl362_fft_q15_handle_t *handle, const int16_t *buf, uint16_t *out)
+{
+    uint16_t k;
+    uint16_t m;
+    int32_t v;
+    uint32_t mag;
+    uint32_t amp;
+    
+    if (handle == NULL)                                                    /* check handle */
+    {
+        return 2;                                                          /* return error */
+    }
+    if (handle->inited != 1)                                               /* check handle initialization */
+    {
+        return 3;                                                          /* return error */
+    }
+    
+    m = handle->len / 2;                                                   /* half length */
+    for (k = 0; k <= m; k++)                                               /* run all bins */
+    {
+        if ((k == 0) || (k == m))                                          /* real bins */
+        {
+            v = (k == 0) ? buf[0] : buf[1];                                /* packed real bins */
+            mag = (uint32_t)(v < 0 ? -v : v);                              /* abs */
+            amp = (mag * handle->inverse_gain + 2048) >> 12;               /* amplitude */
+        }
+        else
+        {
+            mag = a_adxl362_fft_isqrt((uint32_t)((int32_t)buf[2 * k] * buf[2 * k]) + 
+                                      (uint32_t)((int32_t)buf[2 * k + 1] * buf[2 * k + 1]));        /* magnitude */
+            amp = (2 * mag * handle->inverse_gain + 2048) >> 12;                                   /* single sided amplitude */
+        }
+        out[k] = (uint16_t)(amp > 65535 ? 65535 : amp);                   /* saturate */
+    }
+    
+    return 0;                                                              /* success return 0 */
+}
@@ -0,0 +1,256 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_fft.h
+ * @brief     driver adxl362 fft header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADXL362_FFT_H
+#define DRIVER_ADXL362_FFT_H
+
+#include "driver_adxl362.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup adxl362_fft_driver adxl362 fft driver function
+ * @brief    adxl362 fft driver modules
+ * @ingroup  adxl362_driver
+ * @{
+ */
+
+/**
+ * @brief adxl362 fft length definition
+ */
+#define ADXL362_FFT_MIN_LEN        64          /**< min transform length */
+#define ADXL362_FFT_MAX_LEN        1024        /**< max transform length */
+
+/**
+ * @brief adxl362 fft window enumeration definition
+ */
+typedef enum
+{
+    ADXL362_FFT_WINDOW_RECTANGLE = 0x00,        /**< rectangle window */
+    ADXL362_FFT_WINDOW_HANN      = 0x01,        /**< hann window */
+    ADXL362_FFT_WINDOW_FLAT_TOP  = 0x02,        /**< flat top window, accurate amplitude */
+} adxl362_fft_window_t;
+
+/**
+ * @brief adxl362 fft handle structure definition
+ * @note  the real transform of length n runs as a complex transform of n / 2 points,
+ *        the complex twiddles are stored per stage so every butterfly loop reads them contiguously
+ */
+typedef struct adxl362_fft_handle_s
+{
+    uint16_t len;                                              /**< transform length */
+    float odr;                                                 /**< output data rate in Hz */
+    float window_sum;                                          /**< sum of the window */
+    float window_square_sum;                                   /**< sum of the squared window */
+    float window[ADXL362_FFT_MAX_LEN];                         /**< window coefficients */
+    float stage_cos[ADXL362_FFT_MAX_LEN / 2];                  /**< complex stage twiddle cos */
+    float stage_sin[ADXL362_FFT_MAX_LEN / 2];                  /**< complex stage twiddle sin */
+    float split_cos[ADXL362_FFT_MAX_LEN / 4 + 1];              /**< real split twiddle cos */
+    float split_sin[ADXL362_FFT_MAX_LEN / 4 + 1];              /**< real split twiddle sin */
+    uint16_t bit_reverse[ADXL362_FFT_MAX_LEN / 2];             /**< bit reverse table */
+    uint8_t inited;                                            /**< inited flag */
+} adxl362_fft_handle_t;
+
+/**
+ * @brief adxl362 fft q15 handle structure definition
+ */
+typedef struct adxl362_fft_q15_handle_s
+{
+    uint16_t len;                                              /**< transform length */
+    float odr;                                                 /**< output data rate in Hz */
+    uint16_t inverse_gain;                                     /**< len / window sum in q12 */
+    int16_t window[ADXL362_FFT_MAX_LEN];                       /**< window coefficients in q15 */
+    int16_t stage_cos[ADXL362_FFT_MAX_LEN / 2];                /**< complex stage twiddle cos in q15 */
+    int16_t stage_sin[ADXL362_FFT_MAX_LEN / 2];                /**< complex stage twiddle sin in q15 */
+    int16_t split_cos[ADXL362_FFT_MAX_LEN / 4 + 1];            /**< real split twiddle cos in q15 */
+    int16_t split_sin[ADXL362_FFT_MAX_LEN / 4 + 1];            /**< real split twiddle sin in q15 */
+    uint16_t bit_reverse[ADXL362_FFT_MAX_LEN / 2];             /**< bit reverse table */
+    uint8_t inited;                                            /**< inited flag */
+} adxl362_fft_q15_handle_t;
+
+/**
+ * @brief     initialize the float fft handle
+ * @param[in] *handle pointer to an adxl362 fft handle structure
+ * @param[in] len transform length
+ * @param[in] window window type
+ * @param[in] odr output data rate in Hz
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 len is invalid
+ *            - 5 odr is invalid
+ * @note      len is a power of 2 in [64, 1024]
+ */
+uint8_t adxl362_fft_init(adxl362_fft_handle_t *handle, uint16_t len, adxl362_fft_window_t window, float odr);
+
+/**
+ * @brief      window raw data into a transform buffer
+ * @param[in]  *handle pointer to an adxl362 fft handle structure
+ * @param[in]  *in pointer to len raw samples of one axis
+ * @param[in]  range range of the raw data
+ * @param[in]  detrend bool value, remove the block mean first
+ * @param[out] *buf pointer to a len transform buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 range is invalid
+ * @note       buf is in g
+ */
+uint8_t adxl362_fft_load_raw(adxl362_fft_handle_t *handle, const int16_t *in, adxl362_range_t range,
+                             adxl362_bool_t detrend, float *buf);
+
+/**
+ * @brief      window float data into a transform buffer
+ * @param[in]  *handle pointer to an adxl362 fft handle structure
+ * @param[in]  *in pointer to len samples of one axis
+ * @param[in]  detrend bool value, remove the block mean first
+ * @param[out] *buf pointer to a len transform buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       in and buf may be the same buffer
+ */
+uint8_t adxl362_fft_load_float(adxl362_fft_handle_t *handle, const float *in, adxl362_bool_t detrend, float *buf);
+
+/**
+ * @brief         run the real fft in place
+ * @param[in]     *handle pointer to an adxl362 fft handle structure
+ * @param[in,out] *buf pointer to a len transform buffer
+ * @return        status code
+ *                - 0 success
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ * @note          the output is packed, buf[0] is bin 0, buf[1] is bin len / 2,
+ *                buf[2k] and buf[2k + 1] are the real and imaginary part of bin k
+ */
+uint8_t adxl362_fft_forward(adxl362_fft_handle_t *handle, float *buf);
+
+/**
+ * @brief      get the single sided amplitude spectrum
+ * @param[in]  *handle pointer to an adxl362 fft handle structure
+ * @param[in]  *buf pointer to a transformed buffer
+ * @param[out] *out pointer to a len / 2 + 1 amplitude buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the amplitude is corrected by the window gain, a sine of a g peak reads a
+ */
+uint8_t adxl362_fft_magnitude(adxl362_fft_handle_t *handle, const float *buf, float *out);
+
+/**
+ * @brief      get the single sided power spectral density
+ * @param[in]  *handle pointer to an adxl362 fft handle structure
+ * @param[in]  *buf pointer to a transformed buffer
+ * @param[out] *out pointer to a len / 2 + 1 psd buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the unit is g^2/Hz, the bin width is odr / len
+ */
+uint8_t adxl362_fft_psd(adxl362_fft_handle_t *handle, const float *buf, float *out);
+
+/**
+ * @brief     initialize the q15 fft handle
+ * @param[in] *handle pointer to an adxl362 fft q15 handle structure
+ * @param[in] len transform length
+ * @param[in] window window type
+ * @param[in] odr output data rate in Hz
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 len is invalid
+ *            - 5 odr is invalid
+ * @note      len is a power of 2 in [64, 1024],
+ *            the tables are built with float math once, the transform itself is integer only
+ */
+uint8_t adxl362_fft_q15_init(adxl362_fft_q15_handle_t *handle, uint16_t len, adxl362_fft_window_t window, float odr);
+
+/**
+ * @brief      window raw data into a q15 transform buffer
+ * @param[in]  *handle pointer to an adxl362 fft q15 handle structure
+ * @param[in]  *in pointer to len raw samples of one axis
+ * @param[in]  detrend bool value, remove the block mean first
+ * @param[out] *buf pointer to a len transform buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the 12 bits raw data is scaled by 4 to use the q15 headroom
+ */
+uint8_t adxl362_fft_q15_load_raw(adxl362_fft_q15_handle_t *handle, const int16_t *in, adxl362_bool_t detrend,
+                                 int16_t *buf);
+
+/**
+ * @brief         run the q15 real fft in place
+ * @param[in]     *handle pointer to an adxl362 fft q15 handle structure
+ * @param[in,out] *buf pointer to a len transform buffer
+ * @return        status code
+ *                - 0 success
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ * @note          every stage scales by 1/2 so it never overflows, the output is the spectrum / len,
+ *                packed like adxl362_fft_forward
+ */
+uint8_t adxl362_fft_q15_forward(adxl362_fft_q15_handle_t *handle, int16_t *buf);
+
+/**
+ * @brief      get the q15 single sided amplitude spectrum
+ * @param[in]  *handle pointer to an adxl362 fft q15 handle structure
+ * @param[in]  *buf pointer to a transformed buffer
+ * @param[out] *out pointer to a len / 2 + 1 amplitude buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the amplitude is in raw lsb / 4 and corrected by the window gain
+ */
+uint8_t adxl362_fft_q15_magnitude(adxl362_fft_q15_handle_t *handle, const int16_t *buf, uint16_t *out);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
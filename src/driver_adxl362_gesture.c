@@ -0,0 +1,389 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_gesture.c
+ * @brief     driver adxl362 gesture source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_adxl362_gesture.h"
+#include <string.h>
+
+/**
+ * @brief tap state definition
+ */
+#define ADXL362_GESTURE_TAP_IDLE          0        /**< below the threshold */
+#define ADXL362_GESTURE_TAP_ABOVE         1        /**< a tap is running */
+#define ADXL362_GESTURE_TAP_IGNORE        2        /**< above the threshold but not a tap */
+
+/**
+ * @brief orientation of the positive and the negative side of each axis
+ */
+static const adxl362_gesture_orientation_t gsc_adxl362_gesture_orientation[3][2] =
+{
+    {ADXL362_GESTURE_ORIENTATION_LANDSCAPE_LEFT, ADXL362_GESTURE_ORIENTATION_LANDSCAPE_RIGHT},
+    {ADXL362_GESTURE_ORIENTATION_PORTRAIT, ADXL362_GESTURE_ORIENTATION_PORTRAIT_FLIP},
+    {ADXL362_GESTURE_ORIENTATION_FACE_UP, ADXL362_GESTURE_ORIENTATION_FACE_DOWN},
+};
+
+/**
+ * @brief     hand an event to the callback
+ * @param[in] *handle pointer to an adxl362 gesture handle structure
+ * @param[in] type event type
+ * @param[in] sample sample index of the event
+ * @param[in] axis event axis
+ * @param[in] sign event direction
+ * @param[in] peak event peak in mg
+ * @note      none
+ */
+static void a_adxl362_gesture_emit(adxl362_gesture_handle_t *handle, adxl362_gesture_event_type_t type,
+                                   uint32_t sample, uint8_t axis, int8_t sign, uint16_t peak)
+{
+    handle->event.type = type;                                                             /* set the type */
+    handle->event.sample = sample;                                                         /* set the sample index */
+    handle->event.axis = axis;                                                             /* set the axis */
+    handle->event.sign = sign;                                                             /* set the direction */
+    handle->event.peak_mg = peak;                                                          /* set the peak */
+    handle->event.orientation = handle->orientation;                                       /* set the orientation */
+    if (handle->receive_callback != NULL)                                                  /* check the callback */
+    {
+        handle->receive_callback(&handle->event);                                          /* run the callback */
+    }
+}
+
+/**
+ * @brief     run the tap state machine for one sample
+ * @param[in] *handle pointer to an adxl362 gesture handle structure
+ * @param[in] peak largest deviation from the baseline in mg
+ * @param[in] axis axis of the peak
+ * @param[in] sign direction of the peak
+ * @note      a tap is a run above the threshold no longer than tap_duration, a second tap
+ *            starting inside the window after the latency is a double tap
+ */
+static void a_adxl362_gesture_tap(adxl362_gesture_handle_t *handle, int32_t peak, uint8_t axis, int8_t sign)
+{
+    uint32_t since;
+    
+    if (handle->tap_state == ADXL362_GESTURE_TAP_ABOVE)                                    /* a tap is running */
+    {
+        if (peak < (int32_t)handle->config.tap_mg)                                         /* the tap ends */
+        {
+            handle->tap_state = ADXL362_GESTURE_TAP_IDLE;                                  /* idle */
+            handle->tap_end = handle->sample;                                              /* set the end */
+            if (handle->tap_pending != 0)                                                  /* the second tap */
+            {
+                handle->tap_pending = 0;                                                   /* done */
+                a_adxl362_gesture_emit(handle, ADXL362_GESTURE_EVENT_DOUBLE_TAP, handle->tap_start,
+                                       handle->tap_axis, handle->tap_sign, handle->tap_peak);  /* double tap */
+            }
+            else
+            {
+                handle->tap_pending = (handle->config.tap_window != 0) ? 1 : 0;            /* wait for a second tap */
+                a_adxl362_gesture_emit(handle, ADXL362_GESTURE_EVENT_SINGLE_TAP, handle->tap_start,
+                                       handle->tap_axis, handle->tap_sign, handle->tap_peak);  /* single tap */
+            }
+        }
+        else if (handle->sample - handle->tap_start >= handle->config.tap_duration)        /* too long */
+        {
+            handle->tap_state = ADXL362_GESTURE_TAP_IGNORE;                                /* not a tap */
+            handle->tap_pending = 0;                                                       /* cancel the double tap */
+        }
+        else if (peak > (int32_t)handle->tap_peak)                                         /* a higher peak */
+        {
+            handle->tap_peak = (uint16_t)peak;                                             /* set the peak */
+            handle->tap_axis = axis;                                                       /* set the axis */
+            handle->tap_sign = sign;                                                       /* set the direction */
+        }
+        
+        return;                                                                            /* return */
+    }
+    
+    since = handle->sample - handle->tap_end;                                              /* samples since the last tap */
+    if ((handle->tap_pending != 0) &&
+        (since >= (uint32_t)handle->config.tap_latency + handle->config.tap_window))       /* the window is over */
+    {
+        handle->tap_pending = 0;                                                           /* expire */
+    }
+    if (peak < (int32_t)handle->config.tap_mg)                                             /* below the threshold */
+    {
+        handle->tap_state = ADXL362_GESTURE_TAP_IDLE;                                      /* idle */
+    }
+    else if ((handle->tap_state == ADXL362_GESTURE_TAP_IDLE) &&
+             ((handle->tap_pending == 0) || (since >= handle->config.tap_latency)))        /* a new tap */
+    {
+        handle->tap_state = ADXL362_GESTURE_TAP_ABOVE;                                     /* run */
+        handle->tap_start = handle->sample;                                                /* set the start */
+        handle->tap_peak = (uint16_t)peak;                                                 /* set the peak */
+        handle->tap_axis = axis;                                                           /* set the axis */
+        handle->tap_sign = sign;                                                           /* set the direction */
+    }
+    else
+    {
+        handle->tap_state = ADXL362_GESTURE_TAP_IGNORE;                                    /* ringing in the latency */
+    }
+}
+
+/**
+ * @brief     run the orientation debounce for one sample
+ * @param[in] *handle pointer to an adxl362 gesture handle structure
+ * @note      the up axis needs orientation_mg of gravity, between the cones the last
+ *            orientation is kept
+ */
+static void a_adxl362_gesture_orientation(adxl362_gesture_handle_t *handle)
+{
+    uint8_t axis;
+    uint8_t k;
+    int32_t g;
+    int32_t abs_g;
+    int32_t best;
+    adxl362_gesture_orientation_t candidate;
+    
+    axis = 0;                                                                              /* x first */
+    best = -1;                                                                             /* no axis yet */
+    g = 0;                                                                                 /* init 0 */
+    for (k = 0; k < 3; k++)                                                                /* all axes */
+    {
+        int32_t v;
+        
+        v = handle->baseline[k] >> handle->config.baseline_shift;                          /* gravity in mg */
+        abs_g = v < 0 ? -v : v;                                                            /* magnitude */
+        if (abs_g > best)                                                                  /* larger */
+        {
+            best = abs_g;                                                                  /* set the best */
+            axis = k;                                                                      /* set the axis */
+            g = v;                                                                         /* set the gravity */
+        }
+    }
+    if (best >= (int32_t)handle->config.orientation_mg)                                    /* inside a cone */
+    {
+        candidate = gsc_adxl362_gesture_orientation[axis][g < 0 ? 1 : 0];                  /* get the orientation */
+    }
+    else
+    {
+        candidate = handle->orientation;                                                   /* keep the last one */
+    }
+    if (candidate == handle->orientation)                                                  /* no change */
+    {
+        handle->candidate = candidate;                                                     /* reset the candidate */
+        handle->candidate_count = 0;                                                       /* reset the count */
+        
+        return;                                                                            /* return */
+    }
+    if (candidate != handle->candidate)                                                    /* a new candidate */
+    {
+        handle->candidate = candidate;                                                     /* set the candidate */
+        handle->candidate_count = 0;                                                       /* reset the count */
+    }
+    handle->candidate_count++;                                                             /* count */
+    if (handle->candidate_count >= handle->config.orientation_time)                        /* held long enough */
+    {
+        handle->orientation = candidate;                                                   /* set the orientation */
+        a_adxl362_gesture_emit(handle, ADXL362_GESTURE_EVENT_ORIENTATION,
+                               handle->sample + 1 - handle->candidate_count,
+                               axis, (int8_t)(g < 0 ? -1 : 1), (uint16_t)best);            /* orientation change */
+        handle->candidate_count = 0;                                                       /* reset the count */
+    }
+}
+
+/**
+ * @brief     initialize the gesture detector
+ * @param[in] *handle pointer to an adxl362 gesture handle structure
+ * @param[in] *config pointer to a config structure
+ * @param[in] *callback pointer to an event callback function
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 tap config is invalid
+ *            - 5 orientation config is invalid
+ *            - 6 baseline shift is invalid
+ * @note      0 < tap_mg <= 16000, 0 < tap_duration, 708 <= orientation_mg <= 1000 so the
+ *            cones of the six orientations never overlap, 0 < baseline_shift <= 10
+ */
+uint8_t adxl362_gesture_init(adxl362_gesture_handle_t *handle, const adxl362_gesture_config_t *config,
+                             void (*callback)(const adxl362_gesture_event_t *event))
+{
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if ((config == NULL) || (config->tap_mg == 0) || (config->tap_mg > 16000) ||
+        (config->tap_duration == 0))                                                       /* check the tap config */
+    {
+        return 4;                                                                          /* return error */
+    }
+    if ((config->orientation_mg < 708) || (config->orientation_mg > 1000))                 /* check the orientation config */
+    {
+        return 5;                                                                          /* return error */
+    }
+    if ((config->baseline_shift == 0) || (config->baseline_shift > 10))                    /* check the baseline shift */
+    {
+        return 6;                                                                          /* return error */
+    }
+    
+    memset(handle, 0, sizeof(adxl362_gesture_handle_t));                                   /* clear the handle */
+    handle->receive_callback = callback;                                                   /* set the callback */
+    handle->config = *config;                                                              /* set the config */
+    handle->tap_state = ADXL362_GESTURE_TAP_IDLE;                                          /* idle */
+    handle->orientation = ADXL362_GESTURE_ORIENTATION_UNKNOWN;                             /* not settled */
+    handle->candidate = ADXL362_GESTURE_ORIENTATION_UNKNOWN;                               /* no candidate */
+    handle->inited = 1;                                                                    /* flag finish initialization */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     run the gesture detector over raw samples
+ * @param[in] *handle pointer to an adxl362 gesture handle structure
+ * @param[in] *x pointer to an x axis raw buffer
+ * @param[in] *y pointer to a y axis raw buffer
+ * @param[in] *z pointer to a z axis raw buffer
+ * @param[in] len buffer length
+ * @param[in] range range of the raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      feed whole fifo blocks read on the watermark interrupt, the events carry the
+ *            sample index so their timing does not depend on when the block is read,
+ *            a single tap is raised at once and a double tap is raised on the second tap
+ */
+uint8_t adxl362_gesture_update(adxl362_gesture_handle_t *handle, const int16_t *x, const int16_t *y,
+                               const int16_t *z, uint16_t len, adxl362_range_t range)
+{
+    uint16_t i;
+    uint8_t k;
+    uint8_t shift;
+    uint8_t axis;
+    int8_t sign;
+    int32_t mg[3];
+    int32_t d[3];
+    int32_t peak;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    shift = handle->config.baseline_shift;                                                 /* get the shift */
+    for (i = 0; i < len; i++)                                                              /* all samples */
+    {
+        mg[0] = (int32_t)x[i] * (1 << range);                                              /* x in mg */
+        mg[1] = (int32_t)y[i] * (1 << range);                                              /* y in mg */
+        mg[2] = (int32_t)z[i] * (1 << range);                                              /* z in mg */
+        if (handle->primed == 0)                                                           /* first sample */
+        {
+            for (k = 0; k < 3; k++)                                                        /* all axes */
+            {
+                handle->baseline[k] = mg[k] * (1 << shift);                                /* start from the sample */
+            }
+            handle->primed = 1;                                                            /* primed */
+        }
+        peak = -1;                                                                         /* no peak yet */
+        axis = 0;                                                                          /* x first */
+        sign = 1;                                                                          /* positive */
+        for (k = 0; k < 3; k++)                                                            /* all axes */
+        {
+            int32_t abs_d;
+            
+            d[k] = mg[k] - (handle->baseline[k] >> shift);                                 /* deviation from the baseline */
+            abs_d = d[k] < 0 ? -d[k] : d[k];                                               /* magnitude */
+            if (abs_d > peak)                                                              /* larger */
+            {
+                peak = abs_d;                                                              /* set the peak */
+                axis = k;                                                                  /* set the axis */
+                sign = (int8_t)(d[k] < 0 ? -1 : 1);                                        /* set the direction */
+            }
+        }
+        a_adxl362_gesture_tap(handle, peak, axis, sign);                                   /* taps */
+        if (handle->tap_state != ADXL362_GESTURE_TAP_ABOVE)                                /* hold the baseline during a tap */
+        {
+            for (k = 0; k < 3; k++)                                                        /* all axes */
+            {
+                handle->baseline[k] += d[k];                                               /* track gravity */
+            }
+        }
+        a_adxl362_gesture_orientation(handle);                                             /* orientation */
+        handle->sample++;                                                                  /* next sample */
+    }
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     run the gesture detector over a fifo block
+ * @param[in] *handle pointer to an adxl362 gesture handle structure
+ * @param[in] *block pointer to a block read by adxl362_read_fifo_block
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 block is NULL
+ * @note      none
+ */
+uint8_t adxl362_gesture_update_block(adxl362_gesture_handle_t *handle, const adxl362_block_t *block)
+{
+    if (block == NULL)                                                                     /* check the block */
+    {
+        return 4;                                                                          /* return error */
+    }
+    
+    return adxl362_gesture_update(handle, block->x, block->y, block->z, block->len, block->range);     /* update */
+}
+
+/**
+ * @brief      get the current orientation
+ * @param[in]  *handle pointer to an adxl362 gesture handle structure
+ * @param[out] *orientation pointer to an orientation buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t adxl362_gesture_get_orientation(adxl362_gesture_handle_t *handle, adxl362_gesture_orientation_t *orientation)
+{
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    *orientation = handle->orientation;                                                    /* get the orientation */
+    
+    return 0;                                                                              /* success return 0 */
+}
@@ -0,0 +1,199 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_gesture.h
+ * @brief     driver adxl362 gesture header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADXL362_GESTURE_H
+#define DRIVER_ADXL362_GESTURE_H
+
+#include "driver_adxl362.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup adxl362_gesture_driver adxl362 gesture driver function
+ * @brief    adxl362 gesture driver modules
+ * @ingroup  adxl362_driver
+ * @{
+ */
+
+/**
+ * @brief adxl362 gesture event type enumeration definition
+ */
+typedef enum
+{
+    ADXL362_GESTURE_EVENT_SINGLE_TAP  = 0x00,        /**< single tap */
+    ADXL362_GESTURE_EVENT_DOUBLE_TAP  = 0x01,        /**< second tap inside the window */
+    ADXL362_GESTURE_EVENT_ORIENTATION = 0x02,        /**< orientation change */
+} adxl362_gesture_event_type_t;
+
+/**
+ * @brief adxl362 gesture orientation enumeration definition
+ * @note  named by the axis that reads +1g or -1g, remap them for the mounting of the board
+ */
+typedef enum
+{
+    ADXL362_GESTURE_ORIENTATION_UNKNOWN         = 0x00,        /**< not settled yet */
+    ADXL362_GESTURE_ORIENTATION_PORTRAIT        = 0x01,        /**< +y up */
+    ADXL362_GESTURE_ORIENTATION_PORTRAIT_FLIP   = 0x02,        /**< -y up */
+    ADXL362_GESTURE_ORIENTATION_LANDSCAPE_LEFT  = 0x03,        /**< +x up */
+    ADXL362_GESTURE_ORIENTATION_LANDSCAPE_RIGHT = 0x04,        /**< -x up */
+    ADXL362_GESTURE_ORIENTATION_FACE_UP         = 0x05,        /**< +z up */
+    ADXL362_GESTURE_ORIENTATION_FACE_DOWN       = 0x06,        /**< -z up */
+} adxl362_gesture_orientation_t;
+
+/**
+ * @brief adxl362 gesture config structure definition
+ * @note  the times are in samples, e.g. 50ms is 20 samples at 400Hz
+ */
+typedef struct adxl362_gesture_config_s
+{
+    uint16_t tap_mg;                  /**< tap threshold above the baseline in mg */
+    uint16_t tap_duration;            /**< max samples above the tap threshold */
+    uint16_t tap_latency;             /**< samples after a tap that are ignored */
+    uint16_t tap_window;              /**< samples after the latency in which a tap is a double tap, 0 disables it */
+    uint16_t orientation_mg;          /**< min gravity on the up axis in mg */
+    uint16_t orientation_time;        /**< samples a new orientation must hold */
+    uint8_t baseline_shift;           /**< baseline low pass time constant of 2^shift samples */
+} adxl362_gesture_config_t;
+
+/**
+ * @brief adxl362 gesture event structure definition
+ */
+typedef struct adxl362_gesture_event_s
+{
+    adxl362_gesture_event_type_t type;                  /**< event type */
+    uint32_t sample;                                    /**< sample index of the tap start or the orientation change */
+    uint8_t axis;                                       /**< tap axis, 0 x, 1 y, 2 z */
+    int8_t sign;                                        /**< tap direction, 1 or -1 */
+    uint16_t peak_mg;                                   /**< tap peak above the baseline in mg */
+    adxl362_gesture_orientation_t orientation;          /**< current orientation */
+} adxl362_gesture_event_t;
+
+/**
+ * @brief adxl362 gesture handle structure definition
+ */
+typedef struct adxl362_gesture_handle_s
+{
+    void (*receive_callback)(const adxl362_gesture_event_t *event);        /**< point to an event callback function address */
+    adxl362_gesture_config_t config;                                       /**< config */
+    int32_t baseline[3];                                                   /**< x, y, z baseline in mg * 2^shift */
+    uint8_t primed;                                                        /**< 1 if the baseline is set */
+    uint8_t tap_state;                                                     /**< tap state */
+    uint8_t tap_pending;                                                   /**< 1 while a double tap can follow */
+    uint32_t tap_start;                                                    /**< sample index of the tap start */
+    uint32_t tap_end;                                                      /**< sample index of the last tap end */
+    uint16_t tap_peak;                                                     /**< tap peak in mg */
+    uint8_t tap_axis;                                                      /**< tap axis */
+    int8_t tap_sign;                                                       /**< tap direction */
+    adxl362_gesture_orientation_t orientation;                             /**< current orientation */
+    adxl362_gesture_orientation_t candidate;                               /**< orientation waiting to hold */
+    uint32_t candidate_count;                                              /**< samples the candidate held */
+    uint32_t sample;                                                       /**< sample index */
+    adxl362_gesture_event_t event;                                         /**< event handed to the callback */
+    uint8_t inited;                                                        /**< inited flag */
+} adxl362_gesture_handle_t;
+
+/**
+ * @brief     initialize the gesture detector
+ * @param[in] *handle pointer to an adxl362 gesture handle structure
+ * @param[in] *config pointer to a config structure
+ * @param[in] *callback pointer to an event callback function
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 tap config is invalid
+ *            - 5 orientation config is invalid
+ *            - 6 baseline shift is invalid
+ * @note      0 < tap_mg <= 16000, 0 < tap_duration, 708 <= orientation_mg <= 1000 so the
+ *            cones of the six orientations never overlap, 0 < baseline_shift <= 10
+ */
+uint8_t adxl362_gesture_init(adxl362_gesture_handle_t *handle, const adxl362_gesture_config_t *config,
+                             void (*callback)(const adxl362_gesture_event_t *event));
+
+/**
+ * @brief     run the gesture detector over raw samples
+ * @param[in] *handle pointer to an adxl362 gesture handle structure
+ * @param[in] *x pointer to an x axis raw buffer
+ * @param[in] *y pointer to a y axis raw buffer
+ * @param[in] *z pointer to a z axis raw buffer
+ * @param[in] len buffer length
+ * @param[in] range range of the raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      feed whole fifo blocks read on the watermark interrupt, the events carry the
+ *            sample index so their timing does not depend on when the block is read,
+ *            a single tap is raised at once and a double tap is raised on the second tap
+ */
+uint8_t adxl362_gesture_update(adxl362_gesture_handle_t *handle, const int16_t *x, const int16_t *y,
+                               const int16_t *z, uint16_t len, adxl362_range_t range);
+
+/**
+ * @brief     run the gesture detector over a fifo block
+ * @param[in] *handle pointer to an adxl362 gesture handle structure
+ * @param[in] *block pointer to a block read by adxl362_read_fifo_block
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 block is NULL
+ * @note      none
+ */
+uint8_t adxl362_gesture_update_block(adxl362_gesture_handle_t *handle, const adxl362_block_t *block);
+
+/**
+ * @brief      get the current orientation
+ * @param[in]  *handle pointer to an adxl362 gesture handle structure
+ * @param[out] *orientation pointer to an orientation buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t adxl362_gesture_get_orientation(adxl362_gesture_handle_t *handle, adxl362_gesture_orientation_t *orientation);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
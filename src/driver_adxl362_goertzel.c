@@ -0,0 +1,472 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_goertzel.c
+ * @brief     driver adxl362 goertzel source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_adxl362_goertzel.h"
+#include <math.h>
+
+/**
+ * @brief pi definition
+ */
+#define ADXL362_GOERTZEL_PI        3.14159265358979323846        /**< pi */
+
+/**
+ * @brief adxl362 goertzel g per lsb table
+ */
+static const float gsc_adxl362_goertzel_scale[3] =
+{
+    1.0f / 1000.0f,        /**< 2g */
+    1.0f / 500.0f,         /**< 4g */
+    1.0f / 250.0f,         /**< 8g */
+};
+
+/**
+ * @brief adxl362 goertzel ug per lsb table
+ */
+static const uint32_t gsc_adxl362_goertzel_ug[3] =
+{
+    1000,        /**< 2g */
+    2000,        /**< 4g */
+    4000,        /**< 8g */
+};
+
+/**
+ * @brief     check the bank parameters
+ * @param[in] *freq pointer to a bin frequency buffer in Hz
+ * @param[in] bins bin number
+ * @param[in] odr output data rate in Hz
+ * @param[in] min_freq min bin frequency in Hz
+ * @param[in] block_len samples per block
+ * @return    status code
+ *            - 0 success
+ *            - 4 bins is invalid
+ *            - 5 frequency is invalid
+ *            - 6 block_len is invalid
+ * @note      none
+ */
+static uint8_t a_adxl362_goertzel_check(const float *freq, uint8_t bins, float odr, float min_freq, uint16_t block_len)
+{
+    uint8_t i;
+    
+    if ((freq == NULL) || (bins == 0) || (bins > ADXL362_GOERTZEL_MAX_BINS))        /* check the bins */
+    {
+        return 4;                                                                   /* return error */
+    }
+    if (!(odr > 0.0f))                                                              /* check the odr */
+    {
+        return 5;                                                                   /* return error */
+    }
+    for (i = 0; i < bins; i++)                                                      /* check all bins */
+    {
+        if (!(freq[i] > min_freq) || !(freq[i] < odr * 0.5f))                       /* check the frequency */
+        {
+            return 5;                                                               /* return error */
+        }
+    }
+    if ((block_len == 0) || (block_len > ADXL362_GOERTZEL_MAX_BLOCK))               /* check the block */
+    {
+        return 6;                                                                   /* return error */
+    }
+    
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief     run the float resonators across all bins
+ * @param[in] *handle pointer to an adxl362 goertzel handle structure
+ * @param[in] x sample in g
+ * @note      the bin loop is independent per bin and is vectorized by the compiler
+ */
+static inline void a_adxl362_goertzel_step(adxl362_goertzel_handle_t *handle, float x)
+{
+    uint8_t b;
+    float s0;
+    
+    for (b = 0; b < handle->bins; b++)                                              /* run all bins */
+    {
+        s0 = x + handle->coeff[b] * handle->s1[b] - handle->s2[b];                 /* resonator */
+        handle->s2[b] = handle->s1[b];                                              /* shift */
+        handle->s1[b] = s0;                                                         /* shift */
+    }
+}
+
+/**
+ * @brief     finish the float block
+ * @param[in] *handle pointer to an adxl362 goertzel handle structure
+ * @note      none
+ */
+static void a_adxl362_goertzel_emit(adxl362_goertzel_handle_t *handle)
+{
+    uint8_t b;
+    float p;
+    float gain;
+    
+    gain = 2.0f / (float)handle->block_len;                                         /* single sided gain */
+    for (b = 0; b < handle->bins; b++)                                              /* run all bins */
+    {
+        p = handle->s1[b] * handle->s1[b] + handle->s2[b] * handle->s2[b] - 
+            handle->coeff[b] * handle->s1[b] * handle->s2[b];                       /* power */
+        handle->amplitude[b] = sqrtf(p > 0.0f ? p : 0.0f) * gain;                  /* amplitude */
+        handle->s1[b] = 0.0f;                                                       /* reset */
+        handle->s2[b] = 0.0f;                                                       /* reset */
+    }
+    handle->count = 0;                                                              /* reset the count */
+    if (handle->receive_callback != NULL)                                           /* check the callback */
+    {
+        handle->receive_callback(handle->amplitude, handle->bins);                  /* run the callback */
+    }
+}
+
+/**
+ * @brief     initialize the float goertzel bank
+ * @param[in] *handle pointer to an adxl362 goertzel handle structure
+ * @param[in] *freq pointer to a bin frequency buffer in Hz
+ * @param[in] bins bin number
+ * @param[in] odr output data rate in Hz
+ * @param[in] block_len samples per block
+ * @param[in] *callback pointer to a block callback function
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 bins is invalid
+ *            - 5 frequency is invalid
+ *            - 6 block_len is invalid
+ * @note      0 < freq < odr / 2, 0 < bins <= 16, 0 < block_len <= 4096
+ */
+uint8_t adxl362_goertzel_init(adxl362_goertzel_handle_t *handle, const float *freq, uint8_t bins,
+                              float odr, uint16_t block_len,
+                              void (*callback)(const float *amplitude, uint8_t bins))
+{
+    uint8_t res;
+    uint8_t b;
+    
+    if (handle == NULL)                                                             /* check handle */
+    {
+        return 2;                                                                   /* return error */
+    }
+    res = a_adxl362_goertzel_check(freq, bins, odr, 0.0f, block_len);              /* check the params */
+    if (res != 0)                                                                   /* check the result */
+    {
+        return res;                                                                 /* return error */
+    }
+    
+    for (b = 0; b < ADXL362_GOERTZEL_MAX_BINS; b++)                                 /* run all bins */
+    {
+        handle->coeff[b] = 0.0f;                                                    /* clear */
+        handle->s1[b] = 0.0f;                                                       /* clear */
+        handle->s2[b] = 0.0f;                                                       /* clear */
+        handle->amplitude[b] = 0.0f;                                                /* clear */
+    }
+    for (b = 0; b < bins; b++)                                                      /* set the bins */
+    {
+        handle->coeff[b] = (float)(2.0 * cos(2.0 * ADXL362_GOERTZEL_PI * freq[b] / odr));        /* 2cos(w) */
+    }
+    handle->receive_callback = callback;                                            /* set the callback */
+    handle->block_len = block_len;                                                  /* set the block length */
+    handle->count = 0;                                                              /* init the count */
+    handle->bins = bins;                                                            /* set the bins */
+    handle->inited = 1;                                                             /* flag finish initialization */
+    
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief     update the float bank with raw samples of one axis
+ * @param[in] *handle pointer to an adxl362 goertzel handle structure
+ * @param[in] *in pointer to a raw buffer
+ * @param[in] len buffer length
+ * @param[in] range range of the raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 range is invalid
+ * @note      the callback runs once per completed block
+ */
+uint8_t adxl362_goertzel_update(adxl362_goertzel_handle_t *handle, const int16_t *in, uint16_t len,
+                                adxl362_range_t range)
+{
+    uint16_t i;
+    float scale;
+    
+    if (handle == NULL)                                                             /* check handle */
+    {
+        return 2;                                                                   /* return error */
+    }
+    if (handle->inited != 1)                                                        /* check handle initialization */
+    {
+        return 3;                                                                   /* return error */
+    }
+    if ((uint8_t)range > (uint8_t)ADXL362_RANGE_8G)                                 /* check the range */
+    {
+        return 4;                                                                   /* return error */
+    }
+    
+    scale = gsc_adxl362_goertzel_scale[range];                                      /* get the scale */
+    for (i = 0; i < len; i++)                                                       /* run all samples */
+    {
+        a_adxl362_goertzel_step(handle, (float)in[i] * scale);                      /* update all bins */
+        handle->count++;                                                            /* add the count */
+        if (handle->count >= handle->block_len)                                     /* block is full */
+        {
+            a_adxl362_goertzel_emit(handle);                                        /* emit the block */
+        }
+    }
+    
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief     update the float bank with adxl362_read_fifo frames
+ * @param[in] *handle pointer to an adxl362 goertzel handle structure
+ * @param[in] *frame pointer to a frame buffer
+ * @param[in] frame_len frame length
+ * @param[in] axis frame type to use
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the other frame types are skipped
+ */
+uint8_t adxl362_goertzel_update_frame(adxl362_goertzel_handle_t *handle, const adxl362_frame_t *frame,
+                                      uint16_t frame_len, adxl362_frame_type_t axis)
+{
+    uint16_t i;
+    
+    if (handle == NULL)                                                             /* check handle */
+    {
+        return 2;                                                                   /* return error */
+    }
+    if (handle->inited != 1)                                                        /* check handle initialization */
+    {
+        return 3;                                                                   /* return error */
+    }
+    
+    for (i = 0; i < frame_len; i++)                                                 /* run all frames */
+    {
+        if (frame[i].type != axis)                                                  /* check the type */
+        {
+            continue;                                                               /* skip */
+        }
+        a_adxl362_goertzel_step(handle, frame[i].data);                             /* update all bins */
+        handle->count++;                                                            /* add the count */
+        if (handle->count >= handle->block_len)                                     /* block is full */
+        {
+            a_adxl362_goertzel_emit(handle);                                        /* emit the block */
+        }
+    }
+    
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief     integer square root
+ * @param[in] v value
+ * @return    floor of the square root
+ * @note      none
+ */
+static uint32_t a_adxl362_goertzel_isqrt(uint64_t v)
+{
+    uint64_t r;
+    uint64_t bit;
+    
+    r = 0;                                                                          /* init 0 */
+    bit = 1ULL << 62;                                                               /* highest power of 4 */
+    while (bit > v)                                                                 /* find the start */
+    {
+        bit >>= 2;                                                                  /* next */
+    }
+    while (bit != 0)                                                                /* run all bits */
+    {
+        if (v >= r + bit)                                                           /* check the bit */
+        {
+            v -= r + bit;                                                           /* sub */
+            r = (r >> 1) + bit;                                                     /* set the bit */
+        }
+        else
+        {
+            r >>= 1;                                                                /* shift */
+        }
+        bit >>= 2;                                                                  /* next */
+    }
+    
+    return (uint32_t)r;                                                             /* return the root */
+}
+
+/**
+ * @brief     finish the int block
+ * @param[in] *handle pointer to an adxl362 goertzel int handle structure
+ * @note      none
+ */
+static void a_adxl362_goertzel_int_emit(adxl362_goertzel_int_handle_t *handle)
+{
+    uint8_t b;
+    int64_t p;
+    uint64_t a;
+    
+    for (b = 0; b < handle->bins; b++)                                              /* run all bins */
+    {
+        p = (int64_t)handle->s1[b] * handle->s1[b] + (int64_t)handle->s2[b] * handle->s2[b] - 
+            (((int64_t)handle->coeff[b] * handle->s1[b]) >> 14) * handle->s2[b];    /* power */
+        a = (uint64_t)a_adxl362_goertzel_isqrt((uint64_t)(p > 0 ? p : 0));          /* magnitude in lsb */
+        a = a * 2 * gsc_adxl362_goertzel_ug[handle->range] / handle->block_len;     /* single sided amplitude */
+        handle->amplitude_ug[b] = (uint32_t)(a > 0xFFFFFFFFULL ? 0xFFFFFFFFULL : a);        /* saturate */
+        handle->s1[b] = 0;                                                          /* reset */
+        handle->s2[b] = 0;                                                          /* reset */
+    }
+    handle->count = 0;                                                              /* reset the count */
+    if (handle->receive_callback != NULL)                                           /* check the callback */
+    {
+        handle->receive_callback(handle->amplitude_ug, handle->bins);               /* run the callback */
+    }
+}
+
+/**
+ * @brief     initialize the int goertzel bank
+ * @param[in] *handle pointer to an adxl362 goertzel int handle structure
+ * @param[in] *freq pointer to a bin frequency buffer in Hz
+ * @param[in] bins bin number
+ * @param[in] odr output data rate in Hz
+ * @param[in] block_len samples per block
+ * @param[in] *callback pointer to a block callback function
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 bins is invalid
+ *            - 5 frequency is invalid
+ *            - 6 block_len is invalid
+ * @note      the coefficients are computed once with float math, the update is integer only
+ */
+uint8_t adxl362_goertzel_int_init(adxl362_goertzel_int_handle_t *handle, const float *freq, uint8_t bins,
+                                  float odr, uint16_t block_len,
+                                  void (*callback)(const uint32_t *amplitude_ug, uint8_t bins))
+{
+    uint8_t res;
+    uint8_t b;
+    
+    if (handle == NULL)                                                             /* check handle */
+    {
+        return 2;                                                                   /* return error */
+    }
+    res = a_adxl362_goertzel_check(freq, bins, odr, odr / 256.0f, block_len);      /* lower bins would overflow the states */
+    if (res != 0)                                                                   /* check the result */
+    {
+        return res;                                                                 /* return error */
+    }
+    
+    for (b = 0; b < ADXL362_GOERTZEL_MAX_BINS; b++)                                 /* run all bins */
+    {
+        handle->coeff[b] = 0;                                                       /* clear */
+        handle->s1[b] = 0;                                                          /* clear */
+        handle->s2[b] = 0;                                                          /* clear */
+        handle->amplitude_ug[b] = 0;                                                /* clear */
+    }
+    for (b = 0; b < bins; b++)                                                      /* set the bins */
+    {
+        handle->coeff[b] = (int32_t)floor(2.0 * cos(2.0 * ADXL362_GOERTZEL_PI * freq[b] / odr) * 16384.0 + 0.5);        /* 2cos(w) in q14 */
+    }
+    handle->receive_callback = callback;                                            /* set the callback */
+    handle->range = ADXL362_RANGE_2G;                                               /* init the range */
+    handle->block_len = block_len;                                                  /* set the block length */
+    handle->count = 0;                                                              /* init the count */
+    handle->bins = bins;                                                            /* set the bins */
+    handle->inited = 1;                                                             /* flag finish initialization */
+    
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief     update the int bank with raw samples of one axis
+ * @param[in] *handle pointer to an adxl362 goertzel int handle structure
+ * @param[in] *in pointer to a raw buffer
+ * @param[in] len buffer length
+ * @param[in] range range of the raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 range is invalid
+ * @note      the callback runs once per completed block, a range change restarts the block
+ */
+uint8_t adxl362_goertzel_int_update(adxl362_goertzel_int_handle_t *handle, const int16_t *in, uint16_t len,
+                                    adxl362_range_t range)
+{
+    uint16_t i;
+    uint8_t b;
+    int32_t x;
+    int32_t s0;
+    
+    if (handle == NULL)                                                             /* check handle */
+    {
+        return 2;                                                                   /* return error */
+    }
+    if (handle->inited != 1)                                                        /* check handle initialization */
+    {
+        return 3;                                                                   /* return error */
+    }
+    if ((uint8_t)range > (uint8_t)ADXL362_RANGE_8G)                                 /* check the range */
+    {
+        return 4;                                                                   /* return error */
+    }
+    
+    if (handle->range != range)                                                     /* range changed */
+    {
+        for (b = 0; b < handle->bins; b++)                                          /* run all bins */
+        {
+            handle->s1[b] = 0;                                                      /* reset */
+            handle->s2[b] = 0;                                                      /* reset */
+        }
+        handle->count = 0;                                                          /* restart the block */
+        handle->range = range;                                                      /* set the range */
+    }
+    for (i = 0; i < len; i++)                                                       /* run all samples */
+    {
+        x = in[i];                                                                  /* get the sample */
+        for (b = 0; b < handle->bins; b++)                                          /* run all bins */
+        {
+            s0 = x + (int32_t)(((int64_t)handle->coeff[b] * handle->s1[b]) >> 14) - 
+                 handle->s2[b];                                                     /* resonator */
+            handle->s2[b] = handle->s1[b];                                          /* shift */
+            handle->s1[b] = s0;                                                     /* shift */
+        }
+        handle->count++;                                                            /* add the count */
+        if (handle->count >= handle->block_len)                                     /* block is full */
+        {
+            a_adxl362_goertzel_int_emit(handle);                                    /* emit the block */
+        }
+    }
+    
+    return 0;                                                                       /* success return 0 */
+}
@@ -0,0 +1,188 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_goertzel.h
+ * @brief     driver adxl362 goertzel header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADXL362_GOERTZEL_H
+#define DRIVER_ADXL362_GOERTZEL_H
+
+#include "driver_adxl362.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup adxl362_goertzel_driver adxl362 goertzel driver function
+ * @brief    adxl362 goertzel driver modules
+ * @ingroup  adxl362_driver
+ * @{
+ */
+
+/**
+ * @brief adxl362 goertzel definition
+ */
+#define ADXL362_GOERTZEL_MAX_BINS         16          /**< max bins of one bank */
+#define ADXL362_GOERTZEL_MAX_BLOCK        4096        /**< max samples of one block */
+
+/**
+ * @brief adxl362 goertzel handle structure definition
+ * @note  the bin states are stored as arrays so the per sample update runs across all bins at once
+ */
+typedef struct adxl362_goertzel_handle_s
+{
+    void (*receive_callback)(const float *amplitude, uint8_t bins);        /**< point to a receive_callback function address */
+    float coeff[ADXL362_GOERTZEL_MAX_BINS];                                 /**< 2cos(w) of every bin */
+    float s1[ADXL362_GOERTZEL_MAX_BINS];                                    /**< first state of every bin */
+    float s2[ADXL362_GOERTZEL_MAX_BINS];                                    /**< second state of every bin */
+    float amplitude[ADXL362_GOERTZEL_MAX_BINS];                             /**< last block amplitude in g */
+    uint16_t block_len;                                                     /**< samples per block */
+    uint16_t count;                                                         /**< samples in the current block */
+    uint8_t bins;                                                           /**< bin number */
+    uint8_t inited;                                                         /**< inited flag */
+} adxl362_goertzel_handle_t;
+
+/**
+ * @brief adxl362 goertzel int handle structure definition
+ */
+typedef struct adxl362_goertzel_int_handle_s
+{
+    void (*receive_callback)(const uint32_t *amplitude_ug, uint8_t bins);  /**< point to a receive_callback function address */
+    int32_t coeff[ADXL362_GOERTZEL_MAX_BINS];                               /**< 2cos(w) of every bin in q14 */
+    int32_t s1[ADXL362_GOERTZEL_MAX_BINS];                                  /**< first state of every bin */
+    int32_t s2[ADXL362_GOERTZEL_MAX_BINS];                                  /**< second state of every bin */
+    uint32_t amplitude_ug[ADXL362_GOERTZEL_MAX_BINS];                       /**< last block amplitude in ug */
+    adxl362_range_t range;                                                  /**< range of the current block */
+    uint16_t block_len;                                                     /**< samples per block */
+    uint16_t count;                                                         /**< samples in the current block */
+    uint8_t bins;                                                           /**< bin number */
+    uint8_t inited;                                                         /**< inited flag */
+} adxl362_goertzel_int_handle_t;
+
+/**
+ * @brief     initialize the float goertzel bank
+ * @param[in] *handle pointer to an adxl362 goertzel handle structure
+ * @param[in] *freq pointer to a bin frequency buffer in Hz
+ * @param[in] bins bin number
+ * @param[in] odr output data rate in Hz
+ * @param[in] block_len samples per block
+ * @param[in] *callback pointer to a block callback function
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 bins is invalid
+ *            - 5 frequency is invalid
+ *            - 6 block_len is invalid
+ * @note      0 < freq < odr / 2, 0 < bins <= 16, 0 < block_len <= 4096
+ */
+uint8_t adxl362_goertzel_init(adxl362_goertzel_handle_t *handle, const float *freq, uint8_t bins,
+                              float odr, uint16_t block_len,
+                              void (*callback)(const float *amplitude, uint8_t bins));
+
+/**
+ * @brief     update the float bank with raw samples of one axis
+ * @param[in] *handle pointer to an adxl362 goertzel handle structure
+ * @param[in] *in pointer to a raw buffer
+ * @param[in] len buffer length
+ * @param[in] range range of the raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 range is invalid
+ * @note      the callback runs once per completed block
+ */
+uint8_t adxl362_goertzel_update(adxl362_goertzel_handle_t *handle, const int16_t *in, uint16_t len,
+                                adxl362_range_t range);
+
+/**
+ * @brief     update the float bank with adxl362_read_fifo frames
+ * @param[in] *handle pointer to an adxl362 goertzel handle structure
+ * @param[in] *frame pointer to a frame buffer
+ * @param[in] frame_len frame length
+ * @param[in] axis frame type to use
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the other frame types are skipped
+ */
+uint8_t adxl362_goertzel_update_frame(adxl362_goertzel_handle_t *handle, const adxl362_frame_t *frame,
+                                      uint16_t frame_len, adxl362_frame_type_t axis);
+
+/**
+ * @brief     initialize the int goertzel bank
+ * @param[in] *handle pointer to an adxl362 goertzel int handle structure
+ * @param[in] *freq pointer to a bin frequency buffer in Hz
+ * @param[in] bins bin number
+ * @param[in] odr output data rate in Hz
+ * @param[in] block_len samples per block
+ * @param[in] *callback pointer to a block callback function
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 bins is invalid
+ *            - 5 frequency is invalid
+ *            - 6 block_len is invalid
+ * @note      the coefficients are computed once with float math, the update is integer only
+ */
+uint8_t adxl362_goertzel_int_init(adxl362_goertzel_int_handle_t *handle, const float *freq, uint8_t bins,
+                                  float odr, uint16_t block_len,
+                                  void (*callback)(const uint32_t *amplitude_ug, uint8_t bins));
+
+/**
+ * @brief     update the int bank with raw samples of one axis
+ * @param[in] *handle pointer to an adxl362 goertzel int handle structure
+ * @param[in] *in pointer to a raw buffer
+ * @param[in] len buffer length
+ * @param[in] range range of the raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 range is invalid
+ * @note      the callback runs once per completed block, a range change restarts the block
+ */
+uint8_t adxl362_goertzel_int_update(adxl362_goertzel_int_handle_t *handle, const int16_t *in, uint16_t len,
+                                    adxl362_range_t range);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,665 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_histogram.c
+ * @brief     driver adxl362 histogram source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_adxl362_histogram.h"
+#include <math.h>
+#include <string.h>
+
+/**
+ * @brief adxl362 histogram definition
+ */
+#define ADXL362_HISTOGRAM_VERSION        1         /**< export version */
+#define ADXL362_HISTOGRAM_CHUNK          64        /**< squared magnitudes per pass */
+
+/**
+ * @brief adxl362 histogram export magic
+ */
+static const uint8_t gsc_adxl362_histogram_magic[4] = {'A', 'X', 'H', 'G'};        /**< export magic */
+
+/**
+ * @brief adxl362 histogram msb of a nibble table
+ */
+static const uint8_t gsc_adxl362_histogram_msb[16] =
+{
+    0, 0, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+/**
+ * @brief     get the bucket of a squared magnitude
+ * @param[in] v squared magnitude in mg^2
+ * @return    bucket index
+ * @note      the top 6 bits of v pick the bucket inside its power of two
+ */
+static uint16_t a_adxl362_histogram_index(uint32_t v)
+{
+    uint32_t t;
+    uint16_t e;
+    uint16_t i;
+    
+    if (v < (2U << ADXL362_HISTOGRAM_SUB_BITS))                                            /* exact buckets */
+    {
+        return (uint16_t)v;                                                                /* return the value */
+    }
+    t = v;                                                                                 /* copy */
+    e = 0;                                                                                 /* init 0 */
+    if (t >= (1U << 16))                                                                   /* check the high half */
+    {
+        t >>= 16;                                                                          /* shift */
+        e += 16;                                                                           /* add */
+    }
+    if (t >= (1U << 8))                                                                    /* check the high byte */
+    {
+        t >>= 8;                                                                           /* shift */
+        e += 8;                                                                            /* add */
+    }
+    if (t >= (1U << 4))                                                                    /* check the high nibble */
+    {
+        t >>= 4;                                                                           /* shift */
+        e += 4;                                                                            /* add */
+    }
+    e = (uint16_t)(e + gsc_adxl362_histogram_msb[t] - ADXL362_HISTOGRAM_SUB_BITS);         /* shift of the power of two */
+    i = (uint16_t)((e << ADXL362_HISTOGRAM_SUB_BITS) + (v >> e));                          /* bucket */
+    
+    return i < ADXL362_HISTOGRAM_BUCKETS ? i : (ADXL362_HISTOGRAM_BUCKETS - 1);            /* clamp */
+}
+
+/**
+ * @brief     get the magnitude of a bucket
+ * @param[in] *handle pointer to an adxl362 histogram handle structure
+ * @param[in] i bucket index
+ * @return    magnitude in mg
+ * @note      the middle of the bucket clamped to the min and max
+ */
+static float a_adxl362_histogram_value(adxl362_histogram_handle_t *handle, uint16_t i)
+{
+    uint32_t shift;
+    float lo;
+    float v;
+    
+    if (i < (2U << ADXL362_HISTOGRAM_SUB_BITS))                                            /* exact buckets */
+    {
+        v = (float)i;                                                                      /* the value */
+    }
+    else
+    {
+        shift = (uint32_t)(i >> ADXL362_HISTOGRAM_SUB_BITS) - 1;                           /* bucket shift */
+        lo = (float)(((uint32_t)(i & ((1U << ADXL362_HISTOGRAM_SUB_BITS) - 1)) + 
+                      (1U << ADXL362_HISTOGRAM_SUB_BITS)) << shift);                       /* low edge */
+        v = lo + (float)((1U << shift) - 1) * 0.5f;                                        /* middle */
+    }
+    v = v > (float)handle->min_sq ? v : (float)handle->min_sq;                             /* clamp to the min */
+    v = v < (float)handle->max_sq ? v : (float)handle->max_sq;                             /* clamp to the max */
+    
+    return sqrtf(v);                                                                       /* mg */
+}
+
+/**
+ * @brief     get the value of a nearest rank
+ * @param[in] *handle pointer to an adxl362 histogram handle structure
+ * @param[in] percent percentile
+ * @param[in] *i pointer to a bucket index
+ * @param[in] *cum pointer to a cumulative count
+ * @return    magnitude in mg
+ * @note      the walk goes on from i and cum so ascending ranks take one pass
+ */
+static float a_adxl362_histogram_rank(adxl362_histogram_handle_t *handle, float percent, uint16_t *i, uint32_t *cum)
+{
+    uint32_t rank;
+    float r;
+    
+    r = ceilf(percent * 0.01f * (float)handle->count);                                     /* nearest rank */
+    rank = (r < 1.0f) ? 1 : ((r > (float)handle->count) ? handle->count : (uint32_t)r);    /* clamp */
+    if (rank == 1)                                                                         /* the smallest */
+    {
+        return sqrtf((float)handle->min_sq);                                               /* exact min */
+    }
+    if (rank == handle->count)                                                             /* the largest */
+    {
+        return sqrtf((float)handle->max_sq);                                               /* exact max */
+    }
+    while ((*i < ADXL362_HISTOGRAM_BUCKETS) && (*cum + handle->bucket[*i] < rank))         /* find the bucket */
+    {
+        *cum += handle->bucket[*i];                                                        /* add the bucket */
+        (*i)++;                                                                            /* next bucket */
+    }
+    
+    return a_adxl362_histogram_value(handle, *i);                                          /* bucket value */
+}
+
+/**
+ * @brief      write a varint
+ * @param[out] *out pointer to an output buffer
+ * @param[in]  size output buffer size
+ * @param[in]  *pos pointer to a position
+ * @param[in]  v value
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is full
+ * @note       7 bits per byte, low bits first
+ */
+static uint8_t a_adxl362_histogram_put(uint8_t *out, uint16_t size, uint16_t *pos, uint32_t v)
+{
+    do
+    {
+        if (*pos >= size)                                                                  /* check the size */
+        {
+            return 1;                                                                      /* return error */
+        }
+        out[(*pos)++] = (uint8_t)((v & 0x7F) | (v > 0x7F ? 0x80 : 0x00));                  /* set the byte */
+        v >>= 7;                                                                           /* next bits */
+    } while (v != 0);
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief      read a varint
+ * @param[in]  *in pointer to an input buffer
+ * @param[in]  size input buffer size
+ * @param[in]  *pos pointer to a position
+ * @param[out] *v pointer to a value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 varint is invalid
+ * @note       at most 5 bytes
+ */
+static uint8_t a_adxl362_histogram_get(const uint8_t *in, uint16_t size, uint16_t *pos, uint32_t *v)
+{
+    uint8_t shift;
+    uint8_t b;
+    
+    *v = 0;                                                                                /* init 0 */
+    for (shift = 0; shift < 35; shift += 7)                                                /* at most 5 bytes */
+    {
+        if (*pos >= size)                                                                  /* check the size */
+        {
+            return 1;                                                                      /* return error */
+        }
+        b = in[(*pos)++];                                                                  /* get the byte */
+        if ((shift == 28) && (b > 0x0F))                                                   /* check the top bits */
+        {
+            return 1;                                                                      /* return error */
+        }
+        *v |= (uint32_t)(b & 0x7F) << shift;                                               /* add the bits */
+        if ((b & 0x80) == 0)                                                               /* last byte */
+        {
+            return 0;                                                                      /* success return 0 */
+        }
+    }
+    
+    return 1;                                                                              /* return error */
+}
+
+/**
+ * @brief     crc16 ccitt
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    crc
+ * @note      none
+ */
+static uint16_t a_adxl362_histogram_crc16(const uint8_t *buf, uint16_t len)
+{
+    uint16_t i;
+    uint8_t j;
+    uint16_t crc;
+    
+    crc = 0xFFFF;                                                                          /* init */
+    for (i = 0; i < len; i++)                                                              /* all bytes */
+    {
+        crc ^= (uint16_t)buf[i] << 8;                                                      /* add the byte */
+        for (j = 0; j < 8; j++)                                                            /* all bits */
+        {
+            crc = (crc & 0x8000) != 0 ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);    /* shift */
+        }
+    }
+    
+    return crc;                                                                            /* return the crc */
+}
+
+/**
+ * @brief     initialize the histogram
+ * @param[in] *handle pointer to an adxl362 histogram handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      none
+ */
+uint8_t adxl362_histogram_init(adxl362_histogram_handle_t *handle)
+{
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    
+    memset(handle, 0, sizeof(adxl362_histogram_handle_t));                                 /* clear the handle */
+    handle->min_sq = 0xFFFFFFFFU;                                                          /* no min */
+    handle->inited = 1;                                                                    /* flag finish initialization */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     clear the histogram
+ * @param[in] *handle pointer to an adxl362 histogram handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      call it after the upload to start the next period
+ */
+uint8_t adxl362_histogram_clear(adxl362_histogram_handle_t *handle)
+{
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    return adxl362_histogram_init(handle);                                                 /* init again */
+}
+
+/**
+ * @brief     add raw samples
+ * @param[in] *handle pointer to an adxl362 histogram handle structure
+ * @param[in] *x pointer to an x axis raw buffer
+ * @param[in] *y pointer to a y axis raw buffer
+ * @param[in] *z pointer to a z axis raw buffer
+ * @param[in] len buffer length
+ * @param[in] range range of the raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the bucket comes from the integer squared magnitude, there is no sqrt per sample
+ */
+uint8_t adxl362_histogram_update(adxl362_histogram_handle_t *handle, const int16_t *x, const int16_t *y,
+                                 const int16_t *z, uint16_t len, adxl362_range_t range)
+{
+    uint16_t i;
+    uint16_t j;
+    uint16_t n;
+    uint32_t shift;
+    uint32_t lo;
+    uint32_t hi;
+    uint32_t sq[ADXL362_HISTOGRAM_CHUNK];
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    shift = (uint32_t)range * 2;                                                           /* mg^2 per lsb^2 */
+    for (i = 0; i < len; i += n)                                                           /* all chunks */
+    {
+        n = (uint16_t)(len - i) < ADXL362_HISTOGRAM_CHUNK ? (uint16_t)(len - i) : ADXL362_HISTOGRAM_CHUNK;        /* chunk length */
+        for (j = 0; j < n; j++)                                                            /* squared magnitudes */
+        {
+            sq[j] = (uint32_t)((int32_t)x[i + j] * x[i + j] + (int32_t)y[i + j] * y[i + j] + 
+                               (int32_t)z[i + j] * z[i + j]) << shift;                     /* mg^2 */
+        }
+        lo = handle->min_sq;                                                               /* get the min */
+        hi = handle->max_sq;                                                               /* get the max */
+        for (j = 0; j < n; j++)                                                            /* min and max */
+        {
+            lo = sq[j] < lo ? sq[j] : lo;                                                  /* min */
+            hi = sq[j] > hi ? sq[j] : hi;                                                  /* max */
+        }
+        handle->min_sq = lo;                                                               /* set the min */
+        handle->max_sq = hi;                                                               /* set the max */
+        for (j = 0; j < n; j++)                                                            /* all samples */
+        {
+            handle->bucket[a_adxl362_histogram_index(sq[j])]++;                            /* count */
+        }
+        handle->count += n;                                                                /* add the samples */
+    }
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     add a fifo block
+ * @param[in] *handle pointer to an adxl362 histogram handle structure
+ * @param[in] *block pointer to a block read by adxl362_read_fifo_block
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 block is NULL
+ * @note      none
+ */
+uint8_t adxl362_histogram_update_block(adxl362_histogram_handle_t *handle, const adxl362_block_t *block)
+{
+    if (block == NULL)                                                                     /* check the block */
+    {
+        return 4;                                                                          /* return error */
+    }
+    
+    return adxl362_histogram_update(handle, block->x, block->y, block->z, block->len, block->range);        /* update */
+}
+
+/**
+ * @brief     merge a histogram into another
+ * @param[in] *handle pointer to an adxl362 histogram handle structure
+ * @param[in] *src pointer to an adxl362 histogram handle structure to add
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the result is the same as adding the samples of both, e.g. windows or sensors
+ */
+uint8_t adxl362_histogram_merge(adxl362_histogram_handle_t *handle, const adxl362_histogram_handle_t *src)
+{
+    uint16_t i;
+    
+    if ((handle == NULL) || (src == NULL))                                                 /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if ((handle->inited != 1) || (src->inited != 1))                                       /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    for (i = 0; i < ADXL362_HISTOGRAM_BUCKETS; i++)                                        /* all buckets */
+    {
+        handle->bucket[i] += src->bucket[i];                                               /* add */
+    }
+    handle->count += src->count;                                                           /* add the count */
+    handle->min_sq = src->min_sq < handle->min_sq ? src->min_sq : handle->min_sq;          /* min */
+    handle->max_sq = src->max_sq > handle->max_sq ? src->max_sq : handle->max_sq;          /* max */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief      get a percentile
+ * @param[in]  *handle pointer to an adxl362 histogram handle structure
+ * @param[in]  percent percentile
+ * @param[out] *mg pointer to a magnitude buffer in mg
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 percent is invalid
+ *             - 5 histogram is empty
+ * @note       0 <= percent <= 100, nearest rank, 0 and 100 give the exact min and max
+ */
+uint8_t adxl362_histogram_get_percentile(adxl362_histogram_handle_t *handle, float percent, float *mg)
+{
+    uint16_t i;
+    uint32_t cum;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    if (!((percent >= 0.0f) && (percent <= 100.0f)))                                       /* check the percent */
+    {
+        return 4;                                                                          /* return error */
+    }
+    if (handle->count == 0)                                                                /* check the count */
+    {
+        return 5;                                                                          /* return error */
+    }
+    
+    i = 0;                                                                                 /* first bucket */
+    cum = 0;                                                                               /* init 0 */
+    *mg = a_adxl362_histogram_rank(handle, percent, &i, &cum);                             /* get the value */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief      get the summary
+ * @param[in]  *handle pointer to an adxl362 histogram handle structure
+ * @param[out] *summary pointer to a summary buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 histogram is empty
+ * @note       the percentiles come from one pass over the buckets
+ */
+uint8_t adxl362_histogram_get_summary(adxl362_histogram_handle_t *handle, adxl362_histogram_summary_t *summary)
+{
+    uint16_t i;
+    uint32_t cum;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    if (handle->count == 0)                                                                /* check the count */
+    {
+        return 4;                                                                          /* return error */
+    }
+    
+    i = 0;                                                                                 /* first bucket */
+    cum = 0;                                                                               /* init 0 */
+    summary->count = handle->count;                                                        /* set the count */
+    summary->min = sqrtf((float)handle->min_sq);                                           /* set the min */
+    summary->p50 = a_adxl362_histogram_rank(handle, 50.0f, &i, &cum);                      /* set the median */
+    summary->p95 = a_adxl362_histogram_rank(handle, 95.0f, &i, &cum);                      /* set the p95 */
+    summary->p99 = a_adxl362_histogram_rank(handle, 99.0f, &i, &cum);                      /* set the p99 */
+    summary->max = sqrtf((float)handle->max_sq);                                           /* set the max */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief      export the histogram
+ * @param[in]  *handle pointer to an adxl362 histogram handle structure
+ * @param[out] *out pointer to an output buffer
+ * @param[in]  size output buffer size
+ * @param[out] *out_len pointer to an exported length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 output buffer is too small
+ * @note       little endian, magic "AXHG", version, sub bucket bits, crc16 ccitt of the payload,
+ *             used buckets, then varints of the min, the max and the index gap and count of
+ *             every used bucket, a size of ADXL362_HISTOGRAM_MAX_SIZE always fits
+ */
+uint8_t adxl362_histogram_export(adxl362_histogram_handle_t *handle, uint8_t *out, uint16_t size, uint16_t *out_len)
+{
+    uint16_t i;
+    uint16_t pos;
+    uint16_t last;
+    uint16_t used;
+    uint16_t crc;
+    uint8_t res;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    if (size < ADXL362_HISTOGRAM_HEADER_SIZE)                                              /* check the size */
+    {
+        return 4;                                                                          /* return error */
+    }
+    
+    used = 0;                                                                              /* init 0 */
+    for (i = 0; i < ADXL362_HISTOGRAM_BUCKETS; i++)                                        /* all buckets */
+    {
+        used += (handle->bucket[i] != 0) ? 1 : 0;                                          /* count the used */
+    }
+    memcpy(out, gsc_adxl362_histogram_magic, 4);                                           /* set the magic */
+    out[4] = ADXL362_HISTOGRAM_VERSION;                                                    /* set the version */
+    out[5] = ADXL362_HISTOGRAM_SUB_BITS;                                                   /* set the sub bucket bits */
+    out[8] = (uint8_t)(used & 0xFF);                                                       /* low byte */
+    out[9] = (uint8_t)(used >> 8);                                                         /* high byte */
+    pos = ADXL362_HISTOGRAM_HEADER_SIZE;                                                   /* payload */
+    res = a_adxl362_histogram_put(out, size, &pos, (used != 0) ? handle->min_sq : 0);      /* set the min */
+    res |= a_adxl362_histogram_put(out, size, &pos, handle->max_sq);                       /* set the max */
+    last = 0;                                                                              /* init 0 */
+    for (i = 0; (i < ADXL362_HISTOGRAM_BUCKETS) && (res == 0); i++)                        /* all buckets */
+    {
+        if (handle->bucket[i] != 0)                                                        /* used */
+        {
+            res |= a_adxl362_histogram_put(out, size, &pos, (uint32_t)(i - last));         /* set the gap */
+            res |= a_adxl362_histogram_put(out, size, &pos, handle->bucket[i]);            /* set the count */
+            last = i;                                                                      /* save the index */
+        }
+    }
+    if (res != 0)                                                                          /* check the result */
+    {
+        return 4;                                                                          /* return error */
+    }
+    crc = a_adxl362_histogram_crc16(&out[8], (uint16_t)(pos - 8));                         /* payload crc */
+    out[6] = (uint8_t)(crc & 0xFF);                                                        /* low byte */
+    out[7] = (uint8_t)(crc >> 8);                                                          /* high byte */
+    *out_len = pos;                                                                        /* set the length */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     import a histogram
+ * @param[in] *handle pointer to an adxl362 histogram handle structure
+ * @param[in] *in pointer to an exported buffer
+ * @param[in] size exported buffer size
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 header is invalid
+ *            - 5 crc is invalid
+ *            - 6 payload is invalid
+ * @note      the histogram is replaced, import into a spare handle and merge to add it
+ */
+uint8_t adxl362_histogram_import(adxl362_histogram_handle_t *handle, const uint8_t *in, uint16_t size)
+{
+    uint8_t pass;
+    uint16_t i;
+    uint16_t k;
+    uint16_t pos;
+    uint16_t used;
+    uint32_t index;
+    uint32_t v;
+    uint32_t lo;
+    uint32_t hi;
+    uint32_t total;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    if ((size < ADXL362_HISTOGRAM_HEADER_SIZE) || (memcmp(in, gsc_adxl362_histogram_magic, 4) != 0) || 
+        (in[4] != ADXL362_HISTOGRAM_VERSION) || (in[5] != ADXL362_HISTOGRAM_SUB_BITS))     /* check the header */
+    {
+        return 4;                                                                          /* return error */
+    }
+    used = (uint16_t)(in[8] | ((uint16_t)in[9] << 8));                                     /* get the used buckets */
+    if (used > ADXL362_HISTOGRAM_BUCKETS)                                                  /* check the used buckets */
+    {
+        return 6;                                                                          /* return error */
+    }
+    
+    for (pass = 0; pass < 2; pass++)                                                       /* check then fill */
+    {
+        pos = ADXL362_HISTOGRAM_HEADER_SIZE;                                               /* payload */
+        if ((a_adxl362_histogram_get(in, size, &pos, &lo) != 0) || 
+            (a_adxl362_histogram_get(in, size, &pos, &hi) != 0) || (lo > hi))              /* get the min and max */
+        {
+            return 6;                                                                      /* return error */
+        }
+        index = 0;                                                                         /* init 0 */
+        total = 0;                                                                         /* init 0 */
+        for (k = 0; k < used; k++)                                                         /* all used buckets */
+        {
+            if (a_adxl362_histogram_get(in, size, &pos, &v) != 0)                          /* get the gap */
+            {
+                return 6;                                                                  /* return error */
+            }
+            if (((k != 0) && (v == 0)) || (v >= ADXL362_HISTOGRAM_BUCKETS - index))        /* check the gap */
+            {
+                return 6;                                                                  /* return error */
+            }
+            index += v;                                                                    /* bucket index */
+            if ((a_adxl362_histogram_get(in, size, &pos, &v) != 0) || (v == 0) || 
+                (v > 0xFFFFFFFFU - total))                                                 /* get the count */
+            {
+                return 6;                                                                  /* return error */
+            }
+            total += v;                                                                    /* add the count */
+            if (pass == 1)                                                                 /* fill */
+            {
+                handle->bucket[index] = v;                                                 /* set the bucket */
+            }
+        }
+        if (pass == 0)                                                                     /* checked */
+        {
+            if (a_adxl362_histogram_crc16(&in[8], (uint16_t)(pos - 8)) != 
+                (uint16_t)(in[6] | ((uint16_t)in[7] << 8)))                                /* check the crc */
+            {
+                return 5;                                                                  /* return error */
+            }
+            for (i = 0; i < ADXL362_HISTOGRAM_BUCKETS; i++)                                /* all buckets */
+            {
+                handle->bucket[i] = 0;                                                     /* clear */
+            }
+        }
+    }
+    handle->count = total;                                                                 /* set the count */
+    handle->min_sq = (used != 0) ? lo : 0xFFFFFFFFU;                                       /* set the min */
+    handle->max_sq = hi;                                                                   /* set the max */
+    
+    return 0;                                                                              /* success return 0 */
+}
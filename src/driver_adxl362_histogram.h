@@ -0,0 +1,221 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_histogram.h
+ * @brief     driver adxl362 histogram header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADXL362_HISTOGRAM_H
+#define DRIVER_ADXL362_HISTOGRAM_H
+
+#include "driver_adxl362.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup adxl362_histogram_driver adxl362 histogram driver function
+ * @brief    adxl362 histogram driver modules
+ * @ingroup  adxl362_driver
+ * @{
+ */
+
+/**
+ * @brief adxl362 histogram definition
+ */
+#define ADXL362_HISTOGRAM_SUB_BITS        5                                         /**< 32 sub buckets per power of two of mg^2 */
+#define ADXL362_HISTOGRAM_BUCKETS         768                                       /**< buckets up to 2^28 mg^2 */
+#define ADXL362_HISTOGRAM_HEADER_SIZE     10                                        /**< export header bytes */
+#define ADXL362_HISTOGRAM_MAX_SIZE        (ADXL362_HISTOGRAM_HEADER_SIZE + 10 + ADXL362_HISTOGRAM_BUCKETS * 7)        /**< max export bytes */
+
+/**
+ * @brief adxl362 histogram summary structure definition
+ */
+typedef struct adxl362_histogram_summary_s
+{
+    uint32_t count;        /**< sample count */
+    float min;             /**< min magnitude in mg */
+    float p50;             /**< median magnitude in mg */
+    float p95;             /**< 95th percentile magnitude in mg */
+    float p99;             /**< 99th percentile magnitude in mg */
+    float max;             /**< max magnitude in mg */
+} adxl362_histogram_summary_t;
+
+/**
+ * @brief adxl362 histogram handle structure definition
+ * @note  the buckets index the squared magnitude in mg^2, below 64 mg^2 every value has
+ *        its own bucket, above it a power of two is split in 32, so a percentile is within
+ *        1/128 of the magnitude
+ */
+typedef struct adxl362_histogram_handle_s
+{
+    uint32_t bucket[ADXL362_HISTOGRAM_BUCKETS];        /**< sample count per bucket */
+    uint32_t count;                                    /**< sample count */
+    uint32_t min_sq;                                   /**< min squared magnitude in mg^2 */
+    uint32_t max_sq;                                   /**< max squared magnitude in mg^2 */
+    uint8_t inited;                                    /**< inited flag */
+} adxl362_histogram_handle_t;
+
+/**
+ * @brief     initialize the histogram
+ * @param[in] *handle pointer to an adxl362 histogram handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      none
+ */
+uint8_t adxl362_histogram_init(adxl362_histogram_handle_t *handle);
+
+/**
+ * @brief     clear the histogram
+ * @param[in] *handle pointer to an adxl362 histogram handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      call it after the upload to start the next period
+ */
+uint8_t adxl362_histogram_clear(adxl362_histogram_handle_t *handle);
+
+/**
+ * @brief     add raw samples
+ * @param[in] *handle pointer to an adxl362 histogram handle structure
+ * @param[in] *x pointer to an x axis raw buffer
+ * @param[in] *y pointer to a y axis raw buffer
+ * @param[in] *z pointer to a z axis raw buffer
+ * @param[in] len buffer length
+ * @param[in] range range of the raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the bucket comes from the integer squared magnitude, there is no sqrt per sample
+ */
+uint8_t adxl362_histogram_update(adxl362_histogram_handle_t *handle, const int16_t *x, const int16_t *y,
+                                 const int16_t *z, uint16_t len, adxl362_range_t range);
+
+/**
+ * @brief     add a fifo block
+ * @param[in] *handle pointer to an adxl362 histogram handle structure
+ * @param[in] *block pointer to a block read by adxl362_read_fifo_block
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 block is NULL
+ * @note      none
+ */
+uint8_t adxl362_histogram_update_block(adxl362_histogram_handle_t *handle, const adxl362_block_t *block);
+
+/**
+ * @brief     merge a histogram into another
+ * @param[in] *handle pointer to an adxl362 histogram handle structure
+ * @param[in] *src pointer to an adxl362 histogram handle structure to add
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the result is the same as adding the samples of both, e.g. windows or sensors
+ */
+uint8_t adxl362_histogram_merge(adxl362_histogram_handle_t *handle, const adxl362_histogram_handle_t *src);
+
+/**
+ * @brief      get a percentile
+ * @param[in]  *handle pointer to an adxl362 histogram handle structure
+ * @param[in]  percent percentile
+ * @param[out] *mg pointer to a magnitude buffer in mg
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 percent is invalid
+ *             - 5 histogram is empty
+ * @note       0 <= percent <= 100, nearest rank, 0 and 100 give the exact min and max
+ */
+uint8_t adxl362_histogram_get_percentile(adxl362_histogram_handle_t *handle, float percent, float *mg);
+
+/**
+ * @brief      get the summary
+ * @param[in]  *handle pointer to an adxl362 histogram handle structure
+ * @param[out] *summary pointer to a summary buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 histogram is empty
+ * @note       the percentiles come from one pass over the buckets
+ */
+uint8_t adxl362_histogram_get_summary(adxl362_histogram_handle_t *handle, adxl362_histogram_summary_t *summary);
+
+/**
+ * @brief      export the histogram
+ * @param[in]  *handle pointer to an adxl362 histogram handle structure
+ * @param[out] *out pointer to an output buffer
+ * @param[in]  size output buffer size
+ * @param[out] *out_len pointer to an exported length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 output buffer is too small
+ * @note       little endian, magic "AXHG", version, sub bucket bits, crc16 ccitt of the payload,
+ *             used buckets, then varints of the min, the max and the index gap and count of
+ *             every used bucket, a size of ADXL362_HISTOGRAM_MAX_SIZE always fits
+ */
+uint8_t adxl362_histogram_export(adxl362_histogram_handle_t *handle, uint8_t *out, uint16_t size, uint16_t *out_len);
+
+/**
+ * @brief     import a histogram
+ * @param[in] *handle pointer to an adxl362 histogram handle structure
+ * @param[in] *in pointer to an exported buffer
+ * @param[in] size exported buffer size
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 header is invalid
+ *            - 5 crc is invalid
+ *            - 6 payload is invalid
+ * @note      the histogram is replaced, import into a spare handle and merge to add it
+ */
+uint8_t adxl362_histogram_import(adxl362_histogram_handle_t *handle, const uint8_t *in, uint16_t size);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,312 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_impact.c
+ * @brief     driver adxl362 impact source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_adxl362_impact.h"
+#include <math.h>
+#include <string.h>
+
+/**
+ * @brief     start a record at a trigger
+ * @param[in] *handle pointer to an adxl362 impact handle structure
+ * @param[in] *x pointer to the x axis raw buffer of the chunk
+ * @param[in] *y pointer to the y axis raw buffer of the chunk
+ * @param[in] *z pointer to the z axis raw buffer of the chunk
+ * @param[in] i trigger position in the chunk
+ * @param[in] type event type
+ * @note      the pre trigger samples come from the history tail and the chunk head
+ */
+static void a_adxl362_impact_trigger(adxl362_impact_handle_t *handle, const int16_t *x, const int16_t *y,
+                                     const int16_t *z, uint16_t i, adxl362_impact_type_t type)
+{
+    uint16_t k;
+    uint16_t h;
+    uint16_t pos;
+    uint16_t pre;
+    adxl362_impact_record_t *record = &handle->record;
+    
+    k = i < handle->config.pre ? i : handle->config.pre;                                    /* samples from the chunk */
+    h = handle->config.pre - k;                                                             /* samples from the history */
+    h = h < handle->ring_count ? h : handle->ring_count;                                    /* limit to the history */
+    pre = 0;                                                                                /* init 0 */
+    pos = (uint16_t)((handle->ring_index + ADXL362_IMPACT_MAX_PRE - h) % ADXL362_IMPACT_MAX_PRE);        /* oldest one */
+    while (pre < h)                                                                         /* copy the history */
+    {
+        record->x[pre] = handle->ring[0][pos];                                              /* x */
+        record->y[pre] = handle->ring[1][pos];                                              /* y */
+        record->z[pre] = handle->ring[2][pos];                                              /* z */
+        pos = (uint16_t)((pos + 1) % ADXL362_IMPACT_MAX_PRE);                               /* next */
+        pre++;                                                                              /* add one */
+    }
+    memcpy(&record->x[pre], &x[i - k], sizeof(int16_t) * k);                                /* copy the chunk x */
+    memcpy(&record->y[pre], &y[i - k], sizeof(int16_t) * k);                                /* copy the chunk y */
+    memcpy(&record->z[pre], &z[i - k], sizeof(int16_t) * k);                                /* copy the chunk z */
+    pre = (uint16_t)(pre + k);                                                              /* total */
+    
+    record->type = type;                                                                    /* set the type */
+    record->sample = handle->sample + i;                                                    /* set the trigger */
+    record->fall_time = (type == ADXL362_IMPACT_TYPE_FREE_FALL) ? handle->free_fall_count : 0;      /* set the fall time */
+    record->range = handle->range;                                                          /* set the range */
+    record->pre = pre;                                                                      /* set the pre */
+    record->len = pre;                                                                      /* set the length */
+    handle->post_left = handle->config.post;                                                /* capture the post */
+    handle->peak_sq = 0;                                                                    /* clear the peak */
+    handle->window = 0;                                                                     /* clear the window */
+    handle->falling = (type == ADXL362_IMPACT_TYPE_FREE_FALL) ? 1 : 0;                      /* set the falling */
+    handle->decided = (type == ADXL362_IMPACT_TYPE_FREE_FALL) ? 0 : 1;                      /* a free fall may become a drop */
+    handle->pending = 1;                                                                    /* start capturing */
+}
+
+/**
+ * @brief     initialize the impact detector
+ * @param[in] *handle pointer to an adxl362 impact handle structure
+ * @param[in] *config pointer to a config structure
+ * @param[in] *callback pointer to a record callback function
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 config is NULL or the free fall config is invalid
+ *            - 5 shock config is invalid
+ *            - 6 capture config is invalid
+ * @note      0 < free_fall_mg < shock_mg <= 16000, the times are not 0,
+ *            pre <= 256, 0 < post and pre + post <= 512
+ */
+uint8_t adxl362_impact_init(adxl362_impact_handle_t *handle, const adxl362_impact_config_t *config,
+                            void (*callback)(adxl362_impact_record_t *record))
+{
+    if (handle == NULL)                                                                     /* check handle */
+    {
+        return 2;                                                                           /* return error */
+    }
+    if ((config == NULL) || (config->free_fall_mg == 0) || 
+        (config->free_fall_time == 0))                                                      /* check the free fall */
+    {
+        return 4;                                                                           /* return error */
+    }
+    if ((config->shock_mg <= config->free_fall_mg) || (config->shock_mg > 16000) || 
+        (config->shock_time == 0) || (config->shock_window == 0))                           /* check the shock */
+    {
+        return 5;                                                                           /* return error */
+    }
+    if ((config->pre > ADXL362_IMPACT_MAX_PRE) || (config->post == 0) || 
+        ((uint32_t)config->pre + config->post > ADXL362_IMPACT_MAX_LEN))                    /* check the capture */
+    {
+        return 6;                                                                           /* return error */
+    }
+    
+    memset(handle, 0, sizeof(adxl362_impact_handle_t));                                     /* clear the handle */
+    handle->receive_callback = callback;                                                    /* set the callback */
+    handle->config = *config;                                                               /* set the config */
+    handle->free_fall_sq = (uint32_t)config->free_fall_mg * config->free_fall_mg;           /* free fall in mg^2 */
+    handle->shock_sq = (uint32_t)config->shock_mg * config->shock_mg;                       /* shock in mg^2 */
+    handle->range = ADXL362_RANGE_2G;                                                       /* init the range */
+    handle->inited = 1;                                                                     /* flag finish initialization */
+    
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief     run the impact detector over raw samples
+ * @param[in] *handle pointer to an adxl362 impact handle structure
+ * @param[in] *x pointer to an x axis raw buffer
+ * @param[in] *y pointer to a y axis raw buffer
+ * @param[in] *z pointer to a z axis raw buffer
+ * @param[in] len buffer length
+ * @param[in] range range of the raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the record passed to the callback is only valid during the call, new triggers are
+ *            ignored while a record is captured, a range change clears the history
+ */
+uint8_t adxl362_impact_update(adxl362_impact_handle_t *handle, const int16_t *x, const int16_t *y,
+                              const int16_t *z, uint16_t len, adxl362_range_t range)
+{
+    uint16_t i;
+    uint16_t n;
+    uint16_t k;
+    uint8_t shift;
+    uint32_t m;
+    adxl362_impact_record_t *record;
+    
+    if (handle == NULL)                                                                     /* check handle */
+    {
+        return 2;                                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                                /* check handle initialization */
+    {
+        return 3;                                                                           /* return error */
+    }
+    
+    if (handle->range != range)                                                             /* range changed */
+    {
+        handle->ring_count = 0;                                                             /* clear the history */
+        handle->range = range;                                                              /* set the range */
+    }
+    record = &handle->record;                                                               /* get the record */
+    shift = (uint8_t)(2 * (uint8_t)range);                                                  /* raw^2 to mg^2 */
+    while (len != 0)                                                                        /* run all chunks */
+    {
+        n = len < ADXL362_IMPACT_CHUNK ? len : ADXL362_IMPACT_CHUNK;                        /* chunk length */
+        
+        /* magnitudes first, this loop vectorizes and needs no sqrt */
+        for (i = 0; i < n; i++)                                                             /* all samples */
+        {
+            handle->mag_sq[i] = (uint32_t)((int32_t)x[i] * x[i] + (int32_t)y[i] * y[i] + 
+                                           (int32_t)z[i] * z[i]) << shift;                  /* magnitude in mg^2 */
+        }
+        
+        for (i = 0; i < n; i++)                                                             /* all samples */
+        {
+            m = handle->mag_sq[i];                                                          /* get the magnitude */
+            if (m < handle->free_fall_sq)                                                   /* below the free fall threshold */
+            {
+                handle->free_fall_count += (handle->free_fall_count < 0xFFFF) ? 1 : 0;      /* add one */
+            }
+            else
+            {
+                handle->free_fall_count = 0;                                                /* clear */
+            }
+            if (m > handle->shock_sq)                                                       /* above the shock threshold */
+            {
+                handle->shock_count += (handle->shock_count < 0xFFFF) ? 1 : 0;              /* add one */
+            }
+            else
+            {
+                handle->shock_count = 0;                                                    /* clear */
+            }
+            
+            if (handle->pending == 0)                                                       /* look for a trigger */
+            {
+                if (handle->shock_count >= handle->config.shock_time)                       /* shock */
+                {
+                    a_adxl362_impact_trigger(handle, x, y, z, i, ADXL362_IMPACT_TYPE_SHOCK);            /* trigger */
+                }
+                else if (handle->free_fall_count >= handle->config.free_fall_time)          /* free fall */
+                {
+                    a_adxl362_impact_trigger(handle, x, y, z, i, ADXL362_IMPACT_TYPE_FREE_FALL);        /* trigger */
+                }
+                else
+                {
+                    continue;                                                               /* next sample */
+                }
+            }
+            
+            /* capture and classify the pending record */
+            handle->peak_sq = m > handle->peak_sq ? m : handle->peak_sq;                    /* track the peak */
+            if (handle->post_left != 0)                                                     /* capture the post */
+            {
+                record->x[record->len] = x[i];                                              /* x */
+                record->y[record->len] = y[i];                                              /* y */
+                record->z[record->len] = z[i];                                              /* z */
+                record->len++;                                                              /* add one */
+                handle->post_left--;                                                        /* one less */
+            }
+            if (handle->decided == 0)                                                       /* free fall is open */
+            {
+                if (handle->shock_count >= handle->config.shock_time)                       /* shock after the fall */
+                {
+                    record->type = ADXL362_IMPACT_TYPE_DROP;                                /* it is a drop */
+                    handle->decided = 1;                                                    /* final */
+                }
+                else if ((handle->falling != 0) && (handle->free_fall_count != 0))          /* still falling */
+                {
+                    record->fall_time = handle->free_fall_count;                            /* fall so far */
+                }
+                else
+                {
+                    handle->falling = 0;                                                    /* the fall ended */
+                    handle->window++;                                                       /* wait for a shock */
+                    if (handle->window >= handle->config.shock_window)                      /* no shock */
+                    {
+                        handle->decided = 1;                                                /* final */
+                    }
+                }
+            }
+            if ((handle->post_left == 0) && (handle->decided != 0))                         /* record done */
+            {
+                record->peak_mg = (uint16_t)(sqrtf((float)handle->peak_sq) + 0.5f);         /* peak in mg */
+                handle->pending = 0;                                                        /* wait for the next trigger */
+                handle->shock_count = 0;                                                    /* rearm the shock */
+                handle->free_fall_count = 0;                                                /* rearm the free fall */
+                if (handle->receive_callback != NULL)                                       /* check the callback */
+                {
+                    handle->receive_callback(record);                                       /* hand the record over */
+                }
+            }
+        }
+        
+        /* keep the newest samples as the pre trigger history */
+        k = n < handle->config.pre ? n : handle->config.pre;                                /* samples to keep */
+        for (i = (uint16_t)(n - k); i < n; i++)                                             /* newest samples */
+        {
+            handle->ring[0][handle->ring_index] = x[i];                                     /* x */
+            handle->ring[1][handle->ring_index] = y[i];                                     /* y */
+            handle->ring[2][handle->ring_index] = z[i];                                     /* z */
+            handle->ring_index = (uint16_t)((handle->ring_index + 1) % ADXL362_IMPACT_MAX_PRE);     /* next */
+        }
+        handle->ring_count = (uint16_t)(handle->ring_count + k);                            /* add the samples */
+        handle->ring_count = handle->ring_count > handle->config.pre ? handle->config.pre : handle->ring_count;   /* limit */
+        handle->sample += n;                                                                /* next sample index */
+        x += n;                                                                             /* next x */
+        y += n;                                                                             /* next y */
+        z += n;                                                                             /* next z */
+        len = (uint16_t)(len - n);                                                          /* remaining samples */
+    }
+    
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief     run the impact detector over a fifo block
+ * @param[in] *handle pointer to an adxl362 impact handle structure
+ * @param[in] *block pointer to a block read by adxl362_read_fifo_block
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 block is NULL
+ * @note      none
+ */
+uint8_t adxl362_impact_update_block(adxl362_impact_handle_t *handle, const adxl362_block_t *block)
+{
+    if (block == NULL)                                                                      /* check the block */
+    {
+        return 4;                                                                           /* return error */
+    }
+    
+    return adxl362_impact_update(handle, block->x, block->y, block->z, block->len, block->range);        /* update */
+}
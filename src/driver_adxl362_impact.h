@@ -0,0 +1,185 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_impact.h
+ * @brief     driver adxl362 impact header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADXL362_IMPACT_H
+#define DRIVER_ADXL362_IMPACT_H
+
+#include "driver_adxl362.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup adxl362_impact_driver adxl362 impact driver function
+ * @brief    adxl362 impact driver modules
+ * @ingroup  adxl362_driver
+ * @{
+ */
+
+/**
+ * @brief adxl362 impact definition
+ */
+#define ADXL362_IMPACT_MAX_PRE        256        /**< max pre trigger samples */
+#define ADXL362_IMPACT_MAX_LEN        512        /**< max pre and post trigger samples */
+#define ADXL362_IMPACT_CHUNK          128        /**< magnitudes computed per pass */
+
+/**
+ * @brief adxl362 impact type enumeration definition
+ */
+typedef enum
+{
+    ADXL362_IMPACT_TYPE_FREE_FALL = 0x00,        /**< free fall without a following shock */
+    ADXL362_IMPACT_TYPE_SHOCK     = 0x01,        /**< shock without a free fall */
+    ADXL362_IMPACT_TYPE_DROP      = 0x02,        /**< free fall followed by a shock */
+} adxl362_impact_type_t;
+
+/**
+ * @brief adxl362 impact config structure definition
+ * @note  the times are in samples, e.g. 100ms is 10 samples at 100Hz
+ */
+typedef struct adxl362_impact_config_s
+{
+    uint16_t free_fall_mg;            /**< free fall magnitude threshold in mg */
+    uint16_t free_fall_time;          /**< samples below the free fall threshold */
+    uint16_t shock_mg;                /**< shock magnitude threshold in mg */
+    uint16_t shock_time;              /**< samples above the shock threshold */
+    uint16_t shock_window;            /**< samples after a free fall in which a shock makes a drop */
+    uint16_t pre;                     /**< samples captured before the trigger */
+    uint16_t post;                    /**< samples captured from the trigger on */
+} adxl362_impact_config_t;
+
+/**
+ * @brief adxl362 impact record structure definition
+ */
+typedef struct adxl362_impact_record_s
+{
+    adxl362_impact_type_t type;               /**< event type */
+    uint32_t sample;                          /**< sample index of the trigger */
+    uint16_t fall_time;                       /**< free fall samples, 0 for a shock */
+    uint16_t peak_mg;                         /**< peak magnitude in mg */
+    adxl362_range_t range;                    /**< range of the raw data */
+    uint16_t pre;                             /**< samples before the trigger */
+    uint16_t len;                             /**< captured samples */
+    int16_t x[ADXL362_IMPACT_MAX_LEN];        /**< x axis raw data */
+    int16_t y[ADXL362_IMPACT_MAX_LEN];        /**< y axis raw data */
+    int16_t z[ADXL362_IMPACT_MAX_LEN];        /**< z axis raw data */
+} adxl362_impact_record_t;
+
+/**
+ * @brief adxl362 impact handle structure definition
+ */
+typedef struct adxl362_impact_handle_s
+{
+    void (*receive_callback)(adxl362_impact_record_t *record);        /**< point to a receive_callback function address */
+    adxl362_impact_config_t config;                                   /**< config */
+    uint32_t free_fall_sq;                                            /**< free fall threshold in mg^2 */
+    uint32_t shock_sq;                                                /**< shock threshold in mg^2 */
+    uint32_t mag_sq[ADXL362_IMPACT_CHUNK];                            /**< magnitude work buffer in mg^2 */
+    int16_t ring[3][ADXL362_IMPACT_MAX_PRE];                          /**< pre trigger history */
+    uint16_t ring_index;                                              /**< next history position */
+    uint16_t ring_count;                                              /**< valid history samples */
+    uint16_t free_fall_count;                                         /**< samples below the free fall threshold */
+    uint16_t shock_count;                                             /**< samples above the shock threshold */
+    uint16_t window;                                                  /**< samples since the free fall ended */
+    uint16_t post_left;                                               /**< post trigger samples to capture */
+    uint32_t peak_sq;                                                 /**< peak magnitude in mg^2 */
+    uint8_t pending;                                                  /**< 1 if a record is being captured */
+    uint8_t falling;                                                  /**< 1 while the triggering free fall lasts */
+    uint8_t decided;                                                  /**< 1 if the record type is final */
+    adxl362_range_t range;                                            /**< range of the history */
+    uint32_t sample;                                                  /**< sample index */
+    adxl362_impact_record_t record;                                   /**< record handed to the callback */
+    uint8_t inited;                                                   /**< inited flag */
+} adxl362_impact_handle_t;
+
+/**
+ * @brief     initialize the impact detector
+ * @param[in] *handle pointer to an adxl362 impact handle structure
+ * @param[in] *config pointer to a config structure
+ * @param[in] *callback pointer to a record callback function
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 config is NULL or the free fall config is invalid
+ *            - 5 shock config is invalid
+ *            - 6 capture config is invalid
+ * @note      0 < free_fall_mg < shock_mg <= 16000, the times are not 0,
+ *            pre <= 256, 0 < post and pre + post <= 512
+ */
+uint8_t adxl362_impact_init(adxl362_impact_handle_t *handle, const adxl362_impact_config_t *config,
+                            void (*callback)(adxl362_impact_record_t *record));
+
+/**
+ * @brief     run the impact detector over raw samples
+ * @param[in] *handle pointer to an adxl362 impact handle structure
+ * @param[in] *x pointer to an x axis raw buffer
+ * @param[in] *y pointer to a y axis raw buffer
+ * @param[in] *z pointer to a z axis raw buffer
+ * @param[in] len buffer length
+ * @param[in] range range of the raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the record passed to the callback is only valid during the call, new triggers are
+ *            ignored while a record is captured, a range change clears the history
+ */
+uint8_t adxl362_impact_update(adxl362_impact_handle_t *handle, const int16_t *x, const int16_t *y,
+                              const int16_t *z, uint16_t len, adxl362_range_t range);
+
+/**
+ * @brief     run the impact detector over a fifo block
+ * @param[in] *handle pointer to an adxl362 impact handle structure
+ * @param[in] *block pointer to a block read by adxl362_read_fifo_block
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 block is NULL
+ * @note      none
+ */
+uint8_t adxl362_impact_update_block(adxl362_impact_handle_t *handle, const adxl362_block_t *block);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,403 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_magnitude.c
+ * @brief     driver adxl362 magnitude source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_adxl362_magnitude.h"
+#include <math.h>
+
+/**
+ * @brief adxl362 magnitude definition
+ */
+#define ADXL362_MAGNITUDE_ROOT_BIT        (1U << 26)        /**< highest even bit of a value below 2^28 */
+
+/**
+ * @brief      squared magnitudes of split axes
+ * @param[in]  *x pointer to an x axis raw buffer
+ * @param[in]  *y pointer to a y axis raw buffer
+ * @param[in]  *z pointer to a z axis raw buffer
+ * @param[in]  n vector number
+ * @param[in]  shift mg^2 per lsb^2 shift
+ * @param[out] *sq pointer to a squared magnitude buffer
+ * @note       none
+ */
+static void a_adxl362_magnitude_sq(const int16_t *x, const int16_t *y, const int16_t *z, uint16_t n,
+                                   uint32_t shift, uint32_t *sq)
+{
+    uint16_t i;
+    
+    for (i = 0; i < n; i++)                                                                /* all vectors */
+    {
+        sq[i] = (uint32_t)((int32_t)x[i] * x[i] + (int32_t)y[i] * y[i] + 
+                           (int32_t)z[i] * z[i]) << shift;                                 /* mg^2 */
+    }
+}
+
+/**
+ * @brief      squared magnitudes of packed triplets
+ * @param[in]  *xyz pointer to a packed x, y, z raw buffer
+ * @param[in]  n vector number
+ * @param[in]  shift mg^2 per lsb^2 shift
+ * @param[out] *sq pointer to a squared magnitude buffer
+ * @note       the stride 3 loads vectorize with neon ld3 or avx2, sse2 stays scalar
+ */
+static void a_adxl362_magnitude_sq_interleaved(const int16_t *xyz, uint16_t n, uint32_t shift, uint32_t *sq)
+{
+    uint16_t i;
+    int32_t a;
+    int32_t b;
+    int32_t c;
+    
+    for (i = 0; i < n; i++)                                                                /* all vectors */
+    {
+        a = xyz[i * 3 + 0];                                                                /* x */
+        b = xyz[i * 3 + 1];                                                                /* y */
+        c = xyz[i * 3 + 2];                                                                /* z */
+        sq[i] = (uint32_t)(a * a + b * b + c * c) << shift;                                /* mg^2 */
+    }
+}
+
+/**
+ * @brief      integer roots of the work buffer
+ * @param[in]  *handle pointer to an adxl362 magnitude handle structure
+ * @param[in]  n vector number
+ * @param[out] *mg pointer to a magnitude buffer in mg
+ * @note       the digit by digit root runs one bit per pass over the chunk with masks
+ *             instead of branches, so every pass vectorizes, the remainder rounds the root
+ */
+static void a_adxl362_magnitude_root(adxl362_magnitude_handle_t *handle, uint16_t n, uint16_t *mg)
+{
+    uint16_t i;
+    uint32_t b;
+    uint32_t t;
+    uint32_t m;
+    uint32_t *v = handle->sq;
+    uint32_t *r = handle->root;
+    
+    for (i = 0; i < n; i++)                                                                /* all vectors */
+    {
+        r[i] = 0;                                                                          /* init 0 */
+    }
+    for (b = ADXL362_MAGNITUDE_ROOT_BIT; b != 0; b >>= 2)                                  /* all bits */
+    {
+        for (i = 0; i < n; i++)                                                            /* all vectors */
+        {
+            t = r[i] + b;                                                                  /* trial */
+            m = (uint32_t)0 - (uint32_t)(v[i] >= t);                                       /* mask of the bit */
+            v[i] -= t & m;                                                                 /* remove */
+            r[i] = (r[i] >> 1) + (b & m);                                                  /* set the bit */
+        }
+    }
+    for (i = 0; i < n; i++)                                                                /* all vectors */
+    {
+        mg[i] = (uint16_t)(r[i] + (uint32_t)(v[i] > r[i]));                                /* round to the nearest */
+    }
+}
+
+/**
+ * @brief     initialize the magnitude handle
+ * @param[in] *handle pointer to an adxl362 magnitude handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      none
+ */
+uint8_t adxl362_magnitude_init(adxl362_magnitude_handle_t *handle)
+{
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    
+    handle->inited = 1;                                                                    /* flag finish initialization */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief      get the squared magnitudes
+ * @param[in]  *handle pointer to an adxl362 magnitude handle structure
+ * @param[in]  *x pointer to an x axis raw buffer
+ * @param[in]  *y pointer to a y axis raw buffer
+ * @param[in]  *z pointer to a z axis raw buffer
+ * @param[in]  len buffer length
+ * @param[in]  range range of the raw data
+ * @param[out] *sq pointer to a squared magnitude buffer in mg^2
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 range is invalid
+ * @note       exact, compare it with a squared threshold when only a threshold is needed
+ */
+uint8_t adxl362_magnitude_squared(adxl362_magnitude_handle_t *handle, const int16_t *x, const int16_t *y,
+                                  const int16_t *z, uint16_t len, adxl362_range_t range, uint32_t *sq)
+{
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    if ((uint8_t)range > (uint8_t)ADXL362_RANGE_8G)                                        /* check the range */
+    {
+        return 4;                                                                          /* return error */
+    }
+    
+    a_adxl362_magnitude_sq(x, y, z, len, (uint32_t)range * 2, sq);                         /* squared magnitudes */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief      get the integer magnitudes
+ * @param[in]  *handle pointer to an adxl362 magnitude handle structure
+ * @param[in]  *x pointer to an x axis raw buffer
+ * @param[in]  *y pointer to a y axis raw buffer
+ * @param[in]  *z pointer to a z axis raw buffer
+ * @param[in]  len buffer length
+ * @param[in]  range range of the raw data
+ * @param[out] *mg pointer to a magnitude buffer in mg
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 range is invalid
+ * @note       integer root rounded to the nearest mg, the error is at most 0.5mg,
+ *             no fpu is needed
+ */
+uint8_t adxl362_magnitude_isqrt(adxl362_magnitude_handle_t *handle, const int16_t *x, const int16_t *y,
+                                const int16_t *z, uint16_t len, adxl362_range_t range, uint16_t *mg)
+{
+    uint16_t i;
+    uint16_t n;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    if ((uint8_t)range > (uint8_t)ADXL362_RANGE_8G)                                        /* check the range */
+    {
+        return 4;                                                                          /* return error */
+    }
+    
+    for (i = 0; i < len; i += n)                                                           /* all chunks */
+    {
+        n = (uint16_t)(len - i) < ADXL362_MAGNITUDE_CHUNK ? (uint16_t)(len - i) : ADXL362_MAGNITUDE_CHUNK;        /* chunk length */
+        a_adxl362_magnitude_sq(&x[i], &y[i], &z[i], n, (uint32_t)range * 2, handle->sq);   /* squared magnitudes */
+        a_adxl362_magnitude_root(handle, n, &mg[i]);                                       /* roots */
+    }
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief      get the float magnitudes
+ * @param[in]  *handle pointer to an adxl362 magnitude handle structure
+ * @param[in]  *x pointer to an x axis raw buffer
+ * @param[in]  *y pointer to a y axis raw buffer
+ * @param[in]  *z pointer to a z axis raw buffer
+ * @param[in]  len buffer length
+ * @param[in]  range range of the raw data
+ * @param[out] *mg pointer to a magnitude buffer in mg
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 range is invalid
+ * @note       sqrtf of the exact squared magnitude, the error is at most 1 ulp
+ */
+uint8_t adxl362_magnitude_float(adxl362_magnitude_handle_t *handle, const int16_t *x, const int16_t *y,
+                                const int16_t *z, uint16_t len, adxl362_range_t range, float *mg)
+{
+    uint16_t i;
+    uint16_t j;
+    uint16_t n;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    if ((uint8_t)range > (uint8_t)ADXL362_RANGE_8G)                                        /* check the range */
+    {
+        return 4;                                                                          /* return error */
+    }
+    
+    for (i = 0; i < len; i += n)                                                           /* all chunks */
+    {
+        n = (uint16_t)(len - i) < ADXL362_MAGNITUDE_CHUNK ? (uint16_t)(len - i) : ADXL362_MAGNITUDE_CHUNK;        /* chunk length */
+        a_adxl362_magnitude_sq(&x[i], &y[i], &z[i], n, (uint32_t)range * 2, handle->sq);   /* squared magnitudes */
+        for (j = 0; j < n; j++)                                                            /* all vectors */
+        {
+            mg[i + j] = sqrtf((float)handle->sq[j]);                                       /* root */
+        }
+    }
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief      get the squared magnitudes of packed triplets
+ * @param[in]  *handle pointer to an adxl362 magnitude handle structure
+ * @param[in]  *xyz pointer to a packed x, y, z raw buffer
+ * @param[in]  len triplet length
+ * @param[in]  range range of the raw data
+ * @param[out] *sq pointer to a squared magnitude buffer in mg^2
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 range is invalid
+ * @note       same as adxl362_magnitude_squared
+ */
+uint8_t adxl362_magnitude_squared_interleaved(adxl362_magnitude_handle_t *handle, const int16_t *xyz, uint16_t len,
+                                              adxl362_range_t range, uint32_t *sq)
+{
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    if ((uint8_t)range > (uint8_t)ADXL362_RANGE_8G)                                        /* check the range */
+    {
+        return 4;                                                                          /* return error */
+    }
+    
+    a_adxl362_magnitude_sq_interleaved(xyz, len, (uint32_t)range * 2, sq);                 /* squared magnitudes */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief      get the integer magnitudes of packed triplets
+ * @param[in]  *handle pointer to an adxl362 magnitude handle structure
+ * @param[in]  *xyz pointer to a packed x, y, z raw buffer
+ * @param[in]  len triplet length
+ * @param[in]  range range of the raw data
+ * @param[out] *mg pointer to a magnitude buffer in mg
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 range is invalid
+ * @note       same as adxl362_magnitude_isqrt
+ */
+uint8_t adxl362_magnitude_isqrt_interleaved(adxl362_magnitude_handle_t *handle, const int16_t *xyz, uint16_t len,
+                                            adxl362_range_t range, uint16_t *mg)
+{
+    uint16_t i;
+    uint16_t n;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    if ((uint8_t)range > (uint8_t)ADXL362_RANGE_8G)                                        /* check the range */
+    {
+        return 4;                                                                          /* return error */
+    }
+    
+    for (i = 0; i < len; i += n)                                                           /* all chunks */
+    {
+        n = (uint16_t)(len - i) < ADXL362_MAGNITUDE_CHUNK ? (uint16_t)(len - i) : ADXL362_MAGNITUDE_CHUNK;        /* chunk length */
+        a_adxl362_magnitude_sq_interleaved(&xyz[i * 3], n, (uint32_t)range * 2, handle->sq);        /* squared magnitudes */
+        a_adxl362_magnitude_root(handle, n, &mg[i]);                                       /* roots */
+    }
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief      get the float magnitudes of packed triplets
+ * @param[in]  *handle pointer to an adxl362 magnitude handle structure
+ * @param[in]  *xyz pointer to a packed x, y, z raw buffer
+ * @param[in]  len triplet length
+ * @param[in]  range range of the raw data
+ * @param[out] *mg pointer to a magnitude buffer in mg
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 range is invalid
+ * @note       same as adxl362_magnitude_float
+ */
+uint8_t adxl362_magnitude_float_interleaved(adxl362_magnitude_handle_t *handle, const int16_t *xyz, uint16_t len,
+                                            adxl362_range_t range, float *mg)
+{
+    uint16_t i;
+    uint16_t j;
+    uint16_t n;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    if ((uint8_t)range > (uint8_t)ADXL362_RANGE_8G)                                        /* check the range */
+    {
+        return 4;                                                                          /* return error */
+    }
+    
+    for (i = 0; i < len; i += n)                                                           /* all chunks */
+    {
+        n = (uint16_t)(len - i) < ADXL362_MAGNITUDE_CHUNK ? (uint16_t)(len - i) : ADXL362_MAGNITUDE_CHUNK;        /* chunk length */
+        a_adxl362_magnitude_sq_interleaved(&xyz[i * 3], n, (uint32_t)range * 2, handle->sq);        /* squared magnitudes */
+        for (j = 0; j < n; j++)                                                            /* all vectors */
+        {
+            mg[i + j] = sqrtf((float)handle->sq[j]);                                       /* root */
+        }
+    }
+    
+    return 0;                                                                              /* success return 0 */
+}
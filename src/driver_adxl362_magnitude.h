@@ -0,0 +1,197 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_magnitude.h
+ * @brief     driver adxl362 magnitude header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADXL362_MAGNITUDE_H
+#define DRIVER_ADXL362_MAGNITUDE_H
+
+#include "driver_adxl362.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup adxl362_magnitude_driver adxl362 magnitude driver function
+ * @brief    adxl362 magnitude driver modules
+ * @ingroup  adxl362_driver
+ * @{
+ */
+
+/**
+ * @brief adxl362 magnitude definition
+ */
+#define ADXL362_MAGNITUDE_CHUNK        64        /**< vectors converted per pass */
+
+/**
+ * @brief adxl362 magnitude handle structure definition
+ * @note  the squared magnitude of a 12 bit sample in mg^2 is below 2^28 in the 2g, 4g and 8g ranges,
+ *        the entry points reject any other range
+ */
+typedef struct adxl362_magnitude_handle_s
+{
+    uint32_t sq[ADXL362_MAGNITUDE_CHUNK];          /**< squared magnitude work buffer */
+    uint32_t root[ADXL362_MAGNITUDE_CHUNK];        /**< integer root work buffer */
+    uint8_t inited;                                /**< inited flag */
+} adxl362_magnitude_handle_t;
+
+/**
+ * @brief     initialize the magnitude handle
+ * @param[in] *handle pointer to an adxl362 magnitude handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      none
+ */
+uint8_t adxl362_magnitude_init(adxl362_magnitude_handle_t *handle);
+
+/**
+ * @brief      get the squared magnitudes
+ * @param[in]  *handle pointer to an adxl362 magnitude handle structure
+ * @param[in]  *x pointer to an x axis raw buffer
+ * @param[in]  *y pointer to a y axis raw buffer
+ * @param[in]  *z pointer to a z axis raw buffer
+ * @param[in]  len buffer length
+ * @param[in]  range range of the raw data
+ * @param[out] *sq pointer to a squared magnitude buffer in mg^2
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 range is invalid
+ * @note       exact, compare it with a squared threshold when only a threshold is needed
+ */
+uint8_t adxl362_magnitude_squared(adxl362_magnitude_handle_t *handle, const int16_t *x, const int16_t *y,
+                                  const int16_t *z, uint16_t len, adxl362_range_t range, uint32_t *sq);
+
+/**
+ * @brief      get the integer magnitudes
+ * @param[in]  *handle pointer to an adxl362 magnitude handle structure
+ * @param[in]  *x pointer to an x axis raw buffer
+ * @param[in]  *y pointer to a y axis raw buffer
+ * @param[in]  *z pointer to a z axis raw buffer
+ * @param[in]  len buffer length
+ * @param[in]  range range of the raw data
+ * @param[out] *mg pointer to a magnitude buffer in mg
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 range is invalid
+ * @note       integer root rounded to the nearest mg, the error is at most 0.5mg,
+ *             no fpu is needed
+ */
+uint8_t adxl362_magnitude_isqrt(adxl362_magnitude_handle_t *handle, const int16_t *x, const int16_t *y,
+                                const int16_t *z, uint16_t len, adxl362_range_t range, uint16_t *mg);
+
+/**
+ * @brief      get the float magnitudes
+ * @param[in]  *handle pointer to an adxl362 magnitude handle structure
+ * @param[in]  *x pointer to an x axis raw buffer
+ * @param[in]  *y pointer to a y axis raw buffer
+ * @param[in]  *z pointer to a z axis raw buffer
+ * @param[in]  len buffer length
+ * @param[in]  range range of the raw data
+ * @param[out] *mg pointer to a magnitude buffer in mg
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 range is invalid
+ * @note       sqrtf of the exact squared magnitude, the error is at most 1 ulp
+ */
+uint8_t adxl362_magnitude_float(adxl362_magnitude_handle_t *handle, const int16_t *x, const int16_t *y,
+                                const int16_t *z, uint16_t len, adxl362_range_t range, float *mg);
+
+/**
+ * @brief      get the squared magnitudes of packed triplets
+ * @param[in]  *handle pointer to an adxl362 magnitude handle structure
+ * @param[in]  *xyz pointer to a packed x, y, z raw buffer
+ * @param[in]  len triplet length
+ * @param[in]  range range of the raw data
+ * @param[out] *sq pointer to a squared magnitude buffer in mg^2
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 range is invalid
+ * @note       same as adxl362_magnitude_squared
+ */
+uint8_t adxl362_magnitude_squared_interleaved(adxl362_magnitude_handle_t *handle, const int16_t *xyz, uint16_t len,
+                                              adxl362_range_t range, uint32_t *sq);
+
+/**
+ * @brief      get the integer magnitudes of packed triplets
+ * @param[in]  *handle pointer to an adxl362 magnitude handle structure
+ * @param[in]  *xyz pointer to a packed x, y, z raw buffer
+ * @param[in]  len triplet length
+ * @param[in]  range range of the raw data
+ * @param[out] *mg pointer to a magnitude buffer in mg
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 range is invalid
+ * @note       same as adxl362_magnitude_isqrt
+ */
+uint8_t adxl362_magnitude_isqrt_interleaved(adxl362_magnitude_handle_t *handle, const int16_t *xyz, uint16_t len,
+                                            adxl362_range_t range, uint16_t *mg);
+
+/**
+ * @brief      get the float magnitudes of packed triplets
+ * @param[in]  *handle pointer to an adxl362 magnitude handle structure
+ * @param[in]  *xyz pointer to a packed x, y, z raw buffer
+ * @param[in]  len triplet length
+ * @param[in]  range range of the raw data
+ * @param[out] *mg pointer to a magnitude buffer in mg
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 range is invalid
+ * @note       same as adxl362_magnitude_float
+ */
+uint8_t adxl362_magnitude_float_interleaved(adxl362_magnitude_handle_t *handle, const int16_t *xyz, uint16_t len,
+                                            adxl362_range_t range, float *mg);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
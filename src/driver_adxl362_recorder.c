@@ -0,0 +1,338 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_recorder.c
+ * @brief     driver adxl362 recorder source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_adxl362_recorder.h"
+#include <string.h>
+
+/**
+ * @brief         latch status bits
+ * @param[in,out] *pending pointer to the pending bits
+ * @param[in]     bits status bits to add
+ * @note          one atomic or, so a trigger from the interrupt never loses bits of another
+ */
+static inline void a_adxl362_recorder_latch(volatile uint8_t *pending, uint8_t bits)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    (void)__atomic_fetch_or(pending, bits, __ATOMIC_RELEASE);                              /* latch the bits */
+#else
+    *pending |= bits;                                                                      /* latch the bits */
+#endif
+}
+
+/**
+ * @brief         take the latched status bits
+ * @param[in,out] *pending pointer to the pending bits
+ * @return        taken bits
+ * @note          one atomic exchange, so a trigger landing between the read and the clear is
+ *                kept for the next update instead of being cleared unseen
+ */
+static inline uint8_t a_adxl362_recorder_take(volatile uint8_t *pending)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __atomic_exchange_n(pending, 0, __ATOMIC_ACQUIRE);                              /* take the bits */
+#else
+    uint8_t bits;
+    
+    bits = *pending;                                                                       /* get the bits */
+    *pending = 0;                                                                          /* clear the bits */
+    
+    return bits;                                                                           /* return the bits */
+#endif
+}
+
+/**
+ * @brief     hand the window off
+ * @param[in] *handle pointer to an adxl362 recorder handle structure
+ * @note      the window is held until adxl362_recorder_release
+ */
+static void a_adxl362_recorder_freeze(adxl362_recorder_handle_t *handle)
+{
+    uint32_t first;
+    
+    first = handle->capacity - handle->window_pos;                                         /* samples to the end */
+    first = handle->held < first ? handle->held : first;                                   /* first part */
+    handle->window.first = &handle->buf[handle->window_pos * 3];                           /* set the first part */
+    handle->window.first_len = first;                                                      /* set the first length */
+    handle->window.second = (handle->held > first) ? handle->buf : NULL;                   /* set the second part */
+    handle->window.second_len = handle->held - first;                                      /* set the second length */
+    handle->window.len = handle->held;                                                     /* set the length */
+    handle->state = ADXL362_RECORDER_STATE_HOLD;                                           /* hold */
+    if (handle->receive_callback != NULL)                                                  /* check the callback */
+    {
+        handle->receive_callback(&handle->window);                                         /* run the callback */
+    }
+}
+
+/**
+ * @brief     start a window
+ * @param[in] *handle pointer to an adxl362 recorder handle structure
+ * @param[in] status status bits that triggered
+ * @note      the pre trigger part is cut short if the history is shorter
+ */
+static void a_adxl362_recorder_start(adxl362_recorder_handle_t *handle, uint8_t status)
+{
+    uint32_t pre;
+    
+    pre = handle->count < handle->pre ? handle->count : handle->pre;                       /* available history */
+    handle->window_pos = (handle->write + handle->capacity - pre) % handle->capacity;      /* window start */
+    handle->held = pre;                                                                    /* held samples */
+    handle->window.pre = pre;                                                              /* set the pre length */
+    handle->window.start = handle->index - pre;                                            /* set the start index */
+    handle->window.status = status;                                                        /* set the status */
+    handle->post_left = handle->post;                                                      /* post trigger samples */
+    handle->state = ADXL362_RECORDER_STATE_POST;                                           /* capture */
+    if (handle->post_left == 0)                                                            /* no post trigger part */
+    {
+        a_adxl362_recorder_freeze(handle);                                                 /* hand off */
+    }
+}
+
+/**
+ * @brief     initialize the recorder
+ * @param[in] *handle pointer to an adxl362 recorder handle structure
+ * @param[in] *buf pointer to a history buffer of ADXL362_RECORDER_BUF_LEN(capacity)
+ * @param[in] capacity history samples
+ * @param[in] pre samples kept before the trigger
+ * @param[in] post samples captured from the trigger on
+ * @param[in] trigger_mask status bits that trigger, e.g. ADXL362_STATUS_ACT
+ * @param[in] *callback pointer to a window callback function
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 buf is NULL
+ *            - 5 capacity is invalid
+ *            - 6 window is invalid
+ * @note      0 < pre + post <= capacity, the samples beyond the window keep recording
+ *            while a window is held
+ */
+uint8_t adxl362_recorder_init(adxl362_recorder_handle_t *handle, int16_t *buf, uint32_t capacity,
+                              uint32_t pre, uint32_t post, uint8_t trigger_mask,
+                              void (*callback)(const adxl362_recorder_window_t *window))
+{
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (buf == NULL)                                                                       /* check the buffer */
+    {
+        return 4;                                                                          /* return error */
+    }
+    if ((capacity == 0) || (capacity > 0x3FFFFFFFU))                                       /* check the capacity */
+    {
+        return 5;                                                                          /* return error */
+    }
+    if ((pre + post == 0) || (pre > capacity) || (post > capacity - pre))                  /* check the window */
+    {
+        return 6;                                                                          /* return error */
+    }
+    
+    memset(handle, 0, sizeof(adxl362_recorder_handle_t));                                  /* clear the handle */
+    handle->receive_callback = callback;                                                   /* set the callback */
+    handle->buf = buf;                                                                     /* set the buffer */
+    handle->capacity = capacity;                                                           /* set the capacity */
+    handle->pre = pre;                                                                     /* set the pre length */
+    handle->post = post;                                                                   /* set the post length */
+    handle->trigger_mask = trigger_mask;                                                   /* set the trigger mask */
+    handle->state = ADXL362_RECORDER_STATE_RECORD;                                         /* record */
+    handle->inited = 1;                                                                    /* flag finish initialization */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     post a status event
+ * @param[in] *handle pointer to an adxl362 recorder handle structure
+ * @param[in] status status bits from the adxl362 receive callback
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      it only latches the bits so it can run in the receive callback of
+ *            adxl362_irq_handler, the bits are latched and taken atomically with gcc, clang
+ *            and armclang, other compilers must not call it from an interrupt, the trigger
+ *            lands on the first sample of the next update, the fifo backlog drained then
+ *            still predates the event so it ends up as post trigger samples
+ */
+uint8_t adxl362_recorder_trigger(adxl362_recorder_handle_t *handle, uint8_t status)
+{
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    a_adxl362_recorder_latch(&handle->pending, (uint8_t)(status & handle->trigger_mask));  /* latch the bits */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     record raw samples
+ * @param[in] *handle pointer to an adxl362 recorder handle structure
+ * @param[in] *x pointer to an x axis raw buffer
+ * @param[in] *y pointer to a y axis raw buffer
+ * @param[in] *z pointer to a z axis raw buffer
+ * @param[in] len buffer length
+ * @param[in] range range of the raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the callback runs here once the post trigger samples are in, the window
+ *            stays valid until adxl362_recorder_release
+ */
+uint8_t adxl362_recorder_update_raw(adxl362_recorder_handle_t *handle, const int16_t *x, const int16_t *y,
+                                    const int16_t *z, uint16_t len, adxl362_range_t range)
+{
+    uint16_t i;
+    uint8_t status;
+    int16_t scale;
+    int16_t *p;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    status = a_adxl362_recorder_take(&handle->pending);                                    /* take the latched bits */
+    if (status != 0)                                                                       /* check the bits */
+    {
+        if (handle->state == ADXL362_RECORDER_STATE_RECORD)                                /* recording */
+        {
+            a_adxl362_recorder_start(handle, status);                                      /* start a window */
+        }
+        else if (handle->state == ADXL362_RECORDER_STATE_POST)                             /* capturing */
+        {
+            handle->window.status |= status;                                               /* merge into the window */
+        }
+        else
+        {
+            handle->missed++;                                                              /* the window is held */
+        }
+    }
+    scale = (int16_t)(1 << range);                                                         /* mg per lsb */
+    for (i = 0; i < len; i++)                                                              /* all samples */
+    {
+        if ((handle->state == ADXL362_RECORDER_STATE_HOLD) && 
+            (handle->held >= handle->capacity))                                            /* no free space */
+        {
+            handle->dropped++;                                                             /* drop */
+            handle->count = 0;                                                             /* the history breaks */
+            handle->index++;                                                               /* next sample */
+            
+            continue;                                                                      /* next sample */
+        }
+        p = &handle->buf[handle->write * 3];                                               /* write position */
+        p[0] = (int16_t)(x[i] * scale);                                                    /* x in mg */
+        p[1] = (int16_t)(y[i] * scale);                                                    /* y in mg */
+        p[2] = (int16_t)(z[i] * scale);                                                    /* z in mg */
+        handle->write = (handle->write + 1 == handle->capacity) ? 0 : handle->write + 1;   /* next position */
+        handle->count += (handle->count < handle->capacity) ? 1 : 0;                       /* add the history */
+        handle->index++;                                                                   /* next sample */
+        if (handle->state != ADXL362_RECORDER_STATE_RECORD)                                /* window open */
+        {
+            handle->held++;                                                                /* hold the sample */
+            if (handle->state == ADXL362_RECORDER_STATE_POST)                              /* capturing */
+            {
+                handle->post_left--;                                                       /* one less */
+                if (handle->post_left == 0)                                                /* window done */
+                {
+                    a_adxl362_recorder_freeze(handle);                                     /* hand off */
+                }
+            }
+        }
+    }
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     record a fifo block
+ * @param[in] *handle pointer to an adxl362 recorder handle structure
+ * @param[in] *block pointer to a block read by adxl362_read_fifo_block
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 block is NULL
+ * @note      none
+ */
+uint8_t adxl362_recorder_update_block(adxl362_recorder_handle_t *handle, const adxl362_block_t *block)
+{
+    if (block == NULL)                                                                     /* check the block */
+    {
+        return 4;                                                                          /* return error */
+    }
+    
+    return adxl362_recorder_update_raw(handle, block->x, block->y, block->z, block->len, block->range);     /* update */
+}
+
+/**
+ * @brief     release the held window
+ * @param[in] *handle pointer to an adxl362 recorder handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      it can be called in the callback or later, the history restarts after a
+ *            drop so the next window never spans a gap
+ */
+uint8_t adxl362_recorder_release(adxl362_recorder_handle_t *handle)
+{
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    if (handle->state == ADXL362_RECORDER_STATE_HOLD)                                      /* check the window */
+    {
+        handle->held = 0;                                                                  /* free the window */
+        handle->state = ADXL362_RECORDER_STATE_RECORD;                                     /* record */
+    }
+    
+    return 0;                                                                              /* success return 0 */
+}
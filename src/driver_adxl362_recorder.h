@@ -0,0 +1,202 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_recorder.h
+ * @brief     driver adxl362 recorder header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADXL362_RECORDER_H
+#define DRIVER_ADXL362_RECORDER_H
+
+#include "driver_adxl362.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup adxl362_recorder_driver adxl362 recorder driver function
+ * @brief    adxl362 recorder driver modules
+ * @ingroup  adxl362_driver
+ * @{
+ */
+
+/**
+ * @brief     recorder buffer length definition
+ * @param[in] n history samples
+ * @note      the buffer holds packed x, y, z triplets, n * 6 bytes in total,
+ *            e.g. 30s at 100Hz is 3000 samples and 18000 bytes
+ */
+#define ADXL362_RECORDER_BUF_LEN(n)        ((n) * 3)
+
+/**
+ * @brief adxl362 recorder state enumeration definition
+ */
+typedef enum
+{
+    ADXL362_RECORDER_STATE_RECORD = 0x00,        /**< keep the history */
+    ADXL362_RECORDER_STATE_POST   = 0x01,        /**< capture the post trigger samples */
+    ADXL362_RECORDER_STATE_HOLD   = 0x02,        /**< the window is held by the user */
+} adxl362_recorder_state_t;
+
+/**
+ * @brief adxl362 recorder window structure definition
+ * @note  the window points into the history buffer, it may wrap so the samples are
+ *        first then second, both are packed x, y, z triplets in mg
+ */
+typedef struct adxl362_recorder_window_s
+{
+    const int16_t *first;          /**< first part of the window */
+    uint32_t first_len;            /**< samples in the first part */
+    const int16_t *second;         /**< second part of the window, NULL if it does not wrap */
+    uint32_t second_len;           /**< samples in the second part */
+    uint32_t start;                /**< sample index of the first sample */
+    uint32_t pre;                  /**< samples before the trigger */
+    uint32_t len;                  /**< samples in the window */
+    uint8_t status;                /**< status bits that triggered the window */
+} adxl362_recorder_window_t;
+
+/**
+ * @brief adxl362 recorder handle structure definition
+ */
+typedef struct adxl362_recorder_handle_s
+{
+    void (*receive_callback)(const adxl362_recorder_window_t *window);        /**< point to a window callback function address */
+    int16_t *buf;                                                             /**< history buffer */
+    uint32_t capacity;                                                        /**< history samples */
+    uint32_t pre;                                                             /**< samples kept before the trigger */
+    uint32_t post;                                                            /**< samples captured from the trigger on */
+    uint8_t trigger_mask;                                                     /**< status bits that trigger */
+    volatile uint8_t pending;                                                 /**< status bits waiting for the next update */
+    adxl362_recorder_state_t state;                                           /**< recorder state */
+    uint32_t write;                                                           /**< next write position */
+    uint32_t count;                                                           /**< contiguous samples ending at the write position */
+    uint32_t index;                                                           /**< next sample index */
+    uint32_t window_pos;                                                      /**< window start position */
+    uint32_t held;                                                            /**< samples from the window start to the write position */
+    uint32_t post_left;                                                       /**< post trigger samples to capture */
+    uint32_t dropped;                                                         /**< samples dropped while a window is held */
+    uint32_t missed;                                                          /**< triggers ignored while a window is held */
+    adxl362_recorder_window_t window;                                         /**< window handed to the callback */
+    uint8_t inited;                                                           /**< inited flag */
+} adxl362_recorder_handle_t;
+
+/**
+ * @brief     initialize the recorder
+ * @param[in] *handle pointer to an adxl362 recorder handle structure
+ * @param[in] *buf pointer to a history buffer of ADXL362_RECORDER_BUF_LEN(capacity)
+ * @param[in] capacity history samples
+ * @param[in] pre samples kept before the trigger
+ * @param[in] post samples captured from the trigger on
+ * @param[in] trigger_mask status bits that trigger, e.g. ADXL362_STATUS_ACT
+ * @param[in] *callback pointer to a window callback function
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 buf is NULL
+ *            - 5 capacity is invalid
+ *            - 6 window is invalid
+ * @note      0 < pre + post <= capacity, the samples beyond the window keep recording
+ *            while a window is held
+ */
+uint8_t adxl362_recorder_init(adxl362_recorder_handle_t *handle, int16_t *buf, uint32_t capacity,
+                              uint32_t pre, uint32_t post, uint8_t trigger_mask,
+                              void (*callback)(const adxl362_recorder_window_t *window));
+
+/**
+ * @brief     post a status event
+ * @param[in] *handle pointer to an adxl362 recorder handle structure
+ * @param[in] status status bits from the adxl362 receive callback
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      it only latches the bits so it can run in the receive callback of
+ *            adxl362_irq_handler, the bits are latched and taken atomically with gcc, clang
+ *            and armclang, other compilers must not call it from an interrupt, the trigger
+ *            lands on the first sample of the next update, the fifo backlog drained then
+ *            still predates the event so it ends up as post trigger samples
+ */
+uint8_t adxl362_recorder_trigger(adxl362_recorder_handle_t *handle, uint8_t status);
+
+/**
+ * @brief     record raw samples
+ * @param[in] *handle pointer to an adxl362 recorder handle structure
+ * @param[in] *x pointer to an x axis raw buffer
+ * @param[in] *y pointer to a y axis raw buffer
+ * @param[in] *z pointer to a z axis raw buffer
+ * @param[in] len buffer length
+ * @param[in] range range of the raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the callback runs here once the post trigger samples are in, the window
+ *            stays valid until adxl362_recorder_release
+ */
+uint8_t adxl362_recorder_update_raw(adxl362_recorder_handle_t *handle, const int16_t *x, const int16_t *y,
+                                    const int16_t *z, uint16_t len, adxl362_range_t range);
+
+/**
+ * @brief     record a fifo block
+ * @param[in] *handle pointer to an adxl362 recorder handle structure
+ * @param[in] *block pointer to a block read by adxl362_read_fifo_block
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 block is NULL
+ * @note      none
+ */
+uint8_t adxl362_recorder_update_block(adxl362_recorder_handle_t *handle, const adxl362_block_t *block);
+
+/**
+ * @brief     release the held window
+ * @param[in] *handle pointer to an adxl362 recorder handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      it can be called in the callback or later, the history restarts after a
+ *            drop so the next window never spans a gap
+ */
+uint8_t adxl362_recorder_release(adxl362_recorder_handle_t *handle);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,324 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_stats.c
+ * @brief     driver adxl362 stats source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_adxl362_stats.h"
+#include <math.h>
+
+/**
+ * @brief adxl362 stats g per lsb table
+ */
+static const double gsc_adxl362_stats_scale[3] =
+{
+    1.0 / 1000.0,        /**< 2g */
+    1.0 / 500.0,         /**< 4g */
+    1.0 / 250.0,         /**< 8g */
+};
+
+/**
+ * @brief     reset the window
+ * @param[in] *handle pointer to an adxl362 stats handle structure
+ * @note      none
+ */
+static void a_adxl362_stats_reset(adxl362_stats_handle_t *handle)
+{
+    uint8_t i;
+    
+    handle->count = 0;                                                            /* clear the count */
+    for (i = 0; i < 3; i++)                                                       /* reset all axes */
+    {
+        handle->sum[i] = 0;                                                       /* clear the sum */
+        handle->sum_sq[i] = 0;                                                    /* clear the square sum */
+        handle->min[i] = INT16_MAX;                                               /* reset the min */
+        handle->max[i] = INT16_MIN;                                               /* reset the max */
+    }
+}
+
+/**
+ * @brief     accumulate one axis
+ * @param[in] *in pointer to a raw buffer
+ * @param[in] len buffer length
+ * @param[in] *sum pointer to a sum buffer
+ * @param[in] *sum_sq pointer to a square sum buffer
+ * @param[in] *min pointer to a min buffer
+ * @param[in] *max pointer to a max buffer
+ * @note      the loop has no data dependent branch and is vectorized by the compiler
+ */
+static void a_adxl362_stats_axis(const int16_t *in, uint16_t len, int64_t *sum, uint64_t *sum_sq,
+                                 int16_t *min, int16_t *max)
+{
+    uint16_t i;
+    int32_t s;
+    uint64_t q;
+    int16_t lo;
+    int16_t hi;
+    
+    s = 0;                                                                        /* init 0 */
+    q = 0;                                                                        /* init 0 */
+    lo = *min;                                                                    /* get the min */
+    hi = *max;                                                                    /* get the max */
+    for (i = 0; i < len; i++)                                                     /* run all samples */
+    {
+        int32_t v = in[i];                                                        /* get the sample */
+        
+        s += v;                                                                   /* sum, 65535 * 32768 fits in 32 bits */
+        q += (uint64_t)(uint32_t)(v * v);                                         /* square sum */
+        lo = (in[i] < lo) ? in[i] : lo;                                           /* min */
+        hi = (in[i] > hi) ? in[i] : hi;                                           /* max */
+    }
+    *sum += s;                                                                    /* save the sum */
+    *sum_sq += q;                                                                 /* save the square sum */
+    *min = lo;                                                                    /* save the min */
+    *max = hi;                                                                    /* save the max */
+}
+
+/**
+ * @brief     emit the current window
+ * @param[in] *handle pointer to an adxl362 stats handle structure
+ * @note      none
+ */
+static void a_adxl362_stats_emit(adxl362_stats_handle_t *handle)
+{
+    adxl362_stats_summary_t summary;
+    
+    if (adxl362_stats_get_summary(handle, &summary) == 0)                         /* make the summary */
+    {
+        if (handle->receive_callback != NULL)                                     /* check the callback */
+        {
+            handle->receive_callback(&summary);                                   /* run the callback */
+        }
+        handle->index++;                                                          /* next window */
+    }
+    a_adxl362_stats_reset(handle);                                                /* reset the window */
+}
+
+/**
+ * @brief     initialize the stats handle
+ * @param[in] *handle pointer to an adxl362 stats handle structure
+ * @param[in] window samples per window
+ * @param[in] *callback pointer to a summary callback function
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 2 handle is NULL
+ *            - 4 window is invalid
+ * @note      0 < window <= 65535
+ */
+uint8_t adxl362_stats_init(adxl362_stats_handle_t *handle, uint32_t window,
+                           void (*callback)(adxl362_stats_summary_t *summary))
+{
+    if (handle == NULL)                                                           /* check handle */
+    {
+        return 2;                                                                 /* return error */
+    }
+    if ((window == 0) || (window > ADXL362_STATS_MAX_WINDOW))                     /* check the window */
+    {
+        return 4;                                                                 /* return error */
+    }
+    
+    handle->receive_callback = callback;                                          /* set the callback */
+    handle->window = window;                                                      /* set the window */
+    handle->index = 0;                                                            /* init the index */
+    handle->range = ADXL362_RANGE_2G;                                             /* init the range */
+    a_adxl362_stats_reset(handle);                                                /* reset the window */
+    handle->inited = 1;                                                           /* flag finish initialization */
+    
+    return 0;                                                                     /* success return 0 */
+}
+
+/**
+ * @brief     update the stats with raw samples
+ * @param[in] *handle pointer to an adxl362 stats handle structure
+ * @param[in] *x pointer to an x axis raw buffer
+ * @param[in] *y pointer to a y axis raw buffer
+ * @param[in] *z pointer to a z axis raw buffer
+ * @param[in] len sample length
+ * @param[in] range range of the raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 range is invalid
+ * @note      the callback runs once per completed window,
+ *            a range change closes the current window early
+ */
+uint8_t adxl362_stats_update(adxl362_stats_handle_t *handle, const int16_t *x, const int16_t *y, const int16_t *z,
+                             uint16_t len, adxl362_range_t range)
+{
+    uint16_t n;
+    
+    if (handle == NULL)                                                           /* check handle */
+    {
+        return 2;                                                                 /* return error */
+    }
+    if (handle->inited != 1)                                                      /* check handle initialization */
+    {
+        return 3;                                                                 /* return error */
+    }
+    if ((uint8_t)range > (uint8_t)ADXL362_RANGE_8G)                               /* check the range */
+    {
+        return 4;                                                                 /* return error */
+    }
+    
+    if ((handle->count != 0) && (handle->range != range))                         /* range changed */
+    {
+        a_adxl362_stats_emit(handle);                                             /* close the window */
+    }
+    handle->range = range;                                                        /* set the range */
+    while (len != 0)                                                              /* run all samples */
+    {
+        n = (uint16_t)((handle->window - handle->count) < len ? 
+                       (handle->window - handle->count) : len);                   /* samples in this window */
+        a_adxl362_stats_axis(x, n, &handle->sum[0], &handle->sum_sq[0],
+                             &handle->min[0], &handle->max[0]);                   /* x axis */
+        a_adxl362_stats_axis(y, n, &handle->sum[1], &handle->sum_sq[1],
+                             &handle->min[1], &handle->max[1]);                   /* y axis */
+        a_adxl362_stats_axis(z, n, &handle->sum[2], &handle->sum_sq[2],
+                             &handle->min[2], &handle->max[2]);                   /* z axis */
+        handle->count += n;                                                       /* add the count */
+        x += n;                                                                   /* next x */
+        y += n;                                                                   /* next y */
+        z += n;                                                                   /* next z */
+        len -= n;                                                                 /* remaining samples */
+        if (handle->count >= handle->window)                                      /* window is full */
+        {
+            a_adxl362_stats_emit(handle);                                         /* emit the window */
+        }
+    }
+    
+    return 0;                                                                     /* success return 0 */
+}
+
+/**
+ * @brief     update the stats with a fifo block
+ * @param[in] *handle pointer to an adxl362 stats handle structure
+ * @param[in] *block pointer to a block read by adxl362_read_fifo_block
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 block is NULL
+ * @note      none
+ */
+uint8_t adxl362_stats_update_block(adxl362_stats_handle_t *handle, const adxl362_block_t *block)
+{
+    if (block == NULL)                                                            /* check the block */
+    {
+        return 4;                                                                 /* return error */
+    }
+    
+    return adxl362_stats_update(handle, block->x, block->y, block->z, block->len, block->range);        /* update */
+}
+
+/**
+ * @brief     emit the current partial window
+ * @param[in] *handle pointer to an adxl362 stats handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      nothing is emitted if the window is empty
+ */
+uint8_t adxl362_stats_flush(adxl362_stats_handle_t *handle)
+{
+    if (handle == NULL)                                                           /* check handle */
+    {
+        return 2;                                                                 /* return error */
+    }
+    if (handle->inited != 1)                                                      /* check handle initialization */
+    {
+        return 3;                                                                 /* return error */
+    }
+    
+    if (handle->count != 0)                                                       /* check the count */
+    {
+        a_adxl362_stats_emit(handle);                                             /* emit the window */
+    }
+    
+    return 0;                                                                     /* success return 0 */
+}
+
+/**
+ * @brief      make a summary from the accumulated sums
+ * @param[in]  *handle pointer to an adxl362 stats handle structure
+ * @param[out] *summary pointer to a summary buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 window is empty
+ * @note       the window is not reset
+ */
+uint8_t adxl362_stats_get_summary(adxl362_stats_handle_t *handle, adxl362_stats_summary_t *summary)
+{
+    uint8_t i;
+    uint64_t n;
+    uint64_t s2;
+    double scale;
+    
+    if (handle == NULL)                                                           /* check handle */
+    {
+        return 2;                                                                 /* return error */
+    }
+    if (handle->inited != 1)                                                      /* check handle initialization */
+    {
+        return 3;                                                                 /* return error */
+    }
+    if (handle->count == 0)                                                       /* check the count */
+    {
+        return 4;                                                                 /* return error */
+    }
+    
+    n = handle->count;                                                            /* get the count */
+    scale = gsc_adxl362_stats_scale[handle->range];                               /* get the scale */
+    summary->index = handle->index;                                               /* set the index */
+    summary->count = handle->count;                                               /* set the count */
+    summary->range = handle->range;                                               /* set the range */
+    for (i = 0; i < 3; i++)                                                       /* run all axes */
+    {
+        s2 = (uint64_t)(handle->sum[i] < 0 ? -handle->sum[i] : handle->sum[i]);   /* get the abs sum */
+        s2 = s2 * s2;                                                             /* square of the sum */
+        summary->mean[i] = (float)((double)handle->sum[i] / (double)n * scale);   /* mean */
+        summary->rms[i] = (float)(sqrt((double)handle->sum_sq[i] / (double)n) * scale);       /* rms */
+        summary->variance[i] = (float)((double)(n * handle->sum_sq[i] - s2) / 
+                                       (double)(n * n) * scale * scale);          /* exact integer variance */
+        summary->min[i] = (float)((double)handle->min[i] * scale);                /* min */
+        summary->max[i] = (float)((double)handle->max[i] * scale);                /* max */
+        summary->peak_to_peak[i] = (float)((double)((int32_t)handle->max[i] - 
+                                           handle->min[i]) * scale);              /* peak to peak */
+    }
+    
+    return 0;                                                                     /* success return 0 */
+}
@@ -0,0 +1,170 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_stats.h
+ * @brief     driver adxl362 stats header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADXL362_STATS_H
+#define DRIVER_ADXL362_STATS_H
+
+#include "driver_adxl362.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup adxl362_stats_driver adxl362 stats driver function
+ * @brief    adxl362 stats driver modules
+ * @ingroup  adxl362_driver
+ * @{
+ */
+
+/**
+ * @brief adxl362 stats max window definition
+ */
+#define ADXL362_STATS_MAX_WINDOW        65535        /**< keeps the integer sums exact in 64 bits */
+
+/**
+ * @brief adxl362 stats summary structure definition
+ */
+typedef struct adxl362_stats_summary_s
+{
+    uint32_t index;                  /**< window index */
+    uint32_t count;                  /**< sample count */
+    adxl362_range_t range;           /**< range of the window */
+    float mean[3];                   /**< x, y, z mean in g */
+    float rms[3];                    /**< x, y, z rms in g */
+    float variance[3];               /**< x, y, z variance in g^2 */
+    float min[3];                    /**< x, y, z min in g */
+    float max[3];                    /**< x, y, z max in g */
+    float peak_to_peak[3];           /**< x, y, z peak to peak in g */
+} adxl362_stats_summary_t;
+
+/**
+ * @brief adxl362 stats handle structure definition
+ */
+typedef struct adxl362_stats_handle_s
+{
+    void (*receive_callback)(adxl362_stats_summary_t *summary);        /**< point to a receive_callback function address */
+    uint32_t window;                                                   /**< samples per window */
+    uint32_t count;                                                    /**< samples in the current window */
+    uint32_t index;                                                    /**< window index */
+    adxl362_range_t range;                                             /**< range of the current window */
+    int64_t sum[3];                                                    /**< x, y, z raw sum */
+    uint64_t sum_sq[3];                                                /**< x, y, z raw square sum */
+    int16_t min[3];                                                    /**< x, y, z raw min */
+    int16_t max[3];                                                    /**< x, y, z raw max */
+    uint8_t inited;                                                    /**< inited flag */
+} adxl362_stats_handle_t;
+
+/**
+ * @brief     initialize the stats handle
+ * @param[in] *handle pointer to an adxl362 stats handle structure
+ * @param[in] window samples per window
+ * @param[in] *callback pointer to a summary callback function
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 2 handle is NULL
+ *            - 4 window is invalid
+ * @note      0 < window <= 65535
+ */
+uint8_t adxl362_stats_init(adxl362_stats_handle_t *handle, uint32_t window,
+                           void (*callback)(adxl362_stats_summary_t *summary));
+
+/**
+ * @brief     update the stats with raw samples
+ * @param[in] *handle pointer to an adxl362 stats handle structure
+ * @param[in] *x pointer to an x axis raw buffer
+ * @param[in] *y pointer to a y axis raw buffer
+ * @param[in] *z pointer to a z axis raw buffer
+ * @param[in] len sample length
+ * @param[in] range range of the raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 range is invalid
+ * @note      the callback runs once per completed window,
+ *            a range change closes the current window early
+ */
+uint8_t adxl362_stats_update(adxl362_stats_handle_t *handle, const int16_t *x, const int16_t *y, const int16_t *z,
+                             uint16_t len, adxl362_range_t range);
+
+/**
+ * @brief     update the stats with a fifo block
+ * @param[in] *handle pointer to an adxl362 stats handle structure
+ * @param[in] *block pointer to a block read by adxl362_read_fifo_block
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 block is NULL
+ * @note      none
+ */
+uint8_t adxl362_stats_update_block(adxl362_stats_handle_t *handle, const adxl362_block_t *block);
+
+/**
+ * @brief     emit the current partial window
+ * @param[in] *handle pointer to an adxl362 stats handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      nothing is emitted if the window is empty
+ */
+uint8_t adxl362_stats_flush(adxl362_stats_handle_t *handle);
+
+/**
+ * @brief      make a summary from the accumulated sums
+ * @param[in]  *handle pointer to an adxl362 stats handle structure
+ * @param[out] *summary pointer to a summary buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 window is empty
+ * @note       the window is not reset
+ */
+uint8_t adxl362_stats_get_summary(adxl362_stats_handle_t *handle, adxl362_stats_summary_t *summary);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
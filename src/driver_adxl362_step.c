@@ -0,0 +1,326 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_step.c
+ * @brief     driver adxl362 step source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_adxl362_step.h"
+#include <string.h>
+
+/**
+ * @brief adxl362 step rate table definition
+ * @note  indexed by odr - ADXL362_ODR_25HZ, the high pass corner is about 0.5Hz
+ *        and the box low pass keeps about 3.5Hz
+ */
+static const uint16_t gsc_adxl362_step_rate[3] = {25, 50, 100};        /**< odr in Hz */
+static const uint8_t gsc_adxl362_step_hp_shift[3] = {3, 4, 5};        /**< high pass shift */
+static const uint8_t gsc_adxl362_step_box_len[3] = {3, 6, 13};        /**< low pass box length */
+
+/**
+ * @brief     integer square root
+ * @param[in] v input value
+ * @return    floor of the square root
+ * @note      none
+ */
+static uint32_t a_adxl362_step_isqrt(uint32_t v)
+{
+    uint32_t r;
+    uint32_t b;
+    
+    r = 0;                                                                        /* init 0 */
+    b = (uint32_t)1 << 30;                                                        /* highest even bit */
+    while (b > v)                                                                 /* find the start bit */
+    {
+        b >>= 2;                                                                  /* next bit */
+    }
+    while (b != 0)                                                                /* all bits */
+    {
+        if (v >= r + b)                                                           /* check the bit */
+        {
+            v -= r + b;                                                           /* remove */
+            r = (r >> 1) + b;                                                     /* set the bit */
+        }
+        else
+        {
+            r >>= 1;                                                              /* clear the bit */
+        }
+        b >>= 2;                                                                  /* next bit */
+    }
+    
+    return r;                                                                     /* return the root */
+}
+
+/**
+ * @brief     handle a detected peak
+ * @param[in] *handle pointer to an adxl362 step handle structure
+ * @param[in] peak peak value in mg
+ * @note      a train needs ADXL362_STEP_REGULATION steps in a row before it is counted,
+ *            which rejects single bumps, then the buffered steps are added at once
+ */
+static void a_adxl362_step_peak(adxl362_step_handle_t *handle, int32_t peak)
+{
+    uint8_t i;
+    uint8_t n;
+    uint32_t sum;
+    
+    if (handle->train == 0)                                                       /* new train */
+    {
+        handle->train = 1;                                                        /* first step */
+    }
+    else
+    {
+        handle->interval[handle->interval_index] = handle->since;                 /* save the interval */
+        handle->interval_index = (uint8_t)((handle->interval_index + 1) % 
+                                           ADXL362_STEP_INTERVALS);              /* next index */
+        if (handle->train < 0xFFFF)                                               /* check the train */
+        {
+            handle->train++;                                                      /* add one */
+        }
+    }
+    if (handle->train == ADXL362_STEP_REGULATION)                                 /* train confirmed */
+    {
+        handle->info.steps += ADXL362_STEP_REGULATION;                            /* add the buffered steps */
+    }
+    else if (handle->train > ADXL362_STEP_REGULATION)                             /* walking */
+    {
+        handle->info.steps++;                                                     /* add one */
+    }
+    else
+    {
+        /* not confirmed yet */
+    }
+    if (handle->train >= ADXL362_STEP_REGULATION)                                 /* cadence is valid */
+    {
+        n = (uint8_t)(handle->train - 1);                                         /* intervals */
+        n = n > ADXL362_STEP_INTERVALS ? ADXL362_STEP_INTERVALS : n;              /* limit */
+        sum = 0;                                                                  /* init 0 */
+        for (i = 0; i < n; i++)                                                   /* newest intervals */
+        {
+            sum += handle->interval[(handle->interval_index + ADXL362_STEP_INTERVALS - 1 - i) % 
+                                    ADXL362_STEP_INTERVALS];                      /* add */
+        }
+        handle->info.cadence = (uint16_t)((60U * handle->rate * n + sum / 2) / sum);    /* steps per minute */
+        handle->info.last_step = handle->sample - 1;                              /* the peak is one sample back */
+    }
+    handle->peak += (peak - handle->peak) >> 2;                                   /* track the peak height */
+    handle->threshold = (handle->peak * 3) >> 3;                                  /* 3/8 of the peaks, left and right steps differ */
+    if (handle->threshold < handle->threshold_min)                                /* check the min */
+    {
+        handle->threshold = handle->threshold_min;                                /* limit */
+    }
+    handle->since = 0;                                                            /* restart the interval */
+    handle->armed = 0;                                                            /* wait for a zero crossing */
+}
+
+/**
+ * @brief     initialize the step handle
+ * @param[in] *handle pointer to an adxl362 step handle structure
+ * @param[in] odr output data rate
+ * @param[in] threshold_mg min peak threshold in mg
+ * @param[in] *callback pointer to a step callback function
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 odr is invalid
+ *            - 5 threshold is invalid
+ * @note      odr is 25Hz, 50Hz or 100Hz, 0 < threshold_mg <= 2000, 50mg suits wrist and hip
+ */
+uint8_t adxl362_step_init(adxl362_step_handle_t *handle, adxl362_odr_t odr, uint16_t threshold_mg,
+                          void (*callback)(adxl362_step_info_t *info))
+{
+    uint8_t i;
+    
+    if (handle == NULL)                                                           /* check handle */
+    {
+        return 2;                                                                 /* return error */
+    }
+    if ((odr < ADXL362_ODR_25HZ) || (odr > ADXL362_ODR_100HZ))                    /* check the odr */
+    {
+        return 4;                                                                 /* return error */
+    }
+    if ((threshold_mg == 0) || (threshold_mg > 2000))                             /* check the threshold */
+    {
+        return 5;                                                                 /* return error */
+    }
+    
+    memset(handle, 0, sizeof(adxl362_step_handle_t));                             /* clear the handle */
+    i = (uint8_t)(odr - ADXL362_ODR_25HZ);                                        /* table index */
+    handle->receive_callback = callback;                                          /* set the callback */
+    handle->rate = gsc_adxl362_step_rate[i];                                      /* set the rate */
+    handle->hp_shift = gsc_adxl362_step_hp_shift[i];                              /* set the high pass shift */
+    handle->box_len = gsc_adxl362_step_box_len[i];                                /* set the box length */
+    handle->mean = 1000 << 8;                                                     /* start at 1g */
+    handle->threshold_min = threshold_mg;                                         /* set the min threshold */
+    handle->threshold = threshold_mg;                                             /* set the threshold */
+    handle->peak = (int32_t)threshold_mg * 2;                                     /* set the peak */
+    handle->inited = 1;                                                           /* flag finish initialization */
+    
+    return 0;                                                                     /* success return 0 */
+}
+
+/**
+ * @brief     run the step detector over raw samples
+ * @param[in] *handle pointer to an adxl362 step handle structure
+ * @param[in] *x pointer to an x axis raw buffer
+ * @param[in] *y pointer to a y axis raw buffer
+ * @param[in] *z pointer to a z axis raw buffer
+ * @param[in] len buffer length
+ * @param[in] range range of the raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the callback runs once per call if the step count or the cadence changed, so the
+ *            end of walking is reported with a cadence of 0
+ */
+uint8_t adxl362_step_update(adxl362_step_handle_t *handle, const int16_t *x, const int16_t *y,
+                            const int16_t *z, uint16_t len, adxl362_range_t range)
+{
+    uint16_t i;
+    uint32_t steps;
+    uint16_t cadence;
+    int32_t mag;
+    int32_t lp;
+    
+    if (handle == NULL)                                                           /* check handle */
+    {
+        return 2;                                                                 /* return error */
+    }
+    if (handle->inited != 1)                                                      /* check handle initialization */
+    {
+        return 3;                                                                 /* return error */
+    }
+    
+    steps = handle->info.steps;                                                   /* save the steps */
+    cadence = handle->info.cadence;                                               /* save the cadence */
+    for (i = 0; i < len; i++)                                                     /* all samples */
+    {
+        /* magnitude in mg, one lsb is 1mg, 2mg and 4mg in the 2g, 4g and 8g range */
+        mag = (int32_t)a_adxl362_step_isqrt((uint32_t)((int32_t)x[i] * x[i]) + 
+                                            (uint32_t)((int32_t)y[i] * y[i]) + 
+                                            (uint32_t)((int32_t)z[i] * z[i]));  /* raw magnitude */
+        mag <<= (uint8_t)range;                                                   /* to mg */
+        
+        /* band pass, the running mean removes gravity and the box removes the jitter */
+        handle->mean += ((mag << 8) - handle->mean) >> handle->hp_shift;          /* track the mean */
+        handle->box_sum -= handle->box[handle->box_index];                        /* remove the oldest */
+        handle->box[handle->box_index] = mag - (handle->mean >> 8);               /* high passed */
+        handle->box_sum += handle->box[handle->box_index];                        /* add the newest */
+        handle->box_index = (uint8_t)((handle->box_index + 1) % handle->box_len); /* next index */
+        lp = handle->box_sum / handle->box_len;                                   /* low passed */
+        handle->sample++;                                                         /* next sample */
+        
+        /* a step is a local max above the threshold after a zero crossing and a refractory time */
+        if (handle->since < 0xFFFF)                                               /* check the interval */
+        {
+            handle->since++;                                                      /* add one */
+        }
+        if (lp < 0)                                                               /* zero crossing */
+        {
+            handle->armed = 1;                                                    /* arm */
+        }
+        if ((handle->armed != 0) && (handle->prev[1] > handle->prev[0]) && 
+            (handle->prev[1] >= lp) && (handle->prev[1] > handle->threshold) && 
+            (handle->since >= handle->rate / 4))                                  /* check the peak */
+        {
+            if (handle->since > handle->rate * 2)                                 /* too slow for walking */
+            {
+                handle->train = 0;                                                /* new train */
+            }
+            a_adxl362_step_peak(handle, handle->prev[1]);                         /* handle the peak */
+        }
+        if ((handle->since > handle->rate * 2) && (handle->train != 0))           /* walking stopped */
+        {
+            handle->train = 0;                                                    /* end the train */
+            handle->info.cadence = 0;                                             /* clear the cadence */
+            handle->peak = handle->threshold_min * 2;                             /* forget the peak height */
+            handle->threshold = handle->threshold_min;                            /* reset the threshold */
+        }
+        handle->prev[0] = handle->prev[1];                                        /* shift */
+        handle->prev[1] = lp;                                                     /* save */
+    }
+    if (((handle->info.steps != steps) || (handle->info.cadence != cadence)) && 
+        (handle->receive_callback != NULL))                                       /* check the steps and the cadence */
+    {
+        handle->receive_callback(&handle->info);                                  /* run the callback */
+    }
+    
+    return 0;                                                                     /* success return 0 */
+}
+
+/**
+ * @brief     run the step detector over a fifo block
+ * @param[in] *handle pointer to an adxl362 step handle structure
+ * @param[in] *block pointer to a block read by adxl362_read_fifo_block
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 block is NULL
+ * @note      none
+ */
+uint8_t adxl362_step_update_block(adxl362_step_handle_t *handle, const adxl362_block_t *block)
+{
+    if (block == NULL)                                                            /* check the block */
+    {
+        return 4;                                                                 /* return error */
+    }
+    
+    return adxl362_step_update(handle, block->x, block->y, block->z, block->len, block->range);        /* update */
+}
+
+/**
+ * @brief      get the step info
+ * @param[in]  *handle pointer to an adxl362 step handle structure
+ * @param[out] *info pointer to a step info structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t adxl362_step_get_info(adxl362_step_handle_t *handle, adxl362_step_info_t *info)
+{
+    if (handle == NULL)                                                           /* check handle */
+    {
+        return 2;                                                                 /* return error */
+    }
+    if (handle->inited != 1)                                                      /* check handle initialization */
+    {
+        return 3;                                                                 /* return error */
+    }
+    
+    *info = handle->info;                                                         /* get the info */
+    
+    return 0;                                                                     /* success return 0 */
+}
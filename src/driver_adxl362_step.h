@@ -0,0 +1,165 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_step.h
+ * @brief     driver adxl362 step header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADXL362_STEP_H
+#define DRIVER_ADXL362_STEP_H
+
+#include "driver_adxl362.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup adxl362_step_driver adxl362 step driver function
+ * @brief    adxl362 step driver modules
+ * @ingroup  adxl362_driver
+ * @{
+ */
+
+/**
+ * @brief adxl362 step definition
+ */
+#define ADXL362_STEP_MAX_BOX              16        /**< max low pass box length */
+#define ADXL362_STEP_INTERVALS            4         /**< intervals averaged by the cadence */
+#define ADXL362_STEP_REGULATION           4         /**< steps in a row before counting */
+
+/**
+ * @brief adxl362 step info structure definition
+ */
+typedef struct adxl362_step_info_s
+{
+    uint32_t steps;            /**< total steps */
+    uint16_t cadence;          /**< steps per minute, 0 if not walking */
+    uint32_t last_step;        /**< sample index of the last step */
+} adxl362_step_info_t;
+
+/**
+ * @brief adxl362 step handle structure definition
+ * @note  the pipeline is magnitude, band pass, adaptive peak threshold and cadence, all in integers
+ */
+typedef struct adxl362_step_handle_s
+{
+    void (*receive_callback)(adxl362_step_info_t *info);        /**< point to a receive_callback function address */
+    adxl362_step_info_t info;                                   /**< step info */
+    uint16_t rate;                                              /**< odr in Hz */
+    uint8_t hp_shift;                                           /**< high pass shift */
+    uint8_t box_len;                                            /**< low pass box length */
+    int32_t mean;                                               /**< magnitude mean in mg q8 */
+    int32_t box[ADXL362_STEP_MAX_BOX];                          /**< low pass box */
+    int32_t box_sum;                                            /**< low pass box sum */
+    uint8_t box_index;                                          /**< low pass box index */
+    int32_t prev[2];                                            /**< last two filtered samples */
+    int32_t threshold_min;                                      /**< min peak threshold in mg */
+    int32_t threshold;                                          /**< peak threshold in mg */
+    int32_t peak;                                               /**< peak average in mg */
+    uint16_t since;                                             /**< samples since the last step */
+    uint16_t interval[ADXL362_STEP_INTERVALS];                  /**< last step intervals */
+    uint8_t interval_index;                                     /**< interval index */
+    uint16_t train;                                             /**< steps in the current train */
+    uint8_t armed;                                              /**< 1 if the signal crossed zero since the last step */
+    uint32_t sample;                                            /**< sample index */
+    uint8_t inited;                                             /**< inited flag */
+} adxl362_step_handle_t;
+
+/**
+ * @brief     initialize the step handle
+ * @param[in] *handle pointer to an adxl362 step handle structure
+ * @param[in] odr output data rate
+ * @param[in] threshold_mg min peak threshold in mg
+ * @param[in] *callback pointer to a step callback function
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 odr is invalid
+ *            - 5 threshold is invalid
+ * @note      odr is 25Hz, 50Hz or 100Hz, 0 < threshold_mg <= 2000, 50mg suits wrist and hip
+ */
+uint8_t adxl362_step_init(adxl362_step_handle_t *handle, adxl362_odr_t odr, uint16_t threshold_mg,
+                          void (*callback)(adxl362_step_info_t *info));
+
+/**
+ * @brief     run the step detector over raw samples
+ * @param[in] *handle pointer to an adxl362 step handle structure
+ * @param[in] *x pointer to an x axis raw buffer
+ * @param[in] *y pointer to a y axis raw buffer
+ * @param[in] *z pointer to a z axis raw buffer
+ * @param[in] len buffer length
+ * @param[in] range range of the raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the callback runs once per call if the step count or the cadence changed, so the
+ *            end of walking is reported with a cadence of 0
+ */
+uint8_t adxl362_step_update(adxl362_step_handle_t *handle, const int16_t *x, const int16_t *y,
+                            const int16_t *z, uint16_t len, adxl362_range_t range);
+
+/**
+ * @brief     run the step detector over a fifo block
+ * @param[in] *handle pointer to an adxl362 step handle structure
+ * @param[in] *block pointer to a block read by adxl362_read_fifo_block
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 block is NULL
+ * @note      none
+ */
+uint8_t adxl362_step_update_block(adxl362_step_handle_t *handle, const adxl362_block_t *block);
+
+/**
+ * @brief      get the step info
+ * @param[in]  *handle pointer to an adxl362 step handle structure
+ * @param[out] *info pointer to a step info structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t adxl362_step_get_info(adxl362_step_handle_t *handle, adxl362_step_info_t *info);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
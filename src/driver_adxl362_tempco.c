@@ -0,0 +1,336 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_tempco.c
+ * @brief     driver adxl362 tempco source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_adxl362_tempco.h"
+#include <math.h>
+#include <string.h>
+
+/**
+ * @brief adxl362 tempco temperature scale definition
+ */
+#define ADXL362_TEMPCO_SCALE        0.065f        /**< C per lsb, same as adxl362_read_temperature */
+
+/**
+ * @brief     recompute the offsets
+ * @param[in] *handle pointer to an adxl362 tempco handle structure
+ * @note      runs once per temperature or range change, never per sample
+ */
+static void a_adxl362_tempco_update(adxl362_tempco_handle_t *handle)
+{
+    uint8_t i;
+    uint8_t a;
+    int8_t j;
+    float t;
+    float f;
+    float v;
+    
+    t = (float)handle->temperature_raw * ADXL362_TEMPCO_SCALE;                               /* temperature in C */
+    if (handle->model == ADXL362_TEMPCO_MODEL_TABLE)                                         /* table */
+    {
+        if (t <= handle->point[0].temperature)                                               /* below the table */
+        {
+            memcpy(handle->offset, handle->point[0].offset, sizeof(float) * 3);              /* hold the first */
+        }
+        else if (t >= handle->point[handle->len - 1].temperature)                            /* above the table */
+        {
+            memcpy(handle->offset, handle->point[handle->len - 1].offset, 
+                   sizeof(float) * 3);                                                       /* hold the last */
+        }
+        else
+        {
+            for (i = 1; i < handle->len - 1; i++)                                            /* find the segment */
+            {
+                if (t < handle->point[i].temperature)                                        /* check the end */
+                {
+                    break;                                                                   /* found */
+                }
+            }
+            f = (t - handle->point[i - 1].temperature) / 
+                (handle->point[i].temperature - handle->point[i - 1].temperature);           /* segment fraction */
+            for (a = 0; a < 3; a++)                                                          /* all axes */
+            {
+                handle->offset[a] = handle->point[i - 1].offset[a] + 
+                                    f * (handle->point[i].offset[a] - handle->point[i - 1].offset[a]);  /* interpolate */
+            }
+        }
+    }
+    else
+    {
+        t -= handle->reference;                                                              /* around the reference */
+        for (a = 0; a < 3; a++)                                                              /* all axes */
+        {
+            v = 0.0f;                                                                        /* init 0 */
+            for (j = ADXL362_TEMPCO_ORDER; j >= 0; j--)                                      /* horner */
+            {
+                v = v * t + handle->coefficient[a][j];                                       /* next term */
+            }
+            handle->offset[a] = v;                                                           /* set the offset */
+        }
+    }
+    for (a = 0; a < 3; a++)                                                                  /* all axes */
+    {
+        handle->offset_raw[a] = (int16_t)floorf(handle->offset[a] / 
+                                               (float)(1 << (uint8_t)handle->range) + 0.5f); /* one lsb is 1, 2 or 4mg */
+    }
+    handle->dirty = 0;                                                                       /* up to date */
+}
+
+/**
+ * @brief     initialize with a piecewise linear table
+ * @param[in] *handle pointer to an adxl362 tempco handle structure
+ * @param[in] *point pointer to a point table
+ * @param[in] len table length
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 len is invalid
+ *            - 5 temperatures are not increasing
+ * @note      0 < len <= 16, the offset is held flat outside the table
+ */
+uint8_t adxl362_tempco_init_table(adxl362_tempco_handle_t *handle, const adxl362_tempco_point_t *point, uint8_t len)
+{
+    uint8_t i;
+    
+    if (handle == NULL)                                                                      /* check handle */
+    {
+        return 2;                                                                            /* return error */
+    }
+    if ((len == 0) || (len > ADXL362_TEMPCO_MAX_POINTS))                                     /* check the length */
+    {
+        return 4;                                                                            /* return error */
+    }
+    for (i = 1; i < len; i++)                                                                /* all points */
+    {
+        if (point[i].temperature <= point[i - 1].temperature)                                /* check the order */
+        {
+            return 5;                                                                        /* return error */
+        }
+    }
+    
+    memset(handle, 0, sizeof(adxl362_tempco_handle_t));                                      /* clear the handle */
+    handle->model = ADXL362_TEMPCO_MODEL_TABLE;                                              /* set the model */
+    memcpy(handle->point, point, sizeof(adxl362_tempco_point_t) * len);                      /* copy the table */
+    handle->len = len;                                                                       /* set the length */
+    handle->range = ADXL362_RANGE_2G;                                                        /* init the range */
+    handle->inited = 1;                                                                      /* flag finish initialization */
+    
+    return 0;                                                                                /* success return 0 */
+}
+
+/**
+ * @brief     initialize with a polynomial
+ * @param[in] *handle pointer to an adxl362 tempco handle structure
+ * @param[in] reference reference temperature in C
+ * @param[in] *coefficient pointer to x, y, z coefficients in mg
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      offset = c[0] + c[1] * dt + c[2] * dt^2 + c[3] * dt^3 with dt = t - reference
+ */
+uint8_t adxl362_tempco_init_polynomial(adxl362_tempco_handle_t *handle, float reference,
+                                       const float coefficient[3][ADXL362_TEMPCO_ORDER + 1])
+{
+    if (handle == NULL)                                                                      /* check handle */
+    {
+        return 2;                                                                            /* return error */
+    }
+    
+    memset(handle, 0, sizeof(adxl362_tempco_handle_t));                                      /* clear the handle */
+    handle->model = ADXL362_TEMPCO_MODEL_POLYNOMIAL;                                         /* set the model */
+    handle->reference = reference;                                                           /* set the reference */
+    memcpy(handle->coefficient, coefficient, sizeof(handle->coefficient));                   /* copy the coefficients */
+    handle->range = ADXL362_RANGE_2G;                                                        /* init the range */
+    handle->inited = 1;                                                                      /* flag finish initialization */
+    
+    return 0;                                                                                /* success return 0 */
+}
+
+/**
+ * @brief     set the temperature
+ * @param[in] *handle pointer to an adxl362 tempco handle structure
+ * @param[in] raw raw temperature from adxl362_read_temperature or the fifo
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the offsets are only recomputed if the raw temperature changed
+ */
+uint8_t adxl362_tempco_set_temperature(adxl362_tempco_handle_t *handle, int16_t raw)
+{
+    if (handle == NULL)                                                                      /* check handle */
+    {
+        return 2;                                                                            /* return error */
+    }
+    if (handle->inited != 1)                                                                 /* check handle initialization */
+    {
+        return 3;                                                                            /* return error */
+    }
+    
+    if ((handle->temperature_valid == 0) || (handle->temperature_raw != raw))                /* check the change */
+    {
+        handle->temperature_raw = raw;                                                       /* set the temperature */
+        handle->temperature_valid = 1;                                                       /* set valid */
+        handle->dirty = 1;                                                                   /* recompute later */
+    }
+    
+    return 0;                                                                                /* success return 0 */
+}
+
+/**
+ * @brief         remove the offsets from raw samples
+ * @param[in]     *handle pointer to an adxl362 tempco handle structure
+ * @param[in,out] *x pointer to an x axis raw buffer
+ * @param[in,out] *y pointer to a y axis raw buffer
+ * @param[in,out] *z pointer to a z axis raw buffer
+ * @param[in]     len buffer length
+ * @param[in]     range range of the raw data
+ * @return        status code
+ *                - 0 success
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ * @note          the samples are left unchanged until a temperature is set
+ */
+uint8_t adxl362_tempco_apply(adxl362_tempco_handle_t *handle, int16_t *x, int16_t *y, int16_t *z,
+                             uint16_t len, adxl362_range_t range)
+{
+    uint16_t i;
+    int16_t ox;
+    int16_t oy;
+    int16_t oz;
+    
+    if (handle == NULL)                                                                      /* check handle */
+    {
+        return 2;                                                                            /* return error */
+    }
+    if (handle->inited != 1)                                                                 /* check handle initialization */
+    {
+        return 3;                                                                            /* return error */
+    }
+    if (handle->temperature_valid == 0)                                                      /* check the temperature */
+    {
+        return 0;                                                                            /* success return 0 */
+    }
+    
+    if (handle->range != range)                                                              /* range changed */
+    {
+        handle->range = range;                                                               /* set the range */
+        handle->dirty = 1;                                                                   /* recompute */
+    }
+    if (handle->dirty != 0)                                                                  /* check the offsets */
+    {
+        a_adxl362_tempco_update(handle);                                                     /* update the offsets */
+    }
+    
+    /* the hot loop is a plain subtraction */
+    ox = handle->offset_raw[0];                                                              /* x offset */
+    oy = handle->offset_raw[1];                                                              /* y offset */
+    oz = handle->offset_raw[2];                                                              /* z offset */
+    for (i = 0; i < len; i++)                                                                /* all samples */
+    {
+        x[i] = (int16_t)(x[i] - ox);                                                         /* correct x */
+        y[i] = (int16_t)(y[i] - oy);                                                         /* correct y */
+        z[i] = (int16_t)(z[i] - oz);                                                         /* correct z */
+    }
+    
+    return 0;                                                                                /* success return 0 */
+}
+
+/**
+ * @brief         remove the offsets from a fifo block
+ * @param[in]     *handle pointer to an adxl362 tempco handle structure
+ * @param[in,out] *block pointer to a block read by adxl362_read_fifo_block
+ * @return        status code
+ *                - 0 success
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ *                - 4 block is NULL
+ * @note          the block temperature is used if the fifo stores it, call it right after the read
+ */
+uint8_t adxl362_tempco_apply_block(adxl362_tempco_handle_t *handle, adxl362_block_t *block)
+{
+    uint8_t res;
+    
+    if (block == NULL)                                                                       /* check the block */
+    {
+        return 4;                                                                            /* return error */
+    }
+    
+    if (block->temperature_valid != 0)                                                       /* check the block temperature */
+    {
+        res = adxl362_tempco_set_temperature(handle, block->temperature_raw);                /* set the temperature */
+        if (res != 0)                                                                        /* check the result */
+        {
+            return res;                                                                      /* return error */
+        }
+    }
+    
+    return adxl362_tempco_apply(handle, block->x, block->y, block->z, block->len, block->range);        /* apply */
+}
+
+/**
+ * @brief      get the current offsets
+ * @param[in]  *handle pointer to an adxl362 tempco handle structure
+ * @param[out] *offset pointer to an x, y, z offset buffer in mg
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 no temperature is set
+ * @note       none
+ */
+uint8_t adxl362_tempco_get_offset(adxl362_tempco_handle_t *handle, float offset[3])
+{
+    if (handle == NULL)                                                                      /* check handle */
+    {
+        return 2;                                                                            /* return error */
+    }
+    if (handle->inited != 1)                                                                 /* check handle initialization */
+    {
+        return 3;                                                                            /* return error */
+    }
+    if (handle->temperature_valid == 0)                                                      /* check the temperature */
+    {
+        return 4;                                                                            /* return error */
+    }
+    
+    if (handle->dirty != 0)                                                                  /* check the offsets */
+    {
+        a_adxl362_tempco_update(handle);                                                     /* update the offsets */
+    }
+    memcpy(offset, handle->offset, sizeof(float) * 3);                                       /* copy the offsets */
+    
+    return 0;                                                                                /* success return 0 */
+}
@@ -0,0 +1,186 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_tempco.h
+ * @brief     driver adxl362 tempco header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADXL362_TEMPCO_H
+#define DRIVER_ADXL362_TEMPCO_H
+
+#include "driver_adxl362.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup adxl362_tempco_driver adxl362 tempco driver function
+ * @brief    adxl362 tempco driver modules
+ * @ingroup  adxl362_driver
+ * @{
+ */
+
+/**
+ * @brief adxl362 tempco definition
+ */
+#define ADXL362_TEMPCO_MAX_POINTS        16        /**< max table points */
+#define ADXL362_TEMPCO_ORDER             3         /**< polynomial order */
+
+/**
+ * @brief adxl362 tempco model enumeration definition
+ */
+typedef enum
+{
+    ADXL362_TEMPCO_MODEL_TABLE      = 0x00,        /**< piecewise linear table */
+    ADXL362_TEMPCO_MODEL_POLYNOMIAL = 0x01,        /**< polynomial around a reference temperature */
+} adxl362_tempco_model_t;
+
+/**
+ * @brief adxl362 tempco point structure definition
+ */
+typedef struct adxl362_tempco_point_s
+{
+    float temperature;        /**< temperature in C */
+    float offset[3];          /**< x, y, z zero g offset in mg */
+} adxl362_tempco_point_t;
+
+/**
+ * @brief adxl362 tempco handle structure definition
+ */
+typedef struct adxl362_tempco_handle_s
+{
+    adxl362_tempco_model_t model;                                   /**< model */
+    adxl362_tempco_point_t point[ADXL362_TEMPCO_MAX_POINTS];        /**< table points */
+    uint8_t len;                                                    /**< table length */
+    float reference;                                                /**< polynomial reference temperature in C */
+    float coefficient[3][ADXL362_TEMPCO_ORDER + 1];                 /**< x, y, z polynomial coefficients in mg */
+    int16_t temperature_raw;                                        /**< temperature of the current offsets */
+    uint8_t temperature_valid;                                      /**< 1 if a temperature is known */
+    uint8_t dirty;                                                  /**< 1 if the offsets must be recomputed */
+    adxl362_range_t range;                                          /**< range of the raw offsets */
+    float offset[3];                                                /**< current x, y, z offset in mg */
+    int16_t offset_raw[3];                                          /**< current x, y, z offset in raw */
+    uint8_t inited;                                                 /**< inited flag */
+} adxl362_tempco_handle_t;
+
+/**
+ * @brief     initialize with a piecewise linear table
+ * @param[in] *handle pointer to an adxl362 tempco handle structure
+ * @param[in] *point pointer to a point table
+ * @param[in] len table length
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 len is invalid
+ *            - 5 temperatures are not increasing
+ * @note      0 < len <= 16, the offset is held flat outside the table
+ */
+uint8_t adxl362_tempco_init_table(adxl362_tempco_handle_t *handle, const adxl362_tempco_point_t *point, uint8_t len);
+
+/**
+ * @brief     initialize with a polynomial
+ * @param[in] *handle pointer to an adxl362 tempco handle structure
+ * @param[in] reference reference temperature in C
+ * @param[in] *coefficient pointer to x, y, z coefficients in mg
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      offset = c[0] + c[1] * dt + c[2] * dt^2 + c[3] * dt^3 with dt = t - reference
+ */
+uint8_t adxl362_tempco_init_polynomial(adxl362_tempco_handle_t *handle, float reference,
+                                       const float coefficient[3][ADXL362_TEMPCO_ORDER + 1]);
+
+/**
+ * @brief     set the temperature
+ * @param[in] *handle pointer to an adxl362 tempco handle structure
+ * @param[in] raw raw temperature from adxl362_read_temperature or the fifo
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the offsets are only recomputed if the raw temperature changed
+ */
+uint8_t adxl362_tempco_set_temperature(adxl362_tempco_handle_t *handle, int16_t raw);
+
+/**
+ * @brief         remove the offsets from raw samples
+ * @param[in]     *handle pointer to an adxl362 tempco handle structure
+ * @param[in,out] *x pointer to an x axis raw buffer
+ * @param[in,out] *y pointer to a y axis raw buffer
+ * @param[in,out] *z pointer to a z axis raw buffer
+ * @param[in]     len buffer length
+ * @param[in]     range range of the raw data
+ * @return        status code
+ *                - 0 success
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ * @note          the samples are left unchanged until a temperature is set
+ */
+uint8_t adxl362_tempco_apply(adxl362_tempco_handle_t *handle, int16_t *x, int16_t *y, int16_t *z,
+                             uint16_t len, adxl362_range_t range);
+
+/**
+ * @brief         remove the offsets from a fifo block
+ * @param[in]     *handle pointer to an adxl362 tempco handle structure
+ * @param[in,out] *block pointer to a block read by adxl362_read_fifo_block
+ * @return        status code
+ *                - 0 success
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ *                - 4 block is NULL
+ * @note          the block temperature is used if the fifo stores it, call it right after the read
+ */
+uint8_t adxl362_tempco_apply_block(adxl362_tempco_handle_t *handle, adxl362_block_t *block);
+
+/**
+ * @brief      get the current offsets
+ * @param[in]  *handle pointer to an adxl362 tempco handle structure
+ * @param[out] *offset pointer to an x, y, z offset buffer in mg
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 no temperature is set
+ * @note       none
+ */
+uint8_t adxl362_tempco_get_offset(adxl362_tempco_handle_t *handle, float offset[3]);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
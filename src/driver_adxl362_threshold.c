@@ -0,0 +1,373 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_threshold.c
+ * @brief     driver adxl362 threshold source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_adxl362_threshold.h"
+#include <string.h>
+
+/**
+ * @brief adxl362 threshold unused timer definition
+ */
+#define ADXL362_THRESHOLD_TIME_UNUSED        0x7FFFFFFF                                         /**< never reached by the counter */
+
+/**
+ * @brief     convert the thresholds to the raw unit of a range
+ * @param[in] *handle pointer to an adxl362 threshold handle structure
+ * @param[in] range range of the raw data
+ * @note      one lsb is 1mg, 2mg and 4mg in the 2g, 4g and 8g range
+ */
+static void a_adxl362_threshold_set_range(adxl362_threshold_handle_t *handle, adxl362_range_t range)
+{
+    uint8_t d;
+    
+    for (d = 0; d < handle->detectors; d++)                                                     /* all detectors */
+    {
+        handle->threshold[d] = ((int32_t)handle->threshold_mg[d] + 
+                               ((1 << (uint8_t)range) >> 1)) >> (uint8_t)range;                 /* round to raw */
+    }
+    handle->range = range;                                                                      /* set the range */
+}
+
+/**
+ * @brief     capture the references and clear the timers
+ * @param[in] *handle pointer to an adxl362 threshold handle structure
+ * @param[in] x x axis raw data
+ * @param[in] y y axis raw data
+ * @param[in] z z axis raw data
+ * @note      absolute detectors keep a zero reference
+ */
+static void a_adxl362_threshold_arm(adxl362_threshold_handle_t *handle, int16_t x, int16_t y, int16_t z)
+{
+    uint8_t d;
+    int32_t r;
+    
+    for (d = 0; d < ADXL362_THRESHOLD_MAX_DETECTORS; d++)                                       /* all detectors */
+    {
+        r = handle->rebase_activity[d] | handle->rebase_inactivity[d];                          /* referenced mask */
+        handle->ref_x[d] = x & r;                                                               /* set the x reference */
+        handle->ref_y[d] = y & r;                                                               /* set the y reference */
+        handle->ref_z[d] = z & r;                                                               /* set the z reference */
+        handle->count[d] = 0;                                                                   /* clear the timer */
+        handle->latched[d] = 0;                                                                 /* clear the latch */
+    }
+    handle->rearm = 0;                                                                          /* armed */
+}
+
+/**
+ * @brief     initialize the threshold handle
+ * @param[in] *handle pointer to an adxl362 threshold handle structure
+ * @param[in] *callback pointer to an event callback function
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      none
+ */
+uint8_t adxl362_threshold_init(adxl362_threshold_handle_t *handle, void (*callback)(adxl362_threshold_event_t *event))
+{
+    uint8_t d;
+    
+    if (handle == NULL)                                                                         /* check handle */
+    {
+        return 2;                                                                               /* return error */
+    }
+    
+    memset(handle, 0, sizeof(adxl362_threshold_handle_t));                                      /* clear the handle */
+    for (d = 0; d < ADXL362_THRESHOLD_MAX_DETECTORS; d++)                                       /* all detectors */
+    {
+        handle->time[d] = ADXL362_THRESHOLD_TIME_UNUSED;                                        /* unused slot never fires */
+    }
+    handle->receive_callback = callback;                                                        /* set the callback */
+    handle->range = ADXL362_RANGE_2G;                                                           /* init the range */
+    handle->rearm = 1;                                                                          /* arm at the first sample */
+    handle->inited = 1;                                                                         /* flag finish initialization */
+    
+    return 0;                                                                                   /* success return 0 */
+}
+
+/**
+ * @brief      add a threshold and timer pair
+ * @param[in]  *handle pointer to an adxl362 threshold handle structure
+ * @param[in]  type detector type
+ * @param[in]  trigger absolute or referenced
+ * @param[in]  threshold_mg threshold in mg
+ * @param[in]  time consecutive samples to trigger
+ * @param[out] *index pointer to a detector index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 detectors are full
+ *             - 5 threshold is invalid
+ *             - 6 time is invalid
+ *             - 7 index is NULL
+ * @note       the semantics mirror the chip, a referenced activity detector takes its reference when
+ *             armed and again after every event, a referenced inactivity detector takes it whenever
+ *             the still period is broken, an inactivity detector latches and fires once per still
+ *             period, 0 < threshold_mg <= 8000, 0 < time <= 65535
+ */
+uint8_t adxl362_threshold_add_detector(adxl362_threshold_handle_t *handle, adxl362_threshold_type_t type,
+                                    adxl362_detect_trigger_t trigger, uint16_t threshold_mg,
+                                    uint16_t time, uint8_t *index)
+{
+    uint8_t d;
+    int32_t referenced;
+    
+    if (handle == NULL)                                                                         /* check handle */
+    {
+        return 2;                                                                               /* return error */
+    }
+    if (handle->inited != 1)                                                                    /* check handle initialization */
+    {
+        return 3;                                                                               /* return error */
+    }
+    if (handle->detectors >= ADXL362_THRESHOLD_MAX_DETECTORS)                                   /* check the detectors */
+    {
+        return 4;                                                                               /* return error */
+    }
+    if ((threshold_mg == 0) || (threshold_mg > 8000))                                           /* check the threshold */
+    {
+        return 5;                                                                               /* return error */
+    }
+    if (time == 0)                                                                              /* check the time */
+    {
+        return 6;                                                                               /* return error */
+    }
+    if (index == NULL)                                                                          /* check the index */
+    {
+        return 7;                                                                               /* return error */
+    }
+    
+    d = handle->detectors;                                                                      /* next slot */
+    referenced = (trigger == ADXL362_DETECT_TRIGGER_REFERENCED) ? -1 : 0;                       /* referenced mask */
+    handle->threshold_mg[d] = threshold_mg;                                                     /* set the threshold */
+    handle->time[d] = time;                                                                     /* set the time */
+    handle->count[d] = 0;                                                                       /* clear the timer */
+    handle->activity[d] = (type == ADXL362_THRESHOLD_TYPE_ACTIVITY) ? -1 : 0;                   /* set the type */
+    handle->rebase_activity[d] = referenced & handle->activity[d];                              /* referenced activity */
+    handle->rebase_inactivity[d] = referenced & ~handle->activity[d];                           /* referenced inactivity */
+    handle->detectors++;                                                                        /* add one */
+    a_adxl362_threshold_set_range(handle, handle->range);                                       /* convert the threshold */
+    handle->rearm = 1;                                                                          /* take new references */
+    *index = d;                                                                                 /* set the index */
+    
+    return 0;                                                                                   /* success return 0 */
+}
+
+/**
+ * @brief     run the detectors over raw samples
+ * @param[in] *handle pointer to an adxl362 threshold handle structure
+ * @param[in] *x pointer to an x axis raw buffer
+ * @param[in] *y pointer to a y axis raw buffer
+ * @param[in] *z pointer to a z axis raw buffer
+ * @param[in] len buffer length
+ * @param[in] range range of the raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      a range change restarts all timers and references
+ */
+uint8_t adxl362_threshold_update(adxl362_threshold_handle_t *handle, const int16_t *x, const int16_t *y,
+                              const int16_t *z, uint16_t len, adxl362_range_t range)
+{
+    uint16_t i;
+    uint8_t d;
+    int32_t sx, sy, sz;
+    int32_t dx, dy, dz;
+    int32_t m;
+    int32_t hit;
+    int32_t c;
+    int32_t fired;
+    int32_t rebase;
+    int32_t any;
+    adxl362_threshold_event_t event;
+    
+    if (handle == NULL)                                                                         /* check handle */
+    {
+        return 2;                                                                               /* return error */
+    }
+    if (handle->inited != 1)                                                                    /* check handle initialization */
+    {
+        return 3;                                                                               /* return error */
+    }
+    if (len == 0)                                                                               /* check the length */
+    {
+        return 0;                                                                               /* success return 0 */
+    }
+    
+    if (handle->range != range)                                                                 /* range changed */
+    {
+        a_adxl362_threshold_set_range(handle, range);                                           /* convert the thresholds */
+        handle->rearm = 1;                                                                      /* references are invalid */
+    }
+    if (handle->rearm != 0)                                                                     /* check the arm flag */
+    {
+        a_adxl362_threshold_arm(handle, x[0], y[0], z[0]);                                      /* arm at the first sample */
+    }
+    
+    for (i = 0; i < len; i++)                                                                   /* all samples */
+    {
+        sx = x[i];                                                                              /* get x */
+        sy = y[i];                                                                              /* get y */
+        sz = z[i];                                                                              /* get z */
+        any = 0;                                                                                /* init 0 */
+        
+        /* branch free so the detector loop maps onto vector lanes */
+        for (d = 0; d < ADXL362_THRESHOLD_MAX_DETECTORS; d++)                                   /* all detectors */
+        {
+            dx = sx - handle->ref_x[d];                                                         /* x deviation */
+            dy = sy - handle->ref_y[d];                                                         /* y deviation */
+            dz = sz - handle->ref_z[d];                                                         /* z deviation */
+            dx = dx < 0 ? -dx : dx;                                                             /* abs */
+            dy = dy < 0 ? -dy : dy;                                                             /* abs */
+            dz = dz < 0 ? -dz : dz;                                                             /* abs */
+            m = dx > dy ? dx : dy;                                                              /* max of x and y */
+            m = m > dz ? m : dz;                                                                /* max of all axes */
+            hit = (-(int32_t)(m > handle->threshold[d]) & handle->activity[d]) | 
+                  (-(int32_t)(m < handle->threshold[d]) & ~handle->activity[d]);                /* condition of the type */
+            c = (handle->count[d] + 1) & hit & ~handle->latched[d];                             /* consecutive samples */
+            fired = -(int32_t)(c >= handle->time[d]);                                           /* timer reached */
+            handle->count[d] = c & ~fired;                                                      /* restart after an event */
+            handle->latched[d] = (handle->latched[d] | (fired & ~handle->activity[d])) & hit;   /* hold until the still period breaks */
+            rebase = (fired & handle->rebase_activity[d]) | 
+                     (~hit & handle->rebase_inactivity[d]);                                     /* new reference */
+            handle->ref_x[d] = (handle->ref_x[d] & ~rebase) | (sx & rebase);                    /* update the x reference */
+            handle->ref_y[d] = (handle->ref_y[d] & ~rebase) | (sy & rebase);                    /* update the y reference */
+            handle->ref_z[d] = (handle->ref_z[d] & ~rebase) | (sz & rebase);                    /* update the z reference */
+            handle->fired[d] = fired;                                                           /* save the result */
+            any |= fired;                                                                       /* any event */
+        }
+        
+        /* events are rare, so they are reported outside the vector loop */
+        if (any != 0)                                                                           /* check the events */
+        {
+            for (d = 0; d < handle->detectors; d++)                                             /* all used detectors */
+            {
+                if (handle->fired[d] != 0)                                                      /* check the detector */
+                {
+                    handle->status |= (uint32_t)1 << d;                                         /* latch the status */
+                    if (handle->receive_callback != NULL)                                       /* check the callback */
+                    {
+                        event.detector = d;                                                     /* set the detector */
+                        event.type = (handle->activity[d] != 0) ? ADXL362_THRESHOLD_TYPE_ACTIVITY : 
+                                                                  ADXL362_THRESHOLD_TYPE_INACTIVITY;      /* set the type */
+                        event.sample = handle->sample + i;                                      /* set the sample */
+                        event.x = x[i];                                                         /* set x */
+                        event.y = y[i];                                                         /* set y */
+                        event.z = z[i];                                                         /* set z */
+                        handle->receive_callback(&event);                                       /* run the callback */
+                    }
+                }
+            }
+        }
+    }
+    handle->sample += len;                                                                      /* next sample index */
+    
+    return 0;                                                                                   /* success return 0 */
+}
+
+/**
+ * @brief     run the detectors over a fifo block
+ * @param[in] *handle pointer to an adxl362 threshold handle structure
+ * @param[in] *block pointer to a block read by adxl362_read_fifo_block
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 block is NULL
+ * @note      none
+ */
+uint8_t adxl362_threshold_update_block(adxl362_threshold_handle_t *handle, const adxl362_block_t *block)
+{
+    if (block == NULL)                                                                          /* check the block */
+    {
+        return 4;                                                                               /* return error */
+    }
+    
+    return adxl362_threshold_update(handle, block->x, block->y, block->z, block->len, block->range);        /* update */
+}
+
+/**
+ * @brief      get and clear the latched status
+ * @param[in]  *handle pointer to an adxl362 threshold handle structure
+ * @param[out] *status pointer to a status buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       bit n is set if detector n fired since the last call
+ */
+uint8_t adxl362_threshold_get_status(adxl362_threshold_handle_t *handle, uint32_t *status)
+{
+    if (handle == NULL)                                                                         /* check handle */
+    {
+        return 2;                                                                               /* return error */
+    }
+    if (handle->inited != 1)                                                                    /* check handle initialization */
+    {
+        return 3;                                                                               /* return error */
+    }
+    
+    *status = handle->status;                                                                   /* get the status */
+    handle->status = 0;                                                                         /* clear the status */
+    
+    return 0;                                                                                   /* success return 0 */
+}
+
+/**
+ * @brief     restart all timers and references
+ * @param[in] *handle pointer to an adxl362 threshold handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the detectors are kept
+ */
+uint8_t adxl362_threshold_reset(adxl362_threshold_handle_t *handle)
+{
+    if (handle == NULL)                                                                         /* check handle */
+    {
+        return 2;                                                                               /* return error */
+    }
+    if (handle->inited != 1)                                                                    /* check handle initialization */
+    {
+        return 3;                                                                               /* return error */
+    }
+    
+    handle->status = 0;                                                                         /* clear the status */
+    handle->rearm = 1;                                                                          /* arm at the next sample */
+    
+    return 0;                                                                                   /* success return 0 */
+}
@@ -0,0 +1,205 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_threshold.h
+ * @brief     driver adxl362 threshold header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADXL362_THRESHOLD_H
+#define DRIVER_ADXL362_THRESHOLD_H
+
+#include "driver_adxl362.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup adxl362_threshold_driver adxl362 threshold driver function
+ * @brief    adxl362 threshold driver modules
+ * @ingroup  adxl362_driver
+ * @{
+ */
+
+/**
+ * @brief adxl362 threshold max detectors definition
+ */
+#define ADXL362_THRESHOLD_MAX_DETECTORS        16        /**< one bit per detector in the status mask */
+
+/**
+ * @brief adxl362 threshold type enumeration definition
+ */
+typedef enum
+{
+    ADXL362_THRESHOLD_TYPE_INACTIVITY = 0x00,        /**< all axes stay below the threshold */
+    ADXL362_THRESHOLD_TYPE_ACTIVITY   = 0x01,        /**< any axis stays above the threshold */
+} adxl362_threshold_type_t;
+
+/**
+ * @brief adxl362 threshold event structure definition
+ */
+typedef struct adxl362_threshold_event_s
+{
+    uint8_t detector;                     /**< detector index */
+    adxl362_threshold_type_t type;        /**< detector type */
+    uint32_t sample;                      /**< sample index since init */
+    int16_t x;                            /**< x axis raw data of the triggering sample */
+    int16_t y;                            /**< y axis raw data of the triggering sample */
+    int16_t z;                            /**< z axis raw data of the triggering sample */
+} adxl362_threshold_event_t;
+
+/**
+ * @brief adxl362 threshold handle structure definition
+ * @note  the detector state is stored as structure of arrays so one sample is checked
+ *        against all detectors in a single vector loop
+ */
+typedef struct adxl362_threshold_handle_s
+{
+    void (*receive_callback)(adxl362_threshold_event_t *event);        /**< point to a receive_callback function address */
+    int32_t threshold[ADXL362_THRESHOLD_MAX_DETECTORS];                /**< threshold in raw of the current range */
+    int32_t time[ADXL362_THRESHOLD_MAX_DETECTORS];                     /**< consecutive samples to trigger */
+    int32_t count[ADXL362_THRESHOLD_MAX_DETECTORS];                    /**< consecutive samples so far */
+    int32_t ref_x[ADXL362_THRESHOLD_MAX_DETECTORS];                    /**< x axis reference */
+    int32_t ref_y[ADXL362_THRESHOLD_MAX_DETECTORS];                    /**< y axis reference */
+    int32_t ref_z[ADXL362_THRESHOLD_MAX_DETECTORS];                    /**< z axis reference */
+    int32_t activity[ADXL362_THRESHOLD_MAX_DETECTORS];                 /**< -1 for activity, 0 for inactivity */
+    int32_t rebase_activity[ADXL362_THRESHOLD_MAX_DETECTORS];          /**< -1 for referenced activity */
+    int32_t rebase_inactivity[ADXL362_THRESHOLD_MAX_DETECTORS];        /**< -1 for referenced inactivity */
+    int32_t fired[ADXL362_THRESHOLD_MAX_DETECTORS];                    /**< -1 if fired by the last sample */
+    int32_t latched[ADXL362_THRESHOLD_MAX_DETECTORS];                  /**< -1 while an inactivity event holds */
+    uint16_t threshold_mg[ADXL362_THRESHOLD_MAX_DETECTORS];            /**< threshold in mg */
+    uint32_t sample;                                                   /**< sample index */
+    uint32_t status;                                                   /**< latched fired detectors */
+    adxl362_range_t range;                                             /**< range of the thresholds */
+    uint8_t detectors;                                                 /**< detector number */
+    uint8_t rearm;                                                     /**< 1 if the references must be captured */
+    uint8_t inited;                                                    /**< inited flag */
+} adxl362_threshold_handle_t;
+
+/**
+ * @brief     initialize the threshold handle
+ * @param[in] *handle pointer to an adxl362 threshold handle structure
+ * @param[in] *callback pointer to an event callback function
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      none
+ */
+uint8_t adxl362_threshold_init(adxl362_threshold_handle_t *handle, void (*callback)(adxl362_threshold_event_t *event));
+
+/**
+ * @brief      add a threshold and timer pair
+ * @param[in]  *handle pointer to an adxl362 threshold handle structure
+ * @param[in]  type detector type
+ * @param[in]  trigger absolute or referenced
+ * @param[in]  threshold_mg threshold in mg
+ * @param[in]  time consecutive samples to trigger
+ * @param[out] *index pointer to a detector index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 detectors are full
+ *             - 5 threshold is invalid
+ *             - 6 time is invalid
+ *             - 7 index is NULL
+ * @note       the semantics mirror the chip, a referenced activity detector takes its reference when
+ *             armed and again after every event, a referenced inactivity detector takes it whenever
+ *             the still period is broken, an inactivity detector latches and fires once per still
+ *             period, 0 < threshold_mg <= 8000, 0 < time <= 65535
+ */
+uint8_t adxl362_threshold_add_detector(adxl362_threshold_handle_t *handle, adxl362_threshold_type_t type,
+                                    adxl362_detect_trigger_t trigger, uint16_t threshold_mg,
+                                    uint16_t time, uint8_t *index);
+
+/**
+ * @brief     run the detectors over raw samples
+ * @param[in] *handle pointer to an adxl362 threshold handle structure
+ * @param[in] *x pointer to an x axis raw buffer
+ * @param[in] *y pointer to a y axis raw buffer
+ * @param[in] *z pointer to a z axis raw buffer
+ * @param[in] len buffer length
+ * @param[in] range range of the raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      a range change restarts all timers and references
+ */
+uint8_t adxl362_threshold_update(adxl362_threshold_handle_t *handle, const int16_t *x, const int16_t *y,
+                              const int16_t *z, uint16_t len, adxl362_range_t range);
+
+/**
+ * @brief     run the detectors over a fifo block
+ * @param[in] *handle pointer to an adxl362 threshold handle structure
+ * @param[in] *block pointer to a block read by adxl362_read_fifo_block
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 block is NULL
+ * @note      none
+ */
+uint8_t adxl362_threshold_update_block(adxl362_threshold_handle_t *handle, const adxl362_block_t *block);
+
+/**
+ * @brief      get and clear the latched status
+ * @param[in]  *handle pointer to an adxl362 threshold handle structure
+ * @param[out] *status pointer to a status buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       bit n is set if detector n fired since the last call
+ */
+uint8_t adxl362_threshold_get_status(adxl362_threshold_handle_t *handle, uint32_t *status);
+
+/**
+ * @brief     restart all timers and references
+ * @param[in] *handle pointer to an adxl362 threshold handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the detectors are kept
+ */
+uint8_t adxl362_threshold_reset(adxl362_threshold_handle_t *handle);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,315 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_tilt.c
+ * @brief     driver adxl362 tilt source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_adxl362_tilt.h"
+
+/**
+ * @brief adxl362 tilt constant definition
+ */
+#define ADXL362_TILT_PI_2          1.57079632679f        /**< pi / 2 */
+#define ADXL362_TILT_PI            3.14159265359f        /**< pi */
+#define ADXL362_TILT_DEGREE        57.2957795131f        /**< degrees per radian */
+
+/**
+ * @brief adxl362 tilt float bits union definition
+ */
+typedef union adxl362_tilt_bits_u
+{
+    float f;          /**< float view */
+    int32_t i;        /**< bits view */
+} adxl362_tilt_bits_t;
+
+/**
+ * @brief     atan2 approximation
+ * @param[in] y y input
+ * @param[in] x x input
+ * @return    angle in degrees
+ * @note      odd minimax polynomial of atan on [0, 1] with an error below 2e-6 rad, the octant
+ *            fix up selects on the float bits, which order like integers for positive floats,
+ *            because float compares may trap and block the if conversion of the caller loops
+ */
+static inline float a_adxl362_tilt_atan2(float y, float x)
+{
+    adxl362_tilt_bits_t vx;
+    adxl362_tilt_bits_t vy;
+    adxl362_tilt_bits_t vn;
+    adxl362_tilt_bits_t vm;
+    adxl362_tilt_bits_t vr;
+    adxl362_tilt_bits_t vt;
+    int32_t ax;
+    int32_t ay;
+    int32_t mask;
+    float a;
+    float s;
+    
+    vx.f = x;                                                                          /* x bits */
+    vy.f = y;                                                                          /* y bits */
+    ax = vx.i & 0x7FFFFFFF;                                                            /* abs x */
+    ay = vy.i & 0x7FFFFFFF;                                                            /* abs y */
+    mask = -(int32_t)(ay > ax);                                                        /* -1 in the second octant */
+    vn.i = (ay & ~mask) | (ax & mask);                                                 /* min */
+    vm.i = (ax & ~mask) | (ay & mask);                                                 /* max */
+    a = vn.f / (vm.f + 1e-30f);                                                        /* ratio in [0, 1], 0 for 0 / 0 */
+    s = a * a;                                                                         /* square */
+    vr.f = (((((-0.01172120f * s + 0.05265332f) * s - 0.11643287f) * s + 
+               0.19354346f) * s - 0.33262347f) * s + 0.99997726f) * a;                 /* atan of the ratio */
+    vt.f = ADXL362_TILT_PI_2 - vr.f;                                                   /* second octant value */
+    vr.i = (vr.i & ~mask) | (vt.i & mask);                                             /* second octant */
+    mask = -(int32_t)((uint32_t)vx.i >> 31);                                           /* -1 if x is negative */
+    vt.f = ADXL362_TILT_PI - vr.f;                                                     /* left half value */
+    vr.i = (vr.i & ~mask) | (vt.i & mask);                                             /* left half */
+    vr.i ^= vy.i & (int32_t)0x80000000U;                                               /* sign of y */
+    
+    return vr.f * ADXL362_TILT_DEGREE;                                                 /* to degrees */
+}
+
+/**
+ * @brief     square root approximation
+ * @param[in] s input value
+ * @return    square root
+ * @note      bit level reciprocal root seed with two newton steps, the relative error is below 5e-6,
+ *            it works without a fpu sqrt and does not set errno, so the caller loops vectorize
+ */
+static inline float a_adxl362_tilt_sqrt(float s)
+{
+    adxl362_tilt_bits_t v;
+    float r;
+    
+    v.f = s;                                                                           /* set the value */
+    v.i = 0x5F375A86 - (v.i >> 1);                                                     /* reciprocal root seed */
+    r = v.f;                                                                           /* get the seed */
+    r = r * (1.5f - 0.5f * s * r * r);                                                 /* first newton step */
+    r = r * (1.5f - 0.5f * s * r * r);                                                 /* second newton step */
+    
+    return s * r;                                                                      /* root */
+}
+
+/**
+ * @brief      convert the work buffers to angles
+ * @param[in]  *handle pointer to an adxl362 tilt handle structure
+ * @param[in]  n vector number
+ * @param[out] *pitch pointer to a pitch buffer, NULL to skip
+ * @param[out] *roll pointer to a roll buffer, NULL to skip
+ * @param[out] *tilt pointer to a tilt buffer, NULL to skip
+ * @note       one pass per output keeps every loop simple enough for the vectorizer
+ */
+static void a_adxl362_tilt_run(adxl362_tilt_handle_t *handle, uint16_t n, float *pitch, float *roll, float *tilt)
+{
+    uint16_t i;
+    const float *x = handle->x;
+    const float *y = handle->y;
+    const float *z = handle->z;
+    
+    if (pitch != NULL)                                                                 /* check the pitch */
+    {
+        for (i = 0; i < n; i++)                                                        /* all vectors */
+        {
+            pitch[i] = a_adxl362_tilt_atan2(-x[i], a_adxl362_tilt_sqrt(y[i] * y[i] + z[i] * z[i]));    /* pitch */
+        }
+    }
+    if (roll != NULL)                                                                  /* check the roll */
+    {
+        for (i = 0; i < n; i++)                                                        /* all vectors */
+        {
+            roll[i] = a_adxl362_tilt_atan2(y[i], z[i]);                                /* roll */
+        }
+    }
+    if (tilt != NULL)                                                                  /* check the tilt */
+    {
+        for (i = 0; i < n; i++)                                                        /* all vectors */
+        {
+            tilt[i] = a_adxl362_tilt_atan2(a_adxl362_tilt_sqrt(x[i] * x[i] + y[i] * y[i]), z[i]);      /* tilt */
+        }
+    }
+}
+
+/**
+ * @brief     initialize the tilt handle
+ * @param[in] *handle pointer to an adxl362 tilt handle structure
+ * @param[in] average samples averaged before each conversion
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 average is invalid
+ * @note      0 < average <= 256, 1 converts every sample
+ */
+uint8_t adxl362_tilt_init(adxl362_tilt_handle_t *handle, uint16_t average)
+{
+    if (handle == NULL)                                                                /* check handle */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if ((average == 0) || (average > ADXL362_TILT_MAX_AVERAGE))                        /* check the average */
+    {
+        return 4;                                                                      /* return error */
+    }
+    
+    handle->average = average;                                                         /* set the average */
+    handle->count = 0;                                                                 /* clear the count */
+    handle->sum[0] = 0;                                                                /* clear the x sum */
+    handle->sum[1] = 0;                                                                /* clear the y sum */
+    handle->sum[2] = 0;                                                                /* clear the z sum */
+    handle->range = ADXL362_RANGE_2G;                                                  /* init the range */
+    handle->inited = 1;                                                                /* flag finish initialization */
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      convert raw samples to angles
+ * @param[in]  *handle pointer to an adxl362 tilt handle structure
+ * @param[in]  *x pointer to an x axis raw buffer
+ * @param[in]  *y pointer to a y axis raw buffer
+ * @param[in]  *z pointer to a z axis raw buffer
+ * @param[in]  len buffer length
+ * @param[in]  range range of the raw data
+ * @param[out] *pitch pointer to a pitch buffer in degrees, NULL to skip
+ * @param[out] *roll pointer to a roll buffer in degrees, NULL to skip
+ * @param[out] *tilt pointer to a tilt from vertical buffer in degrees, NULL to skip
+ * @param[out] *out_len pointer to an output length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the buffers hold at least len / average + 1 angles, the partial average is kept
+ *             for the next call and dropped on a range change,
+ *             pitch = atan2(-x, sqrt(y^2 + z^2)), roll = atan2(y, z), tilt = atan2(sqrt(x^2 + y^2), z),
+ *             the approximation error is below 0.001 degrees
+ */
+uint8_t adxl362_tilt_convert(adxl362_tilt_handle_t *handle, const int16_t *x, const int16_t *y,
+                             const int16_t *z, uint16_t len, adxl362_range_t range,
+                             float *pitch, float *roll, float *tilt, uint16_t *out_len)
+{
+    uint16_t i;
+    uint16_t n;
+    uint16_t total;
+    
+    if (handle == NULL)                                                                /* check handle */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (handle->inited != 1)                                                           /* check handle initialization */
+    {
+        return 3;                                                                      /* return error */
+    }
+    
+    if (handle->range != range)                                                        /* range changed */
+    {
+        handle->count = 0;                                                             /* drop the partial average */
+        handle->sum[0] = 0;                                                            /* clear the x sum */
+        handle->sum[1] = 0;                                                            /* clear the y sum */
+        handle->sum[2] = 0;                                                            /* clear the z sum */
+        handle->range = range;                                                         /* set the range */
+    }
+    
+    total = 0;                                                                         /* init 0 */
+    while (len != 0)                                                                   /* run all chunks */
+    {
+        n = 0;                                                                         /* init 0 */
+        if (handle->average == 1)                                                      /* no averaging */
+        {
+            n = len < ADXL362_TILT_CHUNK ? len : ADXL362_TILT_CHUNK;                   /* chunk length */
+            for (i = 0; i < n; i++)                                                    /* widen */
+            {
+                handle->x[i] = (float)x[i];                                            /* x */
+                handle->y[i] = (float)y[i];                                            /* y */
+                handle->z[i] = (float)z[i];                                            /* z */
+            }
+            x += n;                                                                    /* next x */
+            y += n;                                                                    /* next y */
+            z += n;                                                                    /* next z */
+            len -= n;                                                                  /* remaining samples */
+        }
+        else
+        {
+            /* the angles do not depend on the scale, so the sums are used without a division */
+            while ((len != 0) && (n < ADXL362_TILT_CHUNK))                             /* fill a chunk */
+            {
+                handle->sum[0] += *x++;                                                /* add x */
+                handle->sum[1] += *y++;                                                /* add y */
+                handle->sum[2] += *z++;                                                /* add z */
+                len--;                                                                 /* remaining samples */
+                handle->count++;                                                       /* add one */
+                if (handle->count == handle->average)                                  /* average done */
+                {
+                    handle->x[n] = (float)handle->sum[0];                              /* x */
+                    handle->y[n] = (float)handle->sum[1];                              /* y */
+                    handle->z[n] = (float)handle->sum[2];                              /* z */
+                    n++;                                                               /* add one */
+                    handle->count = 0;                                                 /* clear the count */
+                    handle->sum[0] = 0;                                                /* clear the x sum */
+                    handle->sum[1] = 0;                                                /* clear the y sum */
+                    handle->sum[2] = 0;                                                /* clear the z sum */
+                }
+            }
+        }
+        a_adxl362_tilt_run(handle, n, 
+                           pitch != NULL ? pitch + total : NULL, 
+                           roll != NULL ? roll + total : NULL, 
+                           tilt != NULL ? tilt + total : NULL);                        /* convert */
+        total = (uint16_t)(total + n);                                                 /* add the chunk */
+    }
+    *out_len = total;                                                                  /* set the output length */
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      convert a fifo block to angles
+ * @param[in]  *handle pointer to an adxl362 tilt handle structure
+ * @param[in]  *block pointer to a block read by adxl362_read_fifo_block
+ * @param[out] *pitch pointer to a pitch buffer in degrees, NULL to skip
+ * @param[out] *roll pointer to a roll buffer in degrees, NULL to skip
+ * @param[out] *tilt pointer to a tilt from vertical buffer in degrees, NULL to skip
+ * @param[out] *out_len pointer to an output length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 block is NULL
+ * @note       none
+ */
+uint8_t adxl362_tilt_convert_block(adxl362_tilt_handle_t *handle, const adxl362_block_t *block,
+                                   float *pitch, float *roll, float *tilt, uint16_t *out_len)
+{
+    if (block == NULL)                                                                 /* check the block */
+    {
+        return 4;                                                                      /* return error */
+    }
+    
+    return adxl362_tilt_convert(handle, block->x, block->y, block->z, block->len, block->range,
+                                pitch, roll, tilt, out_len);                           /* convert */
+}
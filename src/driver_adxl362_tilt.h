@@ -0,0 +1,137 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_tilt.h
+ * @brief     driver adxl362 tilt header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADXL362_TILT_H
+#define DRIVER_ADXL362_TILT_H
+
+#include "driver_adxl362.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup adxl362_tilt_driver adxl362 tilt driver function
+ * @brief    adxl362 tilt driver modules
+ * @ingroup  adxl362_driver
+ * @{
+ */
+
+/**
+ * @brief adxl362 tilt definition
+ */
+#define ADXL362_TILT_MAX_AVERAGE        256        /**< max samples per angle */
+#define ADXL362_TILT_CHUNK              128        /**< vectors converted per pass */
+
+/**
+ * @brief adxl362 tilt handle structure definition
+ */
+typedef struct adxl362_tilt_handle_s
+{
+    uint16_t average;                           /**< samples per angle */
+    uint16_t count;                             /**< samples in the partial average */
+    int32_t sum[3];                             /**< x, y, z partial sums */
+    adxl362_range_t range;                      /**< range of the partial sums */
+    float x[ADXL362_TILT_CHUNK];                /**< x work buffer */
+    float y[ADXL362_TILT_CHUNK];                /**< y work buffer */
+    float z[ADXL362_TILT_CHUNK];                /**< z work buffer */
+    uint8_t inited;                             /**< inited flag */
+} adxl362_tilt_handle_t;
+
+/**
+ * @brief     initialize the tilt handle
+ * @param[in] *handle pointer to an adxl362 tilt handle structure
+ * @param[in] average samples averaged before each conversion
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 average is invalid
+ * @note      0 < average <= 256, 1 converts every sample
+ */
+uint8_t adxl362_tilt_init(adxl362_tilt_handle_t *handle, uint16_t average);
+
+/**
+ * @brief      convert raw samples to angles
+ * @param[in]  *handle pointer to an adxl362 tilt handle structure
+ * @param[in]  *x pointer to an x axis raw buffer
+ * @param[in]  *y pointer to a y axis raw buffer
+ * @param[in]  *z pointer to a z axis raw buffer
+ * @param[in]  len buffer length
+ * @param[in]  range range of the raw data
+ * @param[out] *pitch pointer to a pitch buffer in degrees, NULL to skip
+ * @param[out] *roll pointer to a roll buffer in degrees, NULL to skip
+ * @param[out] *tilt pointer to a tilt from vertical buffer in degrees, NULL to skip
+ * @param[out] *out_len pointer to an output length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the buffers hold at least len / average + 1 angles, the partial average is kept
+ *             for the next call and dropped on a range change,
+ *             pitch = atan2(-x, sqrt(y^2 + z^2)), roll = atan2(y, z), tilt = atan2(sqrt(x^2 + y^2), z),
+ *             the approximation error is below 0.001 degrees
+ */
+uint8_t adxl362_tilt_convert(adxl362_tilt_handle_t *handle, const int16_t *x, const int16_t *y,
+                             const int16_t *z, uint16_t len, adxl362_range_t range,
+                             float *pitch, float *roll, float *tilt, uint16_t *out_len);
+
+/**
+ * @brief      convert a fifo block to angles
+ * @param[in]  *handle pointer to an adxl362 tilt handle structure
+ * @param[in]  *block pointer to a block read by adxl362_read_fifo_block
+ * @param[out] *pitch pointer to a pitch buffer in degrees, NULL to skip
+ * @param[out] *roll pointer to a roll buffer in degrees, NULL to skip
+ * @param[out] *tilt pointer to a tilt from vertical buffer in degrees, NULL to skip
+ * @param[out] *out_len pointer to an output length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 block is NULL
+ * @note       none
+ */
+uint8_t adxl362_tilt_convert_block(adxl362_tilt_handle_t *handle, const adxl362_block_t *block,
+                                   float *pitch, float *roll, float *tilt, uint16_t *out_len);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
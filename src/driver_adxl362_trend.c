@@ -0,0 +1,311 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_trend.c
+ * @brief     driver adxl362 trend source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_adxl362_trend.h"
+#include <string.h>
+
+/**
+ * @brief adxl362 trend definition
+ */
+#define ADXL362_TREND_CHUNK        64            /**< decoded samples per chunk */
+#define ADXL362_TREND_OPEN         1.0e30f       /**< slope of an open door */
+
+/**
+ * @brief adxl362 trend g per lsb table
+ */
+static const float gsc_adxl362_trend_scale[3] =
+{
+    1.0f / 1000.0f,        /**< 2g */
+    1.0f / 500.0f,         /**< 4g */
+    1.0f / 250.0f,         /**< 8g */
+};
+
+/**
+ * @brief     emit a breakpoint
+ * @param[in] *handle pointer to an adxl362 trend handle structure
+ * @param[in] axis axis index
+ * @param[in] index sample index
+ * @param[in] value value in g
+ * @note      the breakpoint becomes the new anchor and the doors open
+ */
+static void a_adxl362_trend_emit(adxl362_trend_handle_t *handle, uint8_t axis, uint32_t index, float value)
+{
+    handle->anchor_index[axis] = index;                                                    /* set the anchor index */
+    handle->anchor[axis] = value;                                                          /* set the anchor */
+    handle->upper[axis] = ADXL362_TREND_OPEN;                                              /* open the upper door */
+    handle->lower[axis] = -ADXL362_TREND_OPEN;                                             /* open the lower door */
+    handle->points++;                                                                      /* add one */
+    if (handle->receive_callback != NULL)                                                  /* check the callback */
+    {
+        handle->receive_callback(axis, index, value);                                      /* run the callback */
+    }
+}
+
+/**
+ * @brief     run the door of one axis
+ * @param[in] *handle pointer to an adxl362 trend handle structure
+ * @param[in] axis axis index
+ * @param[in] v sample value in g
+ * @note      when the doors cross, the segment ends one sample earlier on the middle
+ *            slope that still fits every sample of the segment
+ */
+static void a_adxl362_trend_door(adxl362_trend_handle_t *handle, uint8_t axis, float v)
+{
+    uint32_t i;
+    float dt;
+    float up;
+    float lo;
+    float s;
+    
+    i = handle->index;                                                                     /* sample index */
+    dt = (float)(i - handle->anchor_index[axis]);                                          /* distance */
+    up = (v + handle->deviation - handle->anchor[axis]) / dt;                              /* upper slope */
+    lo = (v - handle->deviation - handle->anchor[axis]) / dt;                              /* lower slope */
+    up = up < handle->upper[axis] ? up : handle->upper[axis];                              /* close the upper door */
+    lo = lo > handle->lower[axis] ? lo : handle->lower[axis];                              /* close the lower door */
+    if ((up < lo) || ((handle->max_gap != 0) && (i - handle->anchor_index[axis] > handle->max_gap)))        /* segment ends */
+    {
+        s = (handle->upper[axis] + handle->lower[axis]) * 0.5f;                            /* middle of the last doors */
+        a_adxl362_trend_emit(handle, axis, i - 1, handle->anchor[axis] + 
+                             s * (dt - 1.0f));                                             /* end on the previous sample */
+        up = v + handle->deviation - handle->anchor[axis];                                 /* new upper door */
+        lo = v - handle->deviation - handle->anchor[axis];                                 /* new lower door */
+    }
+    handle->upper[axis] = up;                                                              /* save the upper door */
+    handle->lower[axis] = lo;                                                              /* save the lower door */
+}
+
+/**
+ * @brief     initialize the trend compressor
+ * @param[in] *handle pointer to an adxl362 trend handle structure
+ * @param[in] deviation_mg max deviation in mg
+ * @param[in] max_gap max samples between breakpoints, 0 is no limit
+ * @param[in] *callback pointer to a breakpoint callback function
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 deviation is invalid
+ * @note      0 < deviation_mg <= 8000
+ */
+uint8_t adxl362_trend_init(adxl362_trend_handle_t *handle, float deviation_mg, uint32_t max_gap,
+                           void (*callback)(uint8_t axis, uint32_t index, float value))
+{
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if ((deviation_mg <= 0.0f) || (deviation_mg > 8000.0f))                                /* check the deviation */
+    {
+        return 4;                                                                          /* return error */
+    }
+    
+    memset(handle, 0, sizeof(adxl362_trend_handle_t));                                     /* clear the handle */
+    handle->receive_callback = callback;                                                   /* set the callback */
+    handle->deviation = deviation_mg / 1000.0f;                                            /* set the deviation in g */
+    handle->max_gap = max_gap;                                                             /* set the max gap */
+    handle->inited = 1;                                                                    /* flag finish initialization */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     compress decoded samples
+ * @param[in] *handle pointer to an adxl362 trend handle structure
+ * @param[in] *x pointer to an x axis buffer in g
+ * @param[in] *y pointer to a y axis buffer in g
+ * @param[in] *z pointer to a z axis buffer in g
+ * @param[in] len buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the straight lines between the breakpoints of an axis stay within the deviation
+ *            of every sample, a breakpoint lies on the middle slope of the closed doors so it
+ *            is within the deviation of its sample but not always equal to it
+ */
+uint8_t adxl362_trend_update(adxl362_trend_handle_t *handle, const float *x, const float *y,
+                             const float *z, uint16_t len)
+{
+    uint16_t i;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    for (i = 0; i < len; i++)                                                              /* all samples */
+    {
+        if (handle->started == 0)                                                          /* first sample */
+        {
+            a_adxl362_trend_emit(handle, 0, handle->index, x[i]);                          /* x starts */
+            a_adxl362_trend_emit(handle, 1, handle->index, y[i]);                          /* y starts */
+            a_adxl362_trend_emit(handle, 2, handle->index, z[i]);                          /* z starts */
+            handle->started = 1;                                                           /* open */
+        }
+        else
+        {
+            a_adxl362_trend_door(handle, 0, x[i]);                                         /* x door */
+            a_adxl362_trend_door(handle, 1, y[i]);                                         /* y door */
+            a_adxl362_trend_door(handle, 2, z[i]);                                         /* z door */
+        }
+        handle->index++;                                                                   /* next sample */
+    }
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     compress raw samples
+ * @param[in] *handle pointer to an adxl362 trend handle structure
+ * @param[in] *x pointer to an x axis raw buffer
+ * @param[in] *y pointer to a y axis raw buffer
+ * @param[in] *z pointer to a z axis raw buffer
+ * @param[in] len buffer length
+ * @param[in] range range of the raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 range is invalid
+ * @note      the samples are decoded to g in chunks before the doors run
+ */
+uint8_t adxl362_trend_update_raw(adxl362_trend_handle_t *handle, const int16_t *x, const int16_t *y,
+                                 const int16_t *z, uint16_t len, adxl362_range_t range)
+{
+    uint16_t i;
+    uint16_t j;
+    uint16_t n;
+    float scale;
+    float gx[ADXL362_TREND_CHUNK];
+    float gy[ADXL362_TREND_CHUNK];
+    float gz[ADXL362_TREND_CHUNK];
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    if ((uint8_t)range > (uint8_t)ADXL362_RANGE_8G)                                        /* check the range */
+    {
+        return 4;                                                                          /* return error */
+    }
+    
+    scale = gsc_adxl362_trend_scale[range];                                                /* g per lsb */
+    for (i = 0; i < len; i += n)                                                           /* all chunks */
+    {
+        n = (uint16_t)(len - i) < ADXL362_TREND_CHUNK ? (uint16_t)(len - i) : ADXL362_TREND_CHUNK;        /* chunk length */
+        for (j = 0; j < n; j++)                                                            /* decode */
+        {
+            gx[j] = (float)x[i + j] * scale;                                               /* x in g */
+            gy[j] = (float)y[i + j] * scale;                                               /* y in g */
+            gz[j] = (float)z[i + j] * scale;                                               /* z in g */
+        }
+        (void)adxl362_trend_update(handle, gx, gy, gz, n);                                 /* run the doors */
+    }
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     compress a fifo block
+ * @param[in] *handle pointer to an adxl362 trend handle structure
+ * @param[in] *block pointer to a block read by adxl362_read_fifo_block
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 block is NULL
+ * @note      none
+ */
+uint8_t adxl362_trend_update_block(adxl362_trend_handle_t *handle, const adxl362_block_t *block)
+{
+    if (block == NULL)                                                                     /* check the block */
+    {
+        return 4;                                                                          /* return error */
+    }
+    
+    return adxl362_trend_update_raw(handle, block->x, block->y, block->z, block->len, block->range);        /* update */
+}
+
+/**
+ * @brief     emit the last sample of every axis
+ * @param[in] *handle pointer to an adxl362 trend handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      call it when the archive is closed so the tail is covered, the next sample
+ *            starts a new segment
+ */
+uint8_t adxl362_trend_flush(adxl362_trend_handle_t *handle)
+{
+    uint8_t a;
+    float dt;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    if (handle->started == 0)                                                              /* check the segments */
+    {
+        return 0;                                                                          /* success return 0 */
+    }
+    for (a = 0; a < 3; a++)                                                                /* all axes */
+    {
+        if (handle->index - 1 == handle->anchor_index[a])                                  /* ends on a breakpoint */
+        {
+            continue;                                                                      /* next axis */
+        }
+        dt = (float)(handle->index - 1 - handle->anchor_index[a]);                         /* distance */
+        a_adxl362_trend_emit(handle, a, handle->index - 1, handle->anchor[a] + 
+                             (handle->upper[a] + handle->lower[a]) * 0.5f * dt);           /* close on the middle slope */
+    }
+    handle->started = 0;                                                                   /* the next sample starts */
+    
+    return 0;                                                                              /* success return 0 */
+}
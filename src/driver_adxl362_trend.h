@@ -0,0 +1,157 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_trend.h
+ * @brief     driver adxl362 trend header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADXL362_TREND_H
+#define DRIVER_ADXL362_TREND_H
+
+#include "driver_adxl362.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup adxl362_trend_driver adxl362 trend driver function
+ * @brief    adxl362 trend driver modules
+ * @ingroup  adxl362_driver
+ * @{
+ */
+
+/**
+ * @brief adxl362 trend handle structure definition
+ * @note  one swinging door per axis, the doors are the min upper and max lower slopes
+ *        seen from the last breakpoint
+ */
+typedef struct adxl362_trend_handle_s
+{
+    void (*receive_callback)(uint8_t axis, uint32_t index, float value);        /**< point to a breakpoint callback function address */
+    float deviation;                                                            /**< max deviation in g */
+    uint32_t max_gap;                                                           /**< max samples between breakpoints, 0 is no limit */
+    uint32_t index;                                                             /**< next sample index */
+    uint32_t points;                                                            /**< emitted breakpoints */
+    uint32_t anchor_index[3];                                                   /**< last breakpoint index */
+    float anchor[3];                                                            /**< last breakpoint value */
+    float upper[3];                                                             /**< upper door slope */
+    float lower[3];                                                             /**< lower door slope */
+    uint8_t started;                                                            /**< 1 if the segments are open */
+    uint8_t inited;                                                             /**< inited flag */
+} adxl362_trend_handle_t;
+
+/**
+ * @brief     initialize the trend compressor
+ * @param[in] *handle pointer to an adxl362 trend handle structure
+ * @param[in] deviation_mg max deviation in mg
+ * @param[in] max_gap max samples between breakpoints, 0 is no limit
+ * @param[in] *callback pointer to a breakpoint callback function
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 deviation is invalid
+ * @note      0 < deviation_mg <= 8000
+ */
+uint8_t adxl362_trend_init(adxl362_trend_handle_t *handle, float deviation_mg, uint32_t max_gap,
+                           void (*callback)(uint8_t axis, uint32_t index, float value));
+
+/**
+ * @brief     compress decoded samples
+ * @param[in] *handle pointer to an adxl362 trend handle structure
+ * @param[in] *x pointer to an x axis buffer in g
+ * @param[in] *y pointer to a y axis buffer in g
+ * @param[in] *z pointer to a z axis buffer in g
+ * @param[in] len buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the straight lines between the breakpoints of an axis stay within the deviation
+ *            of every sample, a breakpoint lies on the middle slope of the closed doors so it
+ *            is within the deviation of its sample but not always equal to it
+ */
+uint8_t adxl362_trend_update(adxl362_trend_handle_t *handle, const float *x, const float *y,
+                             const float *z, uint16_t len);
+
+/**
+ * @brief     compress raw samples
+ * @param[in] *handle pointer to an adxl362 trend handle structure
+ * @param[in] *x pointer to an x axis raw buffer
+ * @param[in] *y pointer to a y axis raw buffer
+ * @param[in] *z pointer to a z axis raw buffer
+ * @param[in] len buffer length
+ * @param[in] range range of the raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 range is invalid
+ * @note      the samples are decoded to g in chunks before the doors run
+ */
+uint8_t adxl362_trend_update_raw(adxl362_trend_handle_t *handle, const int16_t *x, const int16_t *y,
+                                 const int16_t *z, uint16_t len, adxl362_range_t range);
+
+/**
+ * @brief     compress a fifo block
+ * @param[in] *handle pointer to an adxl362 trend handle structure
+ * @param[in] *block pointer to a block read by adxl362_read_fifo_block
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 block is NULL
+ * @note      none
+ */
+uint8_t adxl362_trend_update_block(adxl362_trend_handle_t *handle, const adxl362_block_t *block);
+
+/**
+ * @brief     emit the last sample of every axis
+ * @param[in] *handle pointer to an adxl362 trend handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      call it when the archive is closed so the tail is covered, the next sample
+ *            starts a new segment
+ */
+uint8_t adxl362_trend_flush(adxl362_trend_handle_t *handle);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,611 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_velocity.c
+ * @brief     driver adxl362 velocity source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_adxl362_velocity.h"
+#include <math.h>
+#include <string.h>
+
+/**
+ * @brief adxl362 velocity definition
+ */
+#define ADXL362_VELOCITY_PI        3.14159265358979323846        /**< pi */
+#define ADXL362_VELOCITY_G         9.80665                       /**< mm/s^2 per mg */
+
+/**
+ * @brief     check the parameters
+ * @param[in] odr output data rate in Hz
+ * @param[in] band_low band low edge in Hz
+ * @param[in] band_high band high edge in Hz
+ * @param[in] window samples per window
+ * @return    status code
+ *            - 0 success
+ *            - 4 odr is invalid
+ *            - 5 band is invalid
+ *            - 6 window is invalid
+ * @note      none
+ */
+static uint8_t a_adxl362_velocity_check(float odr, float band_low, float band_high, uint32_t window)
+{
+    if (!((odr > 0.0f) && (odr <= 400.0f)))                                                /* check the odr */
+    {
+        return 4;                                                                          /* return error */
+    }
+    if (!((band_low > 0.0f) && (band_high > band_low) && (band_high < odr * 0.5f)))        /* check the band */
+    {
+        return 5;                                                                          /* return error */
+    }
+    if ((window == 0) || (window > ADXL362_VELOCITY_MAX_WINDOW))                           /* check the window */
+    {
+        return 6;                                                                          /* return error */
+    }
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief      design a butterworth biquad
+ * @param[in]  fc cutoff frequency in Hz
+ * @param[in]  odr output data rate in Hz
+ * @param[in]  high_pass 1 for a high pass, 0 for a low pass
+ * @param[out] *c pointer to a b0, b1, b2, a1, a2 buffer
+ * @note       bilinear transform with q = 1 / sqrt(2), b1 and b2 follow b0 exactly so the
+ *             high pass keeps its zeros at dc after rounding
+ */
+static void a_adxl362_velocity_design(double fc, double odr, uint8_t high_pass, double c[5])
+{
+    double w;
+    double cs;
+    double alpha;
+    double a0;
+    
+    w = 2.0 * ADXL362_VELOCITY_PI * fc / odr;                                              /* normalized frequency */
+    cs = cos(w);                                                                           /* cos */
+    alpha = sin(w) / (2.0 * 0.70710678118654752);                                          /* bandwidth term */
+    a0 = 1.0 + alpha;                                                                      /* normalization */
+    if (high_pass != 0)                                                                    /* high pass */
+    {
+        c[0] = (1.0 + cs) * 0.5 / a0;                                                      /* b0 */
+        c[1] = -2.0;                                                                       /* b1 / b0 */
+    }
+    else                                                                                   /* low pass */
+    {
+        c[0] = (1.0 - cs) * 0.5 / a0;                                                      /* b0 */
+        c[1] = 2.0;                                                                        /* b1 / b0 */
+    }
+    c[2] = 1.0;                                                                            /* b2 / b0 */
+    c[3] = -2.0 * cs / a0;                                                                 /* a1 */
+    c[4] = (1.0 - alpha) / a0;                                                             /* a2 */
+}
+
+/**
+ * @brief         run one float biquad
+ * @param[in]     *c pointer to the coefficients
+ * @param[in,out] *s pointer to the states
+ * @param[in]     x input sample
+ * @return        output sample
+ * @note          transposed direct form 2
+ */
+static inline float a_adxl362_velocity_biquad(const float *c, float *s, float x)
+{
+    float y;
+    
+    y = c[0] * x + s[0];                                                                   /* output */
+    s[0] = c[1] * x - c[3] * y + s[1];                                                     /* first state */
+    s[1] = c[2] * x - c[4] * y;                                                            /* second state */
+    
+    return y;                                                                              /* return the output */
+}
+
+/**
+ * @brief         run one q28 biquad
+ * @param[in]     *c pointer to the q28 coefficients
+ * @param[in,out] *s pointer to the x1, x2, y1, y2 and error states
+ * @param[in]     x input sample
+ * @return        output sample
+ * @note          direct form 1 with a 64 bits accumulator, the dropped fraction is fed back
+ *                so the low cutoff poles do not turn the rounding into an offset
+ */
+static inline int32_t a_adxl362_velocity_biquad_q28(const int32_t *c, int32_t *s, int32_t x)
+{
+    int64_t acc;
+    int32_t y;
+    
+    acc = (int64_t)c[0] * x + (int64_t)c[1] * s[0] + (int64_t)c[2] * s[1] - 
+          (int64_t)c[3] * s[2] - (int64_t)c[4] * s[3] + s[4];                              /* accumulate */
+    y = (int32_t)(acc >> 28);                                                              /* to the sample */
+    s[4] = (int32_t)(acc - ((int64_t)y << 28));                                            /* save the error */
+    s[1] = s[0];                                                                           /* shift x */
+    s[0] = x;                                                                              /* save x */
+    s[3] = s[2];                                                                           /* shift y */
+    s[2] = y;                                                                              /* save y */
+    
+    return y;                                                                              /* return the output */
+}
+
+/**
+ * @brief     integer square root
+ * @param[in] v value
+ * @return    floor of the square root
+ * @note      none
+ */
+static uint32_t a_adxl362_velocity_isqrt(uint64_t v)
+{
+    uint64_t r;
+    uint64_t bit;
+    
+    r = 0;                                                                                 /* init 0 */
+    bit = 1ULL << 62;                                                                      /* highest power of 4 */
+    while (bit > v)                                                                        /* find the start */
+    {
+        bit >>= 2;                                                                         /* next */
+    }
+    while (bit != 0)                                                                       /* run all bits */
+    {
+        if (v >= r + bit)                                                                  /* check the bit */
+        {
+            v -= r + bit;                                                                  /* sub */
+            r = (r >> 1) + bit;                                                            /* set the bit */
+        }
+        else
+        {
+            r >>= 1;                                                                       /* shift */
+        }
+        bit >>= 2;                                                                         /* next */
+    }
+    
+    return (uint32_t)r;                                                                    /* return the root */
+}
+
+/**
+ * @brief     finish a float window
+ * @param[in] *handle pointer to an adxl362 velocity handle structure
+ * @note      none
+ */
+static void a_adxl362_velocity_emit(adxl362_velocity_handle_t *handle)
+{
+    uint8_t a;
+    
+    handle->report.count = handle->count;                                                  /* set the count */
+    for (a = 0; a < 3; a++)                                                                /* all axes */
+    {
+        handle->report.rms[a] = sqrtf(handle->sum_sq[a] / (float)handle->count);           /* rms */
+        handle->report.peak[a] = handle->peak[a];                                          /* peak */
+        handle->sum_sq[a] = 0.0f;                                                          /* clear the sum */
+        handle->peak[a] = 0.0f;                                                            /* clear the peak */
+    }
+    handle->count = 0;                                                                     /* next window */
+    if (handle->receive_callback != NULL)                                                  /* check the callback */
+    {
+        handle->receive_callback(&handle->report);                                         /* run the callback */
+    }
+    handle->report.index++;                                                                /* next index */
+}
+
+/**
+ * @brief     finish an int window
+ * @param[in] *handle pointer to an adxl362 velocity int handle structure
+ * @note      the square sum is kept in 1/64 so a window of 8g at a low band edge fits
+ */
+static void a_adxl362_velocity_int_emit(adxl362_velocity_int_handle_t *handle)
+{
+    uint8_t a;
+    uint32_t r;
+    
+    handle->report.count = handle->count;                                                  /* set the count */
+    for (a = 0; a < 3; a++)                                                                /* all axes */
+    {
+        r = a_adxl362_velocity_isqrt((handle->sum_sq[a] / handle->count) << 6);            /* rms in mm/s * 4096 */
+        handle->report.rms[a] = (uint32_t)(((uint64_t)r * 1000 + 2048) >> 12);             /* um/s */
+        handle->report.peak[a] = (uint32_t)(((uint64_t)handle->peak[a] * 1000 + 2048) >> 12);    /* um/s */
+        handle->sum_sq[a] = 0;                                                             /* clear the sum */
+        handle->peak[a] = 0;                                                               /* clear the peak */
+    }
+    handle->count = 0;                                                                     /* next window */
+    if (handle->receive_callback != NULL)                                                  /* check the callback */
+    {
+        handle->receive_callback(&handle->report);                                         /* run the callback */
+    }
+    handle->report.index++;                                                                /* next index */
+}
+
+/**
+ * @brief     initialize the float velocity stage
+ * @param[in] *handle pointer to an adxl362 velocity handle structure
+ * @param[in] odr output data rate in Hz
+ * @param[in] band_low band low edge in Hz
+ * @param[in] band_high band high edge in Hz
+ * @param[in] window samples per window
+ * @param[in] *callback pointer to a report callback function
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 odr is invalid
+ *            - 5 band is invalid
+ *            - 6 window is invalid
+ * @note      0 < odr <= 400, 0 < band_low < band_high < odr / 2, 0 < window <= 65535,
+ *            iso 10816 uses 10Hz to 1kHz or 2Hz for slow machines, the high edge is
+ *            limited by the odr here, e.g. 10Hz to 150Hz at 400Hz
+ */
+uint8_t adxl362_velocity_init(adxl362_velocity_handle_t *handle, float odr, float band_low, float band_high,
+                              uint32_t window, void (*callback)(const adxl362_velocity_report_t *report))
+{
+    uint8_t res;
+    uint8_t i;
+    double c[3][5];
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    res = a_adxl362_velocity_check(odr, band_low, band_high, window);                     /* check the parameters */
+    if (res != 0)                                                                          /* check the result */
+    {
+        return res;                                                                        /* return error */
+    }
+    
+    memset(handle, 0, sizeof(adxl362_velocity_handle_t));                                  /* clear the handle */
+    a_adxl362_velocity_design(band_low, odr, 1, c[0]);                                     /* acceleration high pass */
+    a_adxl362_velocity_design(band_high, odr, 0, c[1]);                                    /* acceleration low pass */
+    a_adxl362_velocity_design(band_low, odr, 1, c[2]);                                     /* velocity high pass */
+    for (i = 0; i < 3; i++)                                                                /* all biquads */
+    {
+        handle->coefficient[i][0] = (float)c[i][0];                                        /* b0 */
+        handle->coefficient[i][1] = (float)c[i][0] * (float)c[i][1];                       /* b1 */
+        handle->coefficient[i][2] = (float)c[i][0];                                        /* b2 */
+        handle->coefficient[i][3] = (float)c[i][3];                                        /* a1 */
+        handle->coefficient[i][4] = (float)c[i][4];                                        /* a2 */
+    }
+    handle->leak = (float)(1.0 - 2.0 * ADXL362_VELOCITY_PI * band_low / 
+                           ADXL362_VELOCITY_LEAK / odr);                                   /* leak factor */
+    handle->gain = (float)(ADXL362_VELOCITY_G / 64.0 / odr);                               /* integrator gain */
+    handle->receive_callback = callback;                                                   /* set the callback */
+    handle->window = window;                                                               /* set the window */
+    handle->settle_len = (uint32_t)ceilf(ADXL362_VELOCITY_SETTLE * odr / band_low);        /* settling samples */
+    handle->settle = handle->settle_len;                                                   /* settle first */
+    handle->inited = 1;                                                                    /* flag finish initialization */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     run the float velocity stage
+ * @param[in] *handle pointer to an adxl362 velocity handle structure
+ * @param[in] *x pointer to an x axis raw buffer
+ * @param[in] *y pointer to a y axis raw buffer
+ * @param[in] *z pointer to a z axis raw buffer
+ * @param[in] len buffer length
+ * @param[in] range range of the raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the callback runs once per completed window, the samples of the settling time
+ *            after init or reset are not counted
+ */
+uint8_t adxl362_velocity_update(adxl362_velocity_handle_t *handle, const int16_t *x, const int16_t *y,
+                                const int16_t *z, uint16_t len, adxl362_range_t range)
+{
+    uint16_t i;
+    uint8_t a;
+    float scale;
+    float in[3];
+    float v;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    scale = (float)(1 << range);                                                           /* mg per lsb */
+    for (i = 0; i < len; i++)                                                              /* all samples */
+    {
+        in[0] = (float)x[i] * scale;                                                       /* x in mg */
+        in[1] = (float)y[i] * scale;                                                       /* y in mg */
+        in[2] = (float)z[i] * scale;                                                       /* z in mg */
+        for (a = 0; a < 3; a++)                                                            /* all axes */
+        {
+            v = a_adxl362_velocity_biquad(handle->coefficient[0], handle->state[a][0], in[a]);    /* acceleration high pass */
+            v = a_adxl362_velocity_biquad(handle->coefficient[1], handle->state[a][1], v);        /* acceleration low pass */
+            handle->velocity[a] = handle->leak * handle->velocity[a] + handle->gain * 
+                                  (56.0f * v + 9.0f * handle->prev[a][0] - handle->prev[a][1]);    /* integrate */
+            handle->prev[a][1] = handle->prev[a][0];                                       /* shift the acceleration */
+            handle->prev[a][0] = v;                                                        /* save the acceleration */
+            in[a] = a_adxl362_velocity_biquad(handle->coefficient[2], handle->state[a][2], 
+                                              handle->velocity[a]);                        /* velocity high pass */
+        }
+        if (handle->settle != 0)                                                           /* settling */
+        {
+            handle->settle--;                                                              /* one less */
+            
+            continue;                                                                      /* next sample */
+        }
+        for (a = 0; a < 3; a++)                                                            /* all axes */
+        {
+            handle->sum_sq[a] += in[a] * in[a];                                            /* add the square */
+            v = fabsf(in[a]);                                                              /* magnitude */
+            handle->peak[a] = v > handle->peak[a] ? v : handle->peak[a];                   /* peak */
+        }
+        handle->count++;                                                                   /* add one */
+        if (handle->count >= handle->window)                                               /* window done */
+        {
+            a_adxl362_velocity_emit(handle);                                               /* report */
+        }
+    }
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     run the float velocity stage with a fifo block
+ * @param[in] *handle pointer to an adxl362 velocity handle structure
+ * @param[in] *block pointer to a block read by adxl362_read_fifo_block
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 block is NULL
+ * @note      none
+ */
+uint8_t adxl362_velocity_update_block(adxl362_velocity_handle_t *handle, const adxl362_block_t *block)
+{
+    if (block == NULL)                                                                     /* check the block */
+    {
+        return 4;                                                                          /* return error */
+    }
+    
+    return adxl362_velocity_update(handle, block->x, block->y, block->z, block->len, block->range);        /* update */
+}
+
+/**
+ * @brief     reset the float velocity stage
+ * @param[in] *handle pointer to an adxl362 velocity handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      call it after a gap in the stream, the window index is kept
+ */
+uint8_t adxl362_velocity_reset(adxl362_velocity_handle_t *handle)
+{
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    memset(handle->state, 0, sizeof(handle->state));                                       /* clear the states */
+    memset(handle->prev, 0, sizeof(handle->prev));                                         /* clear the acceleration */
+    memset(handle->velocity, 0, sizeof(handle->velocity));                                 /* clear the integrator */
+    memset(handle->sum_sq, 0, sizeof(handle->sum_sq));                                     /* clear the sums */
+    memset(handle->peak, 0, sizeof(handle->peak));                                         /* clear the peaks */
+    handle->count = 0;                                                                     /* clear the window */
+    handle->settle = handle->settle_len;                                                   /* settle again */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     initialize the int velocity stage
+ * @param[in] *handle pointer to an adxl362 velocity int handle structure
+ * @param[in] odr output data rate in Hz
+ * @param[in] band_low band low edge in Hz
+ * @param[in] band_high band high edge in Hz
+ * @param[in] window samples per window
+ * @param[in] *callback pointer to a report callback function
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 odr is invalid
+ *            - 5 band is invalid
+ *            - 6 window is invalid
+ * @note      the same limits as adxl362_velocity_init, the coefficients are built with float
+ *            math once, the stage itself is integer only
+ */
+uint8_t adxl362_velocity_int_init(adxl362_velocity_int_handle_t *handle, float odr, float band_low, float band_high,
+                                  uint32_t window, void (*callback)(const adxl362_velocity_int_report_t *report))
+{
+    uint8_t res;
+    uint8_t i;
+    int32_t b0;
+    double c[3][5];
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    res = a_adxl362_velocity_check(odr, band_low, band_high, window);                     /* check the parameters */
+    if (res != 0)                                                                          /* check the result */
+    {
+        return res;                                                                        /* return error */
+    }
+    
+    memset(handle, 0, sizeof(adxl362_velocity_int_handle_t));                              /* clear the handle */
+    a_adxl362_velocity_design(band_low, odr, 1, c[0]);                                     /* acceleration high pass */
+    a_adxl362_velocity_design(band_high, odr, 0, c[1]);                                    /* acceleration low pass */
+    a_adxl362_velocity_design(band_low, odr, 1, c[2]);                                     /* velocity high pass */
+    for (i = 0; i < 3; i++)                                                                /* all biquads */
+    {
+        b0 = (int32_t)floor(c[i][0] * 268435456.0 + 0.5);                                  /* q28 b0 */
+        handle->coefficient[i][0] = b0;                                                    /* b0 */
+        handle->coefficient[i][1] = b0 * (int32_t)c[i][1];                                 /* b1 */
+        handle->coefficient[i][2] = b0;                                                    /* b2 */
+        handle->coefficient[i][3] = (int32_t)floor(c[i][3] * 268435456.0 + 0.5);           /* q28 a1 */
+        handle->coefficient[i][4] = (int32_t)floor(c[i][4] * 268435456.0 + 0.5);           /* q28 a2 */
+    }
+    handle->leak = (int32_t)floor((1.0 - 2.0 * ADXL362_VELOCITY_PI * band_low / 
+                                  ADXL362_VELOCITY_LEAK / odr) * 1073741824.0 + 0.5);      /* q30 leak factor */
+    handle->gain = (int32_t)floor(ADXL362_VELOCITY_G / 64.0 / odr * 16.0 * 1048576.0 + 0.5);   /* q20 gain from mg * 256 to mm/s * 4096 */
+    handle->receive_callback = callback;                                                   /* set the callback */
+    handle->window = window;                                                               /* set the window */
+    handle->settle_len = (uint32_t)ceilf(ADXL362_VELOCITY_SETTLE * odr / band_low);        /* settling samples */
+    handle->settle = handle->settle_len;                                                   /* settle first */
+    handle->inited = 1;                                                                    /* flag finish initialization */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     run the int velocity stage
+ * @param[in] *handle pointer to an adxl362 velocity int handle structure
+ * @param[in] *x pointer to an x axis raw buffer
+ * @param[in] *y pointer to a y axis raw buffer
+ * @param[in] *z pointer to a z axis raw buffer
+ * @param[in] len buffer length
+ * @param[in] range range of the raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the callback runs once per completed window, the samples of the settling time
+ *            after init or reset are not counted
+ */
+uint8_t adxl362_velocity_int_update(adxl362_velocity_int_handle_t *handle, const int16_t *x, const int16_t *y,
+                                    const int16_t *z, uint16_t len, adxl362_range_t range)
+{
+    uint16_t i;
+    uint8_t a;
+    uint32_t shift;
+    int32_t in[3];
+    int32_t v;
+    uint32_t m;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    shift = (uint32_t)range + 8;                                                           /* mg * 256 per lsb */
+    for (i = 0; i < len; i++)                                                              /* all samples */
+    {
+        in[0] = (int32_t)x[i] * (1 << shift);                                              /* x in mg * 256 */
+        in[1] = (int32_t)y[i] * (1 << shift);                                              /* y in mg * 256 */
+        in[2] = (int32_t)z[i] * (1 << shift);                                              /* z in mg * 256 */
+        for (a = 0; a < 3; a++)                                                            /* all axes */
+        {
+            v = a_adxl362_velocity_biquad_q28(handle->coefficient[0], handle->state[a][0], in[a]);    /* acceleration high pass */
+            v = a_adxl362_velocity_biquad_q28(handle->coefficient[1], handle->state[a][1], v);        /* acceleration low pass */
+            handle->velocity[a] = (int32_t)((((int64_t)handle->leak * handle->velocity[a] + (1 << 29)) >> 30) + 
+                                            (((int64_t)handle->gain * (56 * v + 9 * handle->prev[a][0] - 
+                                                                       handle->prev[a][1]) + (1 << 19)) >> 20));    /* integrate */
+            handle->prev[a][1] = handle->prev[a][0];                                       /* shift the acceleration */
+            handle->prev[a][0] = v;                                                        /* save the acceleration */
+            in[a] = a_adxl362_velocity_biquad_q28(handle->coefficient[2], handle->state[a][2], 
+                                                  handle->velocity[a]);                    /* velocity high pass */
+        }
+        if (handle->settle != 0)                                                           /* settling */
+        {
+            handle->settle--;                                                              /* one less */
+            
+            continue;                                                                      /* next sample */
+        }
+        for (a = 0; a < 3; a++)                                                            /* all axes */
+        {
+            m = (uint32_t)(in[a] < 0 ? -in[a] : in[a]);                                    /* magnitude */
+            handle->sum_sq[a] += ((uint64_t)m * m + 32) >> 6;                              /* add the square in 1/64 */
+            handle->peak[a] = m > handle->peak[a] ? m : handle->peak[a];                   /* peak */
+        }
+        handle->count++;                                                                   /* add one */
+        if (handle->count >= handle->window)                                               /* window done */
+        {
+            a_adxl362_velocity_int_emit(handle);                                           /* report */
+        }
+    }
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     run the int velocity stage with a fifo block
+ * @param[in] *handle pointer to an adxl362 velocity int handle structure
+ * @param[in] *block pointer to a block read by adxl362_read_fifo_block
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 block is NULL
+ * @note      none
+ */
+uint8_t adxl362_velocity_int_update_block(adxl362_velocity_int_handle_t *handle, const adxl362_block_t *block)
+{
+    if (block == NULL)                                                                     /* check the block */
+    {
+        return 4;                                                                          /* return error */
+    }
+    
+    return adxl362_velocity_int_update(handle, block->x, block->y, block->z, block->len, block->range);    /* update */
+}
+
+/**
+ * @brief     reset the int velocity stage
+ * @param[in] *handle pointer to an adxl362 velocity int handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      call it after a gap in the stream, the window index is kept
+ */
+uint8_t adxl362_velocity_int_reset(adxl362_velocity_int_handle_t *handle)
+{
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    memset(handle->state, 0, sizeof(handle->state));                                       /* clear the states */
+    memset(handle->prev, 0, sizeof(handle->prev));                                         /* clear the acceleration */
+    memset(handle->velocity, 0, sizeof(handle->velocity));                                 /* clear the integrator */
+    memset(handle->sum_sq, 0, sizeof(handle->sum_sq));                                     /* clear the sums */
+    memset(handle->peak, 0, sizeof(handle->peak));                                         /* clear the peaks */
+    handle->count = 0;                                                                     /* clear the window */
+    handle->settle = handle->settle_len;                                                   /* settle again */
+    
+    return 0;                                                                              /* success return 0 */
+}
@@ -0,0 +1,266 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_velocity.h
+ * @brief     driver adxl362 velocity header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADXL362_VELOCITY_H
+#define DRIVER_ADXL362_VELOCITY_H
+
+#include "driver_adxl362.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup adxl362_velocity_driver adxl362 velocity driver function
+ * @brief    adxl362 velocity driver modules
+ * @ingroup  adxl362_driver
+ * @{
+ */
+
+/**
+ * @brief adxl362 velocity definition
+ */
+#define ADXL362_VELOCITY_MAX_WINDOW        65535        /**< max samples per window */
+#define ADXL362_VELOCITY_SETTLE            5            /**< band_low periods skipped after a reset */
+#define ADXL362_VELOCITY_LEAK              20           /**< integrator leak corner is band_low / 20 */
+
+/**
+ * @brief adxl362 velocity report structure definition
+ */
+typedef struct adxl362_velocity_report_s
+{
+    uint32_t index;          /**< window index */
+    uint32_t count;          /**< samples in the window */
+    float rms[3];            /**< x, y, z velocity rms in mm/s */
+    float peak[3];           /**< x, y, z velocity peak in mm/s */
+} adxl362_velocity_report_t;
+
+/**
+ * @brief adxl362 velocity int report structure definition
+ */
+typedef struct adxl362_velocity_int_report_s
+{
+    uint32_t index;          /**< window index */
+    uint32_t count;          /**< samples in the window */
+    uint32_t rms[3];         /**< x, y, z velocity rms in um/s */
+    uint32_t peak[3];        /**< x, y, z velocity peak in um/s */
+} adxl362_velocity_int_report_t;
+
+/**
+ * @brief adxl362 velocity handle structure definition
+ * @note  per axis the acceleration runs through a butterworth high pass and low pass pair,
+ *        a leaky integrator and a butterworth high pass on the velocity, so the band edges
+ *        are 4th order high pass and 2nd order low pass, the integrator numerator
+ *        (56, 9, -1) / 64 keeps its gain within 0.5% of 1 / w up to 3 / 8 of the odr where
+ *        the trapezoid rule is 50% low
+ */
+typedef struct adxl362_velocity_handle_s
+{
+    void (*receive_callback)(const adxl362_velocity_report_t *report);        /**< point to a report callback function address */
+    float coefficient[3][5];                                                  /**< b0, b1, b2, a1, a2 of each biquad */
+    float state[3][3][2];                                                     /**< transposed direct form 2 states per axis */
+    float leak;                                                               /**< integrator leak factor */
+    float gain;                                                               /**< mm/s per mg of an integrator step / 64 */
+    float prev[3][2];                                                         /**< last two filtered accelerations in mg */
+    float velocity[3];                                                        /**< integrator in mm/s */
+    float sum_sq[3];                                                          /**< velocity square sum */
+    float peak[3];                                                            /**< velocity peak */
+    uint32_t window;                                                          /**< samples per window */
+    uint32_t count;                                                           /**< samples in the current window */
+    uint32_t settle;                                                          /**< samples left to settle */
+    uint32_t settle_len;                                                      /**< samples to settle after a reset */
+    adxl362_velocity_report_t report;                                         /**< report handed to the callback */
+    uint8_t inited;                                                           /**< inited flag */
+} adxl362_velocity_handle_t;
+
+/**
+ * @brief adxl362 velocity int handle structure definition
+ * @note  the same stages as the float handle, the coefficients are q28 with error feedback,
+ *        the acceleration is mg * 256 and the velocity is mm/s * 4096
+ */
+typedef struct adxl362_velocity_int_handle_s
+{
+    void (*receive_callback)(const adxl362_velocity_int_report_t *report);    /**< point to a report callback function address */
+    int32_t coefficient[3][5];                                                /**< b0, b1, b2, a1, a2 of each biquad in q28 */
+    int32_t state[3][3][5];                                                   /**< x1, x2, y1, y2 and error per axis */
+    int32_t leak;                                                             /**< integrator leak factor in q30 */
+    int32_t gain;                                                             /**< integrator step gain / 64 in q20 */
+    int32_t prev[3][2];                                                       /**< last two filtered accelerations */
+    int32_t velocity[3];                                                      /**< integrator */
+    uint64_t sum_sq[3];                                                       /**< velocity square sum */
+    uint32_t peak[3];                                                         /**< velocity peak */
+    uint32_t window;                                                          /**< samples per window */
+    uint32_t count;                                                           /**< samples in the current window */
+    uint32_t settle;                                                          /**< samples left to settle */
+    uint32_t settle_len;                                                      /**< samples to settle after a reset */
+    adxl362_velocity_int_report_t report;                                     /**< report handed to the callback */
+    uint8_t inited;                                                           /**< inited flag */
+} adxl362_velocity_int_handle_t;
+
+/**
+ * @brief     initialize the float velocity stage
+ * @param[in] *handle pointer to an adxl362 velocity handle structure
+ * @param[in] odr output data rate in Hz
+ * @param[in] band_low band low edge in Hz
+ * @param[in] band_high band high edge in Hz
+ * @param[in] window samples per window
+ * @param[in] *callback pointer to a report callback function
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 odr is invalid
+ *            - 5 band is invalid
+ *            - 6 window is invalid
+ * @note      0 < odr <= 400, 0 < band_low < band_high < odr / 2, 0 < window <= 65535,
+ *            iso 10816 uses 10Hz to 1kHz or 2Hz for slow machines, the high edge is
+ *            limited by the odr here, e.g. 10Hz to 150Hz at 400Hz
+ */
+uint8_t adxl362_velocity_init(adxl362_velocity_handle_t *handle, float odr, float band_low, float band_high,
+                              uint32_t window, void (*callback)(const adxl362_velocity_report_t *report));
+
+/**
+ * @brief     run the float velocity stage
+ * @param[in] *handle pointer to an adxl362 velocity handle structure
+ * @param[in] *x pointer to an x axis raw buffer
+ * @param[in] *y pointer to a y axis raw buffer
+ * @param[in] *z pointer to a z axis raw buffer
+ * @param[in] len buffer length
+ * @param[in] range range of the raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the callback runs once per completed window, the samples of the settling time
+ *            after init or reset are not counted
+ */
+uint8_t adxl362_velocity_update(adxl362_velocity_handle_t *handle, const int16_t *x, const int16_t *y,
+                                const int16_t *z, uint16_t len, adxl362_range_t range);
+
+/**
+ * @brief     run the float velocity stage with a fifo block
+ * @param[in] *handle pointer to an adxl362 velocity handle structure
+ * @param[in] *block pointer to a block read by adxl362_read_fifo_block
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 block is NULL
+ * @note      none
+ */
+uint8_t adxl362_velocity_update_block(adxl362_velocity_handle_t *handle, const adxl362_block_t *block);
+
+/**
+ * @brief     reset the float velocity stage
+ * @param[in] *handle pointer to an adxl362 velocity handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      call it after a gap in the stream, the window index is kept
+ */
+uint8_t adxl362_velocity_reset(adxl362_velocity_handle_t *handle);
+
+/**
+ * @brief     initialize the int velocity stage
+ * @param[in] *handle pointer to an adxl362 velocity int handle structure
+ * @param[in] odr output data rate in Hz
+ * @param[in] band_low band low edge in Hz
+ * @param[in] band_high band high edge in Hz
+ * @param[in] window samples per window
+ * @param[in] *callback pointer to a report callback function
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 odr is invalid
+ *            - 5 band is invalid
+ *            - 6 window is invalid
+ * @note      the same limits as adxl362_velocity_init, the coefficients are built with float
+ *            math once, the stage itself is integer only
+ */
+uint8_t adxl362_velocity_int_init(adxl362_velocity_int_handle_t *handle, float odr, float band_low, float band_high,
+                                  uint32_t window, void (*callback)(const adxl362_velocity_int_report_t *report));
+
+/**
+ * @brief     run the int velocity stage
+ * @param[in] *handle pointer to an adxl362 velocity int handle structure
+ * @param[in] *x pointer to an x axis raw buffer
+ * @param[in] *y pointer to a y axis raw buffer
+ * @param[in] *z pointer to a z axis raw buffer
+ * @param[in] len buffer length
+ * @param[in] range range of the raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the callback runs once per completed window, the samples of the settling time
+ *            after init or reset are not counted
+ */
+uint8_t adxl362_velocity_int_update(adxl362_velocity_int_handle_t *handle, const int16_t *x, const int16_t *y,
+                                    const int16_t *z, uint16_t len, adxl362_range_t range);
+
+/**
+ * @brief     run the int velocity stage with a fifo block
+ * @param[in] *handle pointer to an adxl362 velocity int handle structure
+ * @param[in] *block pointer to a block read by adxl362_read_fifo_block
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 block is NULL
+ * @note      none
+ */
+uint8_t adxl362_velocity_int_update_block(adxl362_velocity_int_handle_t *handle, const adxl362_block_t *block);
+
+/**
+ * @brief     reset the int velocity stage
+ * @param[in] *handle pointer to an adxl362 velocity int handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      call it after a gap in the stream, the window index is kept
+ */
+uint8_t adxl362_velocity_int_reset(adxl362_velocity_int_handle_t *handle);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
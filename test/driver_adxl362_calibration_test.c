@@ -0,0 +1,420 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_calibration_test.c
+ * @brief     driver adxl362 calibration test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_adxl362_calibration_test.h"
+#include <math.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * @brief calibration test definition
+ */
+#define ADXL362_CALIBRATION_TEST_SAMPLES        256        /**< samples averaged per pose */
+#define ADXL362_CALIBRATION_TEST_CHUNK          128        /**< samples per block */
+
+static adxl362_calibration_handle_t gs_handle;                 /**< adxl362 calibration handle */
+static adxl362_calibration_handle_t gs_check;                  /**< adxl362 calibration handle of the imported blob */
+static adxl362_block_t gs_block;                               /**< raw block */
+static float gs_gx[ADXL362_BLOCK_MAX_LEN];                     /**< x buffer in g */
+static float gs_gy[ADXL362_BLOCK_MAX_LEN];                     /**< y buffer in g */
+static float gs_gz[ADXL362_BLOCK_MAX_LEN];                     /**< z buffer in g */
+static float gs_cx[ADXL362_BLOCK_MAX_LEN];                     /**< imported x buffer in g */
+static float gs_cy[ADXL362_BLOCK_MAX_LEN];                     /**< imported y buffer in g */
+static float gs_cz[ADXL362_BLOCK_MAX_LEN];                     /**< imported z buffer in g */
+static double gs_ux[ADXL362_BLOCK_MAX_LEN];                    /**< true x in g */
+static double gs_uy[ADXL362_BLOCK_MAX_LEN];                    /**< true y in g */
+static double gs_uz[ADXL362_BLOCK_MAX_LEN];                    /**< true z in g */
+static double gs_sensitivity[3][3];                            /**< made sensor sensitivity */
+static double gs_offset[3];                                    /**< made sensor offset in g */
+static uint32_t gs_seed;                                       /**< random seed */
+static uint8_t gs_poses;                                       /**< finished poses */
+
+/**
+ * @brief  random number
+ * @return value in [-1, 1)
+ * @note   none
+ */
+static double a_adxl362_calibration_test_rand(void)
+{
+    gs_seed = gs_seed * 1103515245U + 12345U;
+    
+    return (double)(gs_seed >> 8) / 8388608.0 - 1.0;
+}
+
+/**
+ * @brief     pose done callback
+ * @param[in] pose finished pose
+ * @param[in] done_mask finished poses mask
+ * @note      none
+ */
+static void a_adxl362_calibration_test_callback(adxl362_calibration_pose_t pose, uint8_t done_mask)
+{
+    (void)pose;
+    (void)done_mask;
+    
+    gs_poses++;
+}
+
+/**
+ * @brief     make a block from the true values
+ * @param[in] len block length
+ * @param[in] range range of the raw data
+ * @param[in] noise noise amplitude in lsb
+ * @note      the made sensor reads s * g + offset, the noise also dithers the rounding
+ */
+static void a_adxl362_calibration_test_make(uint16_t len, adxl362_range_t range, double noise)
+{
+    uint16_t i;
+    uint8_t r;
+    double lsb;
+    double v[3];
+    
+    lsb = (double)(1 << (uint8_t)range) / 1000.0;
+    for (i = 0; i < len; i++)
+    {
+        for (r = 0; r < 3; r++)
+        {
+            v[r] = gs_sensitivity[r][0] * gs_ux[i] + gs_sensitivity[r][1] * gs_uy[i] + 
+                   gs_sensitivity[r][2] * gs_uz[i] + gs_offset[r];
+            v[r] = floor(v[r] / lsb + noise * a_adxl362_calibration_test_rand() + 0.5);
+        }
+        gs_block.x[i] = (int16_t)v[0];
+        gs_block.y[i] = (int16_t)v[1];
+        gs_block.z[i] = (int16_t)v[2];
+    }
+    gs_block.len = len;
+    gs_block.range = range;
+    gs_block.temperature_valid = 0;
+}
+
+/**
+ * @brief     hold a pose
+ * @param[in] axis vertical axis
+ * @param[in] sign 1 for up, -1 for down
+ * @param[in] level reading of the next axis in g
+ * @param[in] noise noise amplitude in lsb
+ * @param[in] range range of the raw data
+ * @param[in] len sample count
+ * @note      the samples are fed in fifo sized blocks
+ */
+static void a_adxl362_calibration_test_hold(uint8_t axis, double sign, double level, double noise,
+                                            adxl362_range_t range, uint32_t len)
+{
+    uint16_t i;
+    uint16_t n;
+    double u[3];
+    
+    u[axis] = sign * sqrt(1.0 - level * level);
+    u[(axis + 1) % 3] = level;
+    u[(axis + 2) % 3] = 0.0;
+    while (len > 0)
+    {
+        n = len < ADXL362_CALIBRATION_TEST_CHUNK ? (uint16_t)len : ADXL362_CALIBRATION_TEST_CHUNK;
+        for (i = 0; i < n; i++)
+        {
+            gs_ux[i] = u[0];
+            gs_uy[i] = u[1];
+            gs_uz[i] = u[2];
+        }
+        a_adxl362_calibration_test_make(n, range, noise);
+        (void)adxl362_calibration_update_block(&gs_handle, &gs_block);
+        len -= n;
+    }
+}
+
+/**
+ * @brief     calibration test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      solves made sensors with known offset and gain errors, round trips the blob, checks
+ *            that every single bit error in the blob is rejected and reports the decode samples
+ *            per second, no sensor is needed
+ */
+uint8_t adxl362_calibration_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t p;
+    uint8_t r;
+    uint8_t c;
+    uint16_t i;
+    uint16_t b;
+    uint32_t j;
+    uint32_t rounds;
+    uint32_t loops;
+    uint32_t rejected;
+    double e;
+    double lsb;
+    double norm;
+    double offset_error;
+    double decode_error;
+    double blob_error;
+    double seconds;
+    adxl362_range_t range;
+    adxl362_bool_t cross_axis;
+    adxl362_calibration_pose_t pose;
+    uint8_t blob[ADXL362_CALIBRATION_BLOB_SIZE];
+    uint8_t copy[ADXL362_CALIBRATION_BLOB_SIZE];
+    float matrix[3][3];
+    float offset[3];
+    clock_t start;
+    
+    /* start calibration test */
+    adxl362_interface_debug_print("adxl362: start calibration test.\n");
+    
+    /* check the errors */
+    if (adxl362_calibration_init(&gs_handle, 0, NULL) != 4)
+    {
+        adxl362_interface_debug_print("adxl362: calibration init samples check failed.\n");
+        
+        return 1;
+    }
+    res = adxl362_calibration_init(&gs_handle, ADXL362_CALIBRATION_TEST_SAMPLES, a_adxl362_calibration_test_callback);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: calibration init failed.\n");
+        
+        return 1;
+    }
+    if ((adxl362_calibration_solve(&gs_handle, ADXL362_BOOL_FALSE) != 4) || 
+        (adxl362_calibration_export(&gs_handle, blob) != 4) || 
+        (adxl362_calibration_decode_block(&gs_handle, &gs_block, gs_gx, gs_gy, gs_gz) != 4))
+    {
+        adxl362_interface_debug_print("adxl362: calibration unsolved check failed.\n");
+        
+        return 1;
+    }
+    memset(&gs_check, 0, sizeof(adxl362_calibration_handle_t));
+    if (adxl362_calibration_import(&gs_check, blob) != 3)
+    {
+        adxl362_interface_debug_print("adxl362: calibration import init check failed.\n");
+        
+        return 1;
+    }
+    
+    /* solve made sensors in all ranges, with and without the cross axis terms */
+    gs_seed = 1;
+    offset_error = 0.0;
+    decode_error = 0.0;
+    blob_error = 0.0;
+    rejected = 0;
+    rounds = times * 6;
+    for (j = 0; j < rounds; j++)
+    {
+        range = (adxl362_range_t)(j % 3);
+        cross_axis = ((j / 3) % 2) != 0 ? ADXL362_BOOL_TRUE : ADXL362_BOOL_FALSE;
+        lsb = (double)(1 << (uint8_t)range);
+        for (r = 0; r < 3; r++)
+        {
+            gs_offset[r] = 0.035 * a_adxl362_calibration_test_rand();
+            for (c = 0; c < 3; c++)
+            {
+                gs_sensitivity[r][c] = (cross_axis == ADXL362_BOOL_TRUE) ? 0.01 * a_adxl362_calibration_test_rand() : 0.0;
+            }
+            gs_sensitivity[r][r] = 1.0 + 0.05 * a_adxl362_calibration_test_rand();
+        }
+        
+        /* turn the board over, each pose is first held 6 degrees off level, then shaken, then lifted and set down level */
+        res = adxl362_calibration_init(&gs_handle, ADXL362_CALIBRATION_TEST_SAMPLES, a_adxl362_calibration_test_callback);
+        if (res != 0)
+        {
+            adxl362_interface_debug_print("adxl362: calibration init failed.\n");
+            
+            return 1;
+        }
+        gs_poses = 0;
+        for (p = 0; p < 6; p++)
+        {
+            a_adxl362_calibration_test_hold(p / 2, (p % 2) != 0 ? -1.0 : 1.0, 0.1, 2.0, range, ADXL362_CALIBRATION_TEST_SAMPLES);
+            if (gs_poses != p)
+            {
+                adxl362_interface_debug_print("adxl362: calibration took a tilted pose.\n");
+                
+                return 1;
+            }
+            a_adxl362_calibration_test_hold(p / 2, (p % 2) != 0 ? -1.0 : 1.0, 0.0, 200.0 / lsb, range, ADXL362_CALIBRATION_TEST_SAMPLES);
+            if (gs_poses != p)
+            {
+                adxl362_interface_debug_print("adxl362: calibration took a moving pose.\n");
+                
+                return 1;
+            }
+            a_adxl362_calibration_test_hold(p / 2, (p % 2) != 0 ? -1.0 : 1.0, 0.5, 2.0, range, 16);
+            a_adxl362_calibration_test_hold(p / 2, (p % 2) != 0 ? -1.0 : 1.0, 0.0, 2.0, range, ADXL362_CALIBRATION_TEST_SAMPLES);
+        }
+        (void)adxl362_calibration_get_next_pose(&gs_handle, &pose);
+        if ((gs_poses != 6) || (pose != ADXL362_CALIBRATION_POSE_NONE))
+        {
+            adxl362_interface_debug_print("adxl362: calibration got %d poses.\n", gs_poses);
+            
+            return 1;
+        }
+        res = adxl362_calibration_solve(&gs_handle, cross_axis);
+        if (res != 0)
+        {
+            adxl362_interface_debug_print("adxl362: calibration solve failed.\n");
+            
+            return 1;
+        }
+        for (r = 0; r < 3; r++)
+        {
+            e = fabs((double)gs_handle.offset[r] - gs_offset[r]);
+            offset_error = e > offset_error ? e : offset_error;
+        }
+        
+        /* decode random orientations without noise */
+        for (i = 0; i < ADXL362_BLOCK_MAX_LEN; i++)
+        {
+            gs_ux[i] = a_adxl362_calibration_test_rand();
+            gs_uy[i] = a_adxl362_calibration_test_rand();
+            gs_uz[i] = a_adxl362_calibration_test_rand();
+            norm = sqrt(gs_ux[i] * gs_ux[i] + gs_uy[i] * gs_uy[i] + gs_uz[i] * gs_uz[i]) + 1e-9;
+            gs_ux[i] /= norm;
+            gs_uy[i] /= norm;
+            gs_uz[i] /= norm;
+        }
+        a_adxl362_calibration_test_make(ADXL362_BLOCK_MAX_LEN, range, 0.0);
+        (void)adxl362_calibration_decode_block(&gs_handle, &gs_block, gs_gx, gs_gy, gs_gz);
+        for (i = 0; i < ADXL362_BLOCK_MAX_LEN; i++)
+        {
+            e = fabs(gs_gx[i] - gs_ux[i]);
+            e = fabs(gs_gy[i] - gs_uy[i]) > e ? fabs(gs_gy[i] - gs_uy[i]) : e;
+            e = fabs(gs_gz[i] - gs_uz[i]) > e ? fabs(gs_gz[i] - gs_uz[i]) : e;
+            e -= 0.6 * lsb / 1000.0;
+            decode_error = e > decode_error ? e : decode_error;
+        }
+        
+        /* round trip the blob */
+        res = adxl362_calibration_export(&gs_handle, blob);
+        if (res != 0)
+        {
+            adxl362_interface_debug_print("adxl362: calibration export failed.\n");
+            
+            return 1;
+        }
+        (void)adxl362_calibration_init(&gs_check, 1, NULL);
+        res = adxl362_calibration_import(&gs_check, blob);
+        if (res != 0)
+        {
+            adxl362_interface_debug_print("adxl362: calibration import failed.\n");
+            
+            return 1;
+        }
+        (void)adxl362_calibration_export(&gs_check, copy);
+        if (memcmp(blob, copy, ADXL362_CALIBRATION_BLOB_SIZE) != 0)
+        {
+            adxl362_interface_debug_print("adxl362: calibration blob is not stable.\n");
+            
+            return 1;
+        }
+        (void)adxl362_calibration_decode_block(&gs_check, &gs_block, gs_cx, gs_cy, gs_cz);
+        for (i = 0; i < ADXL362_BLOCK_MAX_LEN; i++)
+        {
+            e = fabs(gs_gx[i] - gs_cx[i]);
+            e = fabs(gs_gy[i] - gs_cy[i]) > e ? fabs(gs_gy[i] - gs_cy[i]) : e;
+            e = fabs(gs_gz[i] - gs_cz[i]) > e ? fabs(gs_gz[i] - gs_cz[i]) : e;
+            blob_error = e > blob_error ? e : blob_error;
+        }
+        
+        /* every single bit error must be rejected and leave the calibration alone */
+        memcpy(matrix, gs_check.matrix, sizeof(matrix));
+        memcpy(offset, gs_check.offset, sizeof(offset));
+        for (b = 0; b < ADXL362_CALIBRATION_BLOB_SIZE * 8; b++)
+        {
+            memcpy(copy, blob, ADXL362_CALIBRATION_BLOB_SIZE);
+            copy[b / 8] ^= (uint8_t)(1 << (b % 8));
+            res = adxl362_calibration_import(&gs_check, copy);
+            if ((res != 4) && (res != 5))
+            {
+                adxl362_interface_debug_print("adxl362: calibration took a blob with bit %d flipped.\n", b);
+                
+                return 1;
+            }
+            rejected++;
+        }
+        if ((memcmp(matrix, gs_check.matrix, sizeof(matrix)) != 0) || 
+            (memcmp(offset, gs_check.offset, sizeof(offset)) != 0))
+        {
+            adxl362_interface_debug_print("adxl362: calibration changed on a bad blob.\n");
+            
+            return 1;
+        }
+    }
+    adxl362_interface_debug_print("adxl362: %d sensors, max offset error %0.3fmg.\n", rounds, offset_error * 1000.0);
+    adxl362_interface_debug_print("adxl362: max decode error over the rounding %0.3fmg.\n", decode_error * 1000.0);
+    adxl362_interface_debug_print("adxl362: max blob round trip error %0.4fmg.\n", blob_error * 1000.0);
+    adxl362_interface_debug_print("adxl362: rejected %d corrupted blobs.\n", rejected);
+    if ((offset_error > 0.001) || (decode_error > 0.001) || (blob_error > 0.0001))
+    {
+        adxl362_interface_debug_print("adxl362: calibration accuracy check failed.\n");
+        
+        return 1;
+    }
+    
+    /* check a newer blob version */
+    memcpy(copy, blob, ADXL362_CALIBRATION_BLOB_SIZE);
+    copy[4]++;
+    if (adxl362_calibration_import(&gs_check, copy) != 4)
+    {
+        adxl362_interface_debug_print("adxl362: calibration version check failed.\n");
+        
+        return 1;
+    }
+    
+    /* benchmark */
+    loops = times * 20000;
+    for (c = 0; c < 2; c++)
+    {
+        (void)adxl362_calibration_solve(&gs_handle, c != 0 ? ADXL362_BOOL_TRUE : ADXL362_BOOL_FALSE);
+        start = clock();
+        for (j = 0; j < loops; j++)
+        {
+            (void)adxl362_calibration_decode_block(&gs_handle, &gs_block, gs_gx, gs_gy, gs_gz);
+        }
+        seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+        if (seconds > 0.0)
+        {
+            adxl362_interface_debug_print("adxl362: %s %0.0f samples/s.\n", c != 0 ? "cross axis" : "diagonal",
+                                          (double)loops * ADXL362_BLOCK_MAX_LEN / seconds);
+        }
+    }
+    
+    /* finish calibration test */
+    adxl362_interface_debug_print("adxl362: finish calibration test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,404 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_codec_test.c
+ * @brief     driver adxl362 codec test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_adxl362_codec_test.h"
+#include <math.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * @brief codec test definition
+ */
+#define ADXL362_CODEC_TEST_BLOCKS        16        /**< blocks per stream */
+#define ADXL362_CODEC_TEST_KINDS         6         /**< made signal kinds */
+
+static adxl362_codec_handle_t gs_handle;                                                /**< adxl362 codec handle */
+static adxl362_block_t gs_block[ADXL362_CODEC_TEST_BLOCKS];                             /**< made blocks */
+static adxl362_block_t gs_decoded;                                                      /**< decoded block */
+static uint8_t gs_stream[ADXL362_CODEC_TEST_BLOCKS * ADXL362_CODEC_MAX_SIZE];           /**< encoded stream */
+static uint8_t gs_copy[ADXL362_CODEC_MAX_SIZE];                                         /**< corrupted block */
+static uint32_t gs_seed;                                                                /**< random seed */
+
+/**
+ * @brief     random number
+ * @param[in] n number of values
+ * @return    value in [0, n)
+ * @note      none
+ */
+static uint32_t a_adxl362_codec_test_rand(uint32_t n)
+{
+    gs_seed = gs_seed * 1103515245U + 12345U;
+    
+    return (gs_seed >> 8) % n;
+}
+
+/**
+ * @brief     make a block
+ * @param[in] *block pointer to a block buffer
+ * @param[in] kind signal kind
+ * @param[in] len block length
+ * @param[in] range range of the raw data
+ * @note      still, walking, full scale noise, alternating extremes, constant and steps
+ */
+static void a_adxl362_codec_test_make(adxl362_block_t *block, uint8_t kind, uint16_t len, adxl362_range_t range)
+{
+    uint16_t i;
+    uint8_t a;
+    int32_t v;
+    int32_t level;
+    int16_t *out[3];
+    
+    out[0] = block->x;
+    out[1] = block->y;
+    out[2] = block->z;
+    for (a = 0; a < 3; a++)
+    {
+        level = (int32_t)a_adxl362_codec_test_rand(4001) - 2000;
+        for (i = 0; i < len; i++)
+        {
+            switch (kind)
+            {
+                case 0 :
+                {
+                    v = (a == 2 ? 1000 : 0) + (int32_t)a_adxl362_codec_test_rand(9) - 4;
+                    
+                    break;
+                }
+                case 1 :
+                {
+                    v = (a == 2 ? 1000 : 0) + (int32_t)(300.0 * sin(2.0 * 3.14159265 * 1.8 * (i + a) / 400.0)) + 
+                        (int32_t)a_adxl362_codec_test_rand(9) - 4;
+                    
+                    break;
+                }
+                case 2 :
+                {
+                    v = ((int32_t)a_adxl362_codec_test_rand(4096) - 2048) * (1 << (uint8_t)range);
+                    
+                    break;
+                }
+                case 3 :
+                {
+                    v = ((i % 2) != 0 ? 2047 : -2048) * (1 << (uint8_t)range);
+                    
+                    break;
+                }
+                case 4 :
+                {
+                    v = level;
+                    
+                    break;
+                }
+                default :
+                {
+                    if (a_adxl362_codec_test_rand(16) == 0)
+                    {
+                        level = (int32_t)a_adxl362_codec_test_rand(4001) - 2000;
+                    }
+                    v = level;
+                    
+                    break;
+                }
+            }
+            v >>= (uint8_t)range;
+            v = v < -2048 ? -2048 : (v > 2047 ? 2047 : v);
+            out[a][i] = (int16_t)v;
+        }
+    }
+    block->len = len;
+    block->range = range;
+    block->temperature_valid = (uint8_t)a_adxl362_codec_test_rand(2);
+    block->temperature_raw = (int16_t)((int32_t)a_adxl362_codec_test_rand(4096) - 2048);
+}
+
+/**
+ * @brief     check a decoded block
+ * @param[in] *block pointer to a decoded block
+ * @return    status code
+ *            - 0 valid
+ *            - 1 invalid
+ * @note      a decoded block must be safe to use even if its content is wrong
+ */
+static uint8_t a_adxl362_codec_test_valid(const adxl362_block_t *block)
+{
+    uint16_t i;
+    
+    if ((block->len > ADXL362_BLOCK_MAX_LEN) || ((uint8_t)block->range > 2) || (block->temperature_valid > 1))
+    {
+        return 1;
+    }
+    for (i = 0; i < block->len; i++)
+    {
+        if ((block->x[i] < -2048) || (block->x[i] > 2047) || 
+            (block->y[i] < -2048) || (block->y[i] > 2047) || 
+            (block->z[i] < -2048) || (block->z[i] > 2047))
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     compare two blocks
+ * @param[in] *a pointer to the first block
+ * @param[in] *b pointer to the second block
+ * @return    status code
+ *            - 0 same
+ *            - 1 different
+ * @note      none
+ */
+static uint8_t a_adxl362_codec_test_compare(const adxl362_block_t *a, const adxl362_block_t *b)
+{
+    if ((a->len != b->len) || (a->range != b->range) || 
+        (a->temperature_valid != b->temperature_valid) || (a->temperature_raw != b->temperature_raw))
+    {
+        return 1;
+    }
+    if ((memcmp(a->x, b->x, sizeof(int16_t) * a->len) != 0) || 
+        (memcmp(a->y, b->y, sizeof(int16_t) * a->len) != 0) || 
+        (memcmp(a->z, b->z, sizeof(int16_t) * a->len) != 0))
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     codec test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      round trips made blocks through a concatenated stream, checks that truncated, bit
+ *            flipped and garbage input is rejected or decodes to a valid block and reports the
+ *            compression ratio and blocks per second, no sensor is needed
+ */
+uint8_t adxl362_codec_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t kind;
+    uint16_t i;
+    uint16_t n;
+    uint16_t len;
+    uint16_t used;
+    uint16_t size[ADXL362_CODEC_TEST_BLOCKS];
+    uint32_t j;
+    uint32_t b;
+    uint32_t pos;
+    uint32_t rounds;
+    uint32_t flips;
+    uint32_t detected;
+    uint32_t blocks;
+    uint32_t raw_bytes;
+    uint32_t coded_bytes;
+    double seconds;
+    clock_t start;
+    
+    /* start codec test */
+    adxl362_interface_debug_print("adxl362: start codec test.\n");
+    
+    /* check the errors */
+    res = adxl362_codec_init(&gs_handle);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: codec init failed.\n");
+        
+        return 1;
+    }
+    gs_seed = 1;
+    a_adxl362_codec_test_make(&gs_block[0], 1, ADXL362_BLOCK_MAX_LEN, ADXL362_RANGE_2G);
+    gs_block[0].len = ADXL362_BLOCK_MAX_LEN + 1;
+    if (adxl362_codec_encode_block(&gs_handle, &gs_block[0], gs_stream, sizeof(gs_stream), &used) != 4)
+    {
+        adxl362_interface_debug_print("adxl362: codec length check failed.\n");
+        
+        return 1;
+    }
+    gs_block[0].len = ADXL362_BLOCK_MAX_LEN;
+    gs_block[0].x[7] = 2048;
+    if (adxl362_codec_encode_block(&gs_handle, &gs_block[0], gs_stream, sizeof(gs_stream), &used) != 4)
+    {
+        adxl362_interface_debug_print("adxl362: codec sample check failed.\n");
+        
+        return 1;
+    }
+    gs_block[0].x[7] = 0;
+    res = adxl362_codec_encode_block(&gs_handle, &gs_block[0], gs_stream, sizeof(gs_stream), &used);
+    if ((res != 0) || (adxl362_codec_encode_block(&gs_handle, &gs_block[0], gs_stream, used - 1, &used) != 5))
+    {
+        adxl362_interface_debug_print("adxl362: codec output size check failed.\n");
+        
+        return 1;
+    }
+    
+    /* round trip concatenated streams of all kinds, lengths and ranges */
+    rounds = times * 100;
+    flips = 0;
+    detected = 0;
+    for (j = 0; j < rounds; j++)
+    {
+        pos = 0;
+        for (i = 0; i < ADXL362_CODEC_TEST_BLOCKS; i++)
+        {
+            kind = (uint8_t)((j * ADXL362_CODEC_TEST_BLOCKS + i) % ADXL362_CODEC_TEST_KINDS);
+            len = (i == 0) ? 0 : ((i == 1) ? 1 : (uint16_t)a_adxl362_codec_test_rand(ADXL362_BLOCK_MAX_LEN + 1));
+            a_adxl362_codec_test_make(&gs_block[i], kind, len, (adxl362_range_t)a_adxl362_codec_test_rand(3));
+            res = adxl362_codec_encode_block(&gs_handle, &gs_block[i], &gs_stream[pos], ADXL362_CODEC_MAX_SIZE, &size[i]);
+            if ((res != 0) || (size[i] > ADXL362_CODEC_MAX_SIZE))
+            {
+                adxl362_interface_debug_print("adxl362: codec encode failed.\n");
+                
+                return 1;
+            }
+            pos += size[i];
+        }
+        pos = 0;
+        for (i = 0; i < ADXL362_CODEC_TEST_BLOCKS; i++)
+        {
+            n = (uint16_t)(sizeof(gs_stream) - pos > 65535 ? 65535 : sizeof(gs_stream) - pos);
+            res = adxl362_codec_decode_block(&gs_handle, &gs_stream[pos], n, &gs_decoded, &used);
+            if ((res != 0) || (used != size[i]) || (a_adxl362_codec_test_compare(&gs_block[i], &gs_decoded) != 0))
+            {
+                adxl362_interface_debug_print("adxl362: codec round trip failed at block %d.\n", i);
+                
+                return 1;
+            }
+            pos += used;
+        }
+        
+        /* every truncation of the last block must be rejected */
+        pos -= size[ADXL362_CODEC_TEST_BLOCKS - 1];
+        for (n = 0; n < size[ADXL362_CODEC_TEST_BLOCKS - 1]; n++)
+        {
+            if (adxl362_codec_decode_block(&gs_handle, &gs_stream[pos], n, &gs_decoded, &used) != 4)
+            {
+                adxl362_interface_debug_print("adxl362: codec took a block truncated to %d bytes.\n", n);
+                
+                return 1;
+            }
+        }
+        
+        /* a bit flip is caught or decodes to a valid block */
+        n = size[ADXL362_CODEC_TEST_BLOCKS - 1];
+        for (b = 0; b < (uint32_t)n * 8; b++)
+        {
+            memcpy(gs_copy, &gs_stream[pos], n);
+            gs_copy[b / 8] ^= (uint8_t)(1 << (b % 8));
+            res = adxl362_codec_decode_block(&gs_handle, gs_copy, n, &gs_decoded, &used);
+            flips++;
+            if (res != 0)
+            {
+                detected++;
+            }
+            else if ((used > n) || (a_adxl362_codec_test_valid(&gs_decoded) != 0))
+            {
+                adxl362_interface_debug_print("adxl362: codec decoded an invalid block from bit %d.\n", b);
+                
+                return 1;
+            }
+        }
+        
+        /* garbage behind a valid sync, version, length and payload size */
+        for (i = 0; i < ADXL362_CODEC_MAX_SIZE; i++)
+        {
+            gs_copy[i] = (uint8_t)a_adxl362_codec_test_rand(256);
+        }
+        gs_copy[0] = gs_stream[0];
+        gs_copy[1] = (uint8_t)((gs_stream[1] & 0xF0) | (gs_copy[1] & 0x07));
+        gs_copy[9] &= 0x0F;
+        len = (uint16_t)a_adxl362_codec_test_rand(ADXL362_BLOCK_MAX_LEN + 1);
+        gs_copy[2] = (uint8_t)(len & 0xFF);
+        gs_copy[3] = (uint8_t)(len >> 8);
+        n = (uint16_t)a_adxl362_codec_test_rand(ADXL362_CODEC_MAX_SIZE - ADXL362_CODEC_HEADER_SIZE + 1);
+        gs_copy[4] = (uint8_t)(n & 0xFF);
+        gs_copy[5] = (uint8_t)(n >> 8);
+        n += ADXL362_CODEC_HEADER_SIZE;
+        res = adxl362_codec_decode_block(&gs_handle, gs_copy, n, &gs_decoded, &used);
+        if ((res == 0) && ((used > n) || (a_adxl362_codec_test_valid(&gs_decoded) != 0)))
+        {
+            adxl362_interface_debug_print("adxl362: codec decoded an invalid block from garbage.\n");
+            
+            return 1;
+        }
+    }
+    adxl362_interface_debug_print("adxl362: %d blocks round trip.\n", rounds * ADXL362_CODEC_TEST_BLOCKS);
+    adxl362_interface_debug_print("adxl362: %d of %d bit flips detected, the rest decode to valid blocks.\n", detected, flips);
+    
+    /* compression ratio of still and walking blocks */
+    for (kind = 0; kind < 2; kind++)
+    {
+        (void)adxl362_codec_init(&gs_handle);
+        for (i = 0; i < ADXL362_CODEC_TEST_BLOCKS; i++)
+        {
+            a_adxl362_codec_test_make(&gs_block[i], kind, ADXL362_BLOCK_MAX_LEN, ADXL362_RANGE_2G);
+            (void)adxl362_codec_encode_block(&gs_handle, &gs_block[i], gs_stream, ADXL362_CODEC_MAX_SIZE, &used);
+        }
+        (void)adxl362_codec_get_stats(&gs_handle, &blocks, &raw_bytes, &coded_bytes);
+        adxl362_interface_debug_print("adxl362: %s ratio %0.2f.\n", kind == 0 ? "still" : "walking",
+                                      (double)raw_bytes / coded_bytes);
+    }
+    
+    /* benchmark the walking blocks */
+    start = clock();
+    for (j = 0; j < times * 2000; j++)
+    {
+        (void)adxl362_codec_encode_block(&gs_handle, &gs_block[j % ADXL362_CODEC_TEST_BLOCKS], gs_stream, 
+                                         ADXL362_CODEC_MAX_SIZE, &used);
+    }
+    seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    if (seconds > 0.0)
+    {
+        adxl362_interface_debug_print("adxl362: encode %0.0f blocks/s.\n", (double)times * 2000 / seconds);
+    }
+    start = clock();
+    for (j = 0; j < times * 2000; j++)
+    {
+        (void)adxl362_codec_decode_block(&gs_handle, gs_stream, ADXL362_CODEC_MAX_SIZE, &gs_decoded, &used);
+    }
+    seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    if (seconds > 0.0)
+    {
+        adxl362_interface_debug_print("adxl362: decode %0.0f blocks/s.\n", (double)times * 2000 / seconds);
+    }
+    
+    /* finish codec test */
+    adxl362_interface_debug_print("adxl362: finish codec test.\n");
+    
+    return 0;
+}
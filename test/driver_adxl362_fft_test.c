@@ -0,0 +1,158 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_fft_test.c
+ * @brief     driver adxl362 fft test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_adxl362_fft_test.h"
+#include <math.h>
+#include <time.h>
+
+static adxl362_fft_handle_t gs_handle;                  /**< adxl362 fft handle */
+static adxl362_fft_q15_handle_t gs_q15_handle;          /**< adxl362 fft q15 handle */
+static int16_t gs_raw[ADXL362_FFT_MAX_LEN];             /**< raw buffer */
+static float gs_buf[ADXL362_FFT_MAX_LEN];               /**< float transform buffer */
+static float gs_out[ADXL362_FFT_MAX_LEN / 2 + 1];       /**< float output buffer */
+static int16_t gs_q15_buf[ADXL362_FFT_MAX_LEN];         /**< q15 transform buffer */
+static uint16_t gs_q15_out[ADXL362_FFT_MAX_LEN / 2 + 1];/**< q15 output buffer */
+
+/**
+ * @brief     fft test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      checks the float and q15 transforms against a synthetic signal
+ *            and reports transforms per second, no sensor is needed
+ */
+uint8_t adxl362_fft_test(uint32_t times)
+{
+    uint8_t res;
+    uint16_t len;
+    uint16_t i;
+    uint16_t bin;
+    uint32_t j;
+    uint32_t loops;
+    clock_t start;
+    double seconds;
+    float amp;
+    
+    /* start fft test */
+    adxl362_interface_debug_print("adxl362: start fft test.\n");
+    
+    for (len = ADXL362_FFT_MIN_LEN; len <= ADXL362_FFT_MAX_LEN; len *= 2)
+    {
+        /* init the transforms */
+        res = adxl362_fft_init(&gs_handle, len, ADXL362_FFT_WINDOW_FLAT_TOP, 400.0f);
+        if (res != 0)
+        {
+            adxl362_interface_debug_print("adxl362: fft init failed.\n");
+            
+            return 1;
+        }
+        res = adxl362_fft_q15_init(&gs_q15_handle, len, ADXL362_FFT_WINDOW_FLAT_TOP, 400.0f);
+        if (res != 0)
+        {
+            adxl362_interface_debug_print("adxl362: fft q15 init failed.\n");
+            
+            return 1;
+        }
+        
+        /* 1g gravity and a 0.5g tone at len / 8 */
+        bin = len / 8;
+        for (i = 0; i < len; i++)
+        {
+            gs_raw[i] = (int16_t)floor(1000.0 + 500.0 * sin(2.0 * 3.14159265358979323846 * bin * i / len) + 0.5);
+        }
+        
+        /* check the float amplitude */
+        (void)adxl362_fft_load_raw(&gs_handle, gs_raw, ADXL362_RANGE_2G, ADXL362_BOOL_TRUE, gs_buf);
+        (void)adxl362_fft_forward(&gs_handle, gs_buf);
+        (void)adxl362_fft_magnitude(&gs_handle, gs_buf, gs_out);
+        amp = gs_out[bin];
+        adxl362_interface_debug_print("adxl362: len %d float amplitude is %0.4fg.\n", len, amp);
+        if (fabsf(amp - 0.5f) > 0.005f)
+        {
+            adxl362_interface_debug_print("adxl362: float amplitude check failed.\n");
+            
+            return 1;
+        }
+        
+        /* check the q15 amplitude */
+        (void)adxl362_fft_q15_load_raw(&gs_q15_handle, gs_raw, ADXL362_BOOL_TRUE, gs_q15_buf);
+        (void)adxl362_fft_q15_forward(&gs_q15_handle, gs_q15_buf);
+        (void)adxl362_fft_q15_magnitude(&gs_q15_handle, gs_q15_buf, gs_q15_out);
+        amp = (float)gs_q15_out[bin] / 4000.0f;
+        adxl362_interface_debug_print("adxl362: len %d q15 amplitude is %0.4fg.\n", len, amp);
+        if (fabsf(amp - 0.5f) > 0.01f)
+        {
+            adxl362_interface_debug_print("adxl362: q15 amplitude check failed.\n");
+            
+            return 1;
+        }
+        
+        /* same work for every length */
+        loops = times * (1024UL * 1024UL / len);
+        
+        /* float benchmark */
+        start = clock();
+        for (j = 0; j < loops; j++)
+        {
+            (void)adxl362_fft_load_raw(&gs_handle, gs_raw, ADXL362_RANGE_2G, ADXL362_BOOL_FALSE, gs_buf);
+            (void)adxl362_fft_forward(&gs_handle, gs_buf);
+        }
+        seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+        if (seconds > 0.0)
+        {
+            adxl362_interface_debug_print("adxl362: len %d float %0.0f transforms/s.\n", len, (double)loops / seconds);
+        }
+        
+        /* q15 benchmark */
+        start = clock();
+        for (j = 0; j < loops; j++)
+        {
+            (void)adxl362_fft_q15_load_raw(&gs_q15_handle, gs_raw, ADXL362_BOOL_FALSE, gs_q15_buf);
+            (void)adxl362_fft_q15_forward(&gs_q15_handle, gs_q15_buf);
+        }
+        seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+        if (seconds > 0.0)
+        {
+            adxl362_interface_debug_print("adxl362: len %d q15 %0.0f transforms/s.\n", len, (double)loops / seconds);
+        }
+    }
+    
+    /* finish fft test */
+    adxl362_interface_debug_print("adxl362: finish fft test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,264 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_gesture_test.c
+ * @brief     driver adxl362 gesture test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_adxl362_gesture_test.h"
+#include <time.h>
+
+/**
+ * @brief adxl362 gesture test definition
+ */
+#define ADXL362_GESTURE_TEST_LEN           2400        /**< stream length in samples at 400Hz */
+#define ADXL362_GESTURE_TEST_TAP_MG        1500        /**< tap height in mg */
+#define ADXL362_GESTURE_TEST_TAP_LEN       4           /**< tap length in samples */
+#define ADXL362_GESTURE_TEST_EVENTS        16          /**< max recorded events */
+
+static adxl362_gesture_handle_t gs_handle;                                  /**< adxl362 gesture handle */
+static int16_t gs_x[ADXL362_GESTURE_TEST_LEN];                              /**< x raw buffer */
+static int16_t gs_y[ADXL362_GESTURE_TEST_LEN];                              /**< y raw buffer */
+static int16_t gs_z[ADXL362_GESTURE_TEST_LEN];                              /**< z raw buffer */
+static adxl362_gesture_event_t gs_event[ADXL362_GESTURE_TEST_EVENTS];       /**< recorded events */
+static uint32_t gs_events;                                                  /**< event number */
+
+/**
+ * @brief expected tap events
+ */
+static const struct
+{
+    adxl362_gesture_event_type_t type;        /**< event type */
+    uint32_t sample;                          /**< tap start */
+    uint8_t axis;                             /**< tap axis */
+    int8_t sign;                              /**< tap direction */
+} gsc_adxl362_gesture_test_tap[6] =
+{
+    {ADXL362_GESTURE_EVENT_SINGLE_TAP, 400, 2, 1},
+    {ADXL362_GESTURE_EVENT_SINGLE_TAP, 800, 2, 1},
+    {ADXL362_GESTURE_EVENT_DOUBLE_TAP, 880, 0, -1},
+    {ADXL362_GESTURE_EVENT_SINGLE_TAP, 1200, 2, 1},
+    {ADXL362_GESTURE_EVENT_SINGLE_TAP, 1600, 2, 1},
+    {ADXL362_GESTURE_EVENT_SINGLE_TAP, 1784, 1, 1},
+};
+
+/**
+ * @brief fifo read sizes, the second one splits the taps across blocks
+ */
+static const uint16_t gsc_adxl362_gesture_test_block[2] = {32, 7};
+
+/**
+ * @brief     gesture event callback
+ * @param[in] *event pointer to an event structure
+ * @note      none
+ */
+static void a_adxl362_gesture_test_callback(const adxl362_gesture_event_t *event)
+{
+    if (gs_events < ADXL362_GESTURE_TEST_EVENTS)
+    {
+        gs_event[gs_events] = *event;
+    }
+    gs_events++;
+}
+
+/**
+ * @brief     add a short pulse to an axis
+ * @param[in] *buf pointer to an axis buffer
+ * @param[in] start first sample
+ * @param[in] len pulse length
+ * @param[in] mg pulse height in mg
+ * @note      none
+ */
+static void a_adxl362_gesture_test_pulse(int16_t *buf, uint32_t start, uint32_t len, int16_t mg)
+{
+    uint32_t i;
+    
+    for (i = start; i < start + len; i++)
+    {
+        buf[i] = (int16_t)(buf[i] + mg);
+    }
+}
+
+/**
+ * @brief     feed the stream in fifo sized blocks
+ * @param[in] block samples per fifo read
+ * @note      none
+ */
+static void a_adxl362_gesture_test_run(uint16_t block)
+{
+    uint32_t i;
+    uint16_t n;
+    
+    for (i = 0; i < ADXL362_GESTURE_TEST_LEN; i += n)
+    {
+        n = (ADXL362_GESTURE_TEST_LEN - i) < block ? (uint16_t)(ADXL362_GESTURE_TEST_LEN - i) : block;
+        (void)adxl362_gesture_update(&gs_handle, &gs_x[i], &gs_y[i], &gs_z[i], n, ADXL362_RANGE_2G);
+    }
+}
+
+/**
+ * @brief     gesture test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      runs a synthetic 400Hz stream with single, double, ringing and late taps and a
+ *            turn over, checks the events against two fifo block sizes, then reports samples
+ *            per second, no sensor is needed
+ */
+uint8_t adxl362_gesture_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t pass;
+    uint16_t block;
+    uint32_t i;
+    uint32_t k;
+    uint32_t j;
+    uint32_t loops;
+    double seconds;
+    clock_t start;
+    adxl362_gesture_config_t config;
+    
+    /* start gesture test */
+    adxl362_interface_debug_print("adxl362: start gesture test.\n");
+    
+    /* face up with a few mg of noise, turned face down from 2000 */
+    for (i = 0; i < ADXL362_GESTURE_TEST_LEN; i++)
+    {
+        gs_x[i] = (int16_t)((int32_t)(i % 7) - 3);
+        gs_y[i] = (int16_t)((int32_t)(i % 5) - 2);
+        gs_z[i] = (int16_t)((i < 2000) ? 1000 : -1000);
+    }
+    
+    /* a lone tap */
+    a_adxl362_gesture_test_pulse(gs_z, 400, ADXL362_GESTURE_TEST_TAP_LEN, ADXL362_GESTURE_TEST_TAP_MG);
+    
+    /* two taps 200ms apart, the second one on -x */
+    a_adxl362_gesture_test_pulse(gs_z, 800, ADXL362_GESTURE_TEST_TAP_LEN, ADXL362_GESTURE_TEST_TAP_MG);
+    a_adxl362_gesture_test_pulse(gs_x, 880, ADXL362_GESTURE_TEST_TAP_LEN, -ADXL362_GESTURE_TEST_TAP_MG);
+    
+    /* a tap ringing inside the latency */
+    a_adxl362_gesture_test_pulse(gs_z, 1200, ADXL362_GESTURE_TEST_TAP_LEN, ADXL362_GESTURE_TEST_TAP_MG);
+    a_adxl362_gesture_test_pulse(gs_z, 1215, 3, 800);
+    
+    /* a second tap 50ms after the window */
+    a_adxl362_gesture_test_pulse(gs_z, 1600, ADXL362_GESTURE_TEST_TAP_LEN, ADXL362_GESTURE_TEST_TAP_MG);
+    a_adxl362_gesture_test_pulse(gs_y, 1784, ADXL362_GESTURE_TEST_TAP_LEN, ADXL362_GESTURE_TEST_TAP_MG);
+    
+    /* 50ms tap, 100ms latency, 300ms double tap window at 400Hz */
+    config.tap_mg = 500;
+    config.tap_duration = 20;
+    config.tap_latency = 40;
+    config.tap_window = 120;
+    config.orientation_mg = 800;
+    config.orientation_time = 40;
+    config.baseline_shift = 4;
+    
+    /* the events must not depend on how the fifo is read */
+    pass = 1;
+    for (k = 0; k < 2; k++)
+    {
+        block = gsc_adxl362_gesture_test_block[k];
+        res = adxl362_gesture_init(&gs_handle, &config, a_adxl362_gesture_test_callback);
+        if (res != 0)
+        {
+            adxl362_interface_debug_print("adxl362: gesture init failed.\n");
+            
+            return 1;
+        }
+        gs_events = 0;
+        a_adxl362_gesture_test_run(block);
+        if (gs_events != 8)
+        {
+            adxl362_interface_debug_print("adxl362: %d events with %d sample blocks, 8 expected.\n", gs_events, block);
+            
+            return 1;
+        }
+        if ((gs_event[0].type != ADXL362_GESTURE_EVENT_ORIENTATION) || (gs_event[0].sample != 0) ||
+            (gs_event[0].orientation != ADXL362_GESTURE_ORIENTATION_FACE_UP))
+        {
+            pass = 0;
+        }
+        for (j = 0; j < 6; j++)
+        {
+            adxl362_gesture_event_t *e = &gs_event[j + 1];
+            
+            if (block == 32)
+            {
+                adxl362_interface_debug_print("adxl362: %s tap at sample %d, axis %d, sign %d, peak %dmg.\n",
+                                              (e->type == ADXL362_GESTURE_EVENT_DOUBLE_TAP) ? "double" : "single",
+                                              e->sample, e->axis, e->sign, e->peak_mg);
+            }
+            if ((e->type != gsc_adxl362_gesture_test_tap[j].type) || (e->sample != gsc_adxl362_gesture_test_tap[j].sample) ||
+                (e->axis != gsc_adxl362_gesture_test_tap[j].axis) || (e->sign != gsc_adxl362_gesture_test_tap[j].sign) ||
+                (e->peak_mg < ADXL362_GESTURE_TEST_TAP_MG - 10) || (e->peak_mg > ADXL362_GESTURE_TEST_TAP_MG + 10))
+            {
+                pass = 0;
+            }
+        }
+        
+        /* turning over is a slow step, not a tap */
+        if (block == 32)
+        {
+            adxl362_interface_debug_print("adxl362: face down from sample %d.\n", gs_event[7].sample);
+        }
+        if ((gs_event[7].type != ADXL362_GESTURE_EVENT_ORIENTATION) || (gs_event[7].sample < 2000) ||
+            (gs_event[7].sample > 2100) || (gs_event[7].orientation != ADXL362_GESTURE_ORIENTATION_FACE_DOWN))
+        {
+            pass = 0;
+        }
+        if (pass == 0)
+        {
+            adxl362_interface_debug_print("adxl362: gesture event check failed with %d sample blocks.\n", block);
+            
+            return 1;
+        }
+    }
+    
+    /* benchmark */
+    loops = times * 1000;
+    start = clock();
+    for (j = 0; j < loops; j++)
+    {
+        a_adxl362_gesture_test_run(32);
+    }
+    seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    if (seconds > 0.0)
+    {
+        adxl362_interface_debug_print("adxl362: %0.0f samples/s.\n", (double)loops * ADXL362_GESTURE_TEST_LEN / seconds);
+    }
+    
+    /* finish gesture test */
+    adxl362_interface_debug_print("adxl362: finish gesture test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,341 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_histogram_test.c
+ * @brief     driver adxl362 histogram test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_adxl362_histogram_test.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * @brief histogram test definition
+ */
+#define ADXL362_HISTOGRAM_TEST_LEN        (ADXL362_BLOCK_MAX_LEN * 24)        /**< samples per round */
+
+static adxl362_histogram_handle_t gs_handle;                   /**< adxl362 histogram handle of all samples */
+static adxl362_histogram_handle_t gs_first;                    /**< adxl362 histogram handle of the first half */
+static adxl362_histogram_handle_t gs_second;                   /**< adxl362 histogram handle of the second half */
+static adxl362_histogram_handle_t gs_check;                    /**< adxl362 histogram handle of the import */
+static adxl362_block_t gs_block;                               /**< raw block */
+static uint32_t gs_sq[ADXL362_HISTOGRAM_TEST_LEN];             /**< squared magnitudes in mg^2 */
+static uint8_t gs_export[ADXL362_HISTOGRAM_MAX_SIZE];          /**< exported histogram */
+static uint8_t gs_copy[ADXL362_HISTOGRAM_MAX_SIZE];            /**< corrupted export */
+static uint32_t gs_seed;                                       /**< random seed */
+
+/**
+ * @brief     random number
+ * @param[in] n number of values
+ * @return    value in [0, n)
+ * @note      none
+ */
+static uint32_t a_adxl362_histogram_test_rand(uint32_t n)
+{
+    gs_seed = gs_seed * 1103515245U + 12345U;
+    
+    return (gs_seed >> 8) % n;
+}
+
+/**
+ * @brief     compare two squared magnitudes
+ * @param[in] *a pointer to the first value
+ * @param[in] *b pointer to the second value
+ * @return    order
+ * @note      none
+ */
+static int a_adxl362_histogram_test_order(const void *a, const void *b)
+{
+    uint32_t x;
+    uint32_t y;
+    
+    x = *(const uint32_t *)a;
+    y = *(const uint32_t *)b;
+    
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief     compare two histograms
+ * @param[in] *a pointer to the first histogram
+ * @param[in] *b pointer to the second histogram
+ * @return    status code
+ *            - 0 same
+ *            - 1 different
+ * @note      none
+ */
+static uint8_t a_adxl362_histogram_test_compare(const adxl362_histogram_handle_t *a, const adxl362_histogram_handle_t *b)
+{
+    if ((a->count != b->count) || (a->min_sq != b->min_sq) || (a->max_sq != b->max_sq) || 
+        (memcmp(a->bucket, b->bucket, sizeof(a->bucket)) != 0))
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     make and add a block
+ * @param[in] *handle pointer to a histogram handle
+ * @param[in] *sq pointer to a squared magnitude buffer
+ * @note      gravity with noise in a random orientation and range, with a few shocks
+ */
+static void a_adxl362_histogram_test_add(adxl362_histogram_handle_t *handle, uint32_t *sq)
+{
+    uint16_t i;
+    uint8_t a;
+    int32_t v[3];
+    int32_t g[3];
+    int32_t noise;
+    adxl362_range_t range;
+    
+    range = (adxl362_range_t)a_adxl362_histogram_test_rand(3);
+    noise = 1 + (int32_t)a_adxl362_histogram_test_rand(200);
+    for (a = 0; a < 3; a++)
+    {
+        g[a] = (int32_t)a_adxl362_histogram_test_rand(1155) - 577;
+    }
+    for (i = 0; i < ADXL362_BLOCK_MAX_LEN; i++)
+    {
+        for (a = 0; a < 3; a++)
+        {
+            v[a] = g[a] + (int32_t)a_adxl362_histogram_test_rand((uint32_t)noise * 2 + 1) - noise;
+            if (a_adxl362_histogram_test_rand(64) == 0)
+            {
+                v[a] = (int32_t)a_adxl362_histogram_test_rand(16001) - 8000;
+            }
+            v[a] /= (1 << (uint8_t)range);
+            v[a] = v[a] < -2048 ? -2048 : (v[a] > 2047 ? 2047 : v[a]);
+        }
+        gs_block.x[i] = (int16_t)v[0];
+        gs_block.y[i] = (int16_t)v[1];
+        gs_block.z[i] = (int16_t)v[2];
+        sq[i] = (uint32_t)(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]) << ((uint8_t)range * 2);
+    }
+    gs_block.len = ADXL362_BLOCK_MAX_LEN;
+    gs_block.range = range;
+    (void)adxl362_histogram_update_block(handle, &gs_block);
+    (void)adxl362_histogram_update_block(&gs_handle, &gs_block);
+}
+
+/**
+ * @brief     histogram test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      checks the percentiles against a sort, the merge against one pass, round trips
+ *            the export, checks that truncated and bit flipped exports are rejected and
+ *            reports samples per second, no sensor is needed
+ */
+uint8_t adxl362_histogram_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t p;
+    uint16_t i;
+    uint16_t n;
+    uint16_t len;
+    uint16_t out_len;
+    uint32_t j;
+    uint32_t b;
+    uint32_t rank;
+    uint32_t rounds;
+    uint32_t rejected;
+    float mg;
+    float r;
+    double e;
+    double exact;
+    double error;
+    double seconds;
+    adxl362_histogram_summary_t summary;
+    adxl362_histogram_summary_t check;
+    clock_t start;
+    const float percent[8] = {0.0f, 1.0f, 50.0f, 90.0f, 95.0f, 99.0f, 99.9f, 100.0f};
+    
+    /* start histogram test */
+    adxl362_interface_debug_print("adxl362: start histogram test.\n");
+    
+    /* check an empty histogram */
+    res = adxl362_histogram_init(&gs_handle);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: histogram init failed.\n");
+        
+        return 1;
+    }
+    (void)adxl362_histogram_init(&gs_check);
+    if ((adxl362_histogram_get_summary(&gs_handle, &summary) != 4) || 
+        (adxl362_histogram_get_percentile(&gs_handle, 50.0f, &mg) != 5) || 
+        (adxl362_histogram_export(&gs_handle, gs_export, sizeof(gs_export), &len) != 0) || 
+        (adxl362_histogram_import(&gs_check, gs_export, len) != 0) || 
+        (a_adxl362_histogram_test_compare(&gs_handle, &gs_check) != 0))
+    {
+        adxl362_interface_debug_print("adxl362: histogram empty check failed.\n");
+        
+        return 1;
+    }
+    
+    /* random rounds */
+    gs_seed = 1;
+    error = 0.0;
+    rejected = 0;
+    rounds = times * 4;
+    for (j = 0; j < rounds; j++)
+    {
+        (void)adxl362_histogram_clear(&gs_handle);
+        (void)adxl362_histogram_init(&gs_first);
+        (void)adxl362_histogram_init(&gs_second);
+        for (i = 0; i < ADXL362_HISTOGRAM_TEST_LEN / ADXL362_BLOCK_MAX_LEN; i++)
+        {
+            a_adxl362_histogram_test_add((i % 2) != 0 ? &gs_second : &gs_first, &gs_sq[i * ADXL362_BLOCK_MAX_LEN]);
+        }
+        
+        /* the merge of both halves is the histogram of all samples */
+        res = adxl362_histogram_merge(&gs_first, &gs_second);
+        if ((res != 0) || (a_adxl362_histogram_test_compare(&gs_first, &gs_handle) != 0))
+        {
+            adxl362_interface_debug_print("adxl362: histogram merge check failed.\n");
+            
+            return 1;
+        }
+        
+        /* the percentiles are within the bucket of the sorted nearest rank */
+        qsort(gs_sq, ADXL362_HISTOGRAM_TEST_LEN, sizeof(uint32_t), a_adxl362_histogram_test_order);
+        for (p = 0; p < 8; p++)
+        {
+            (void)adxl362_histogram_get_percentile(&gs_handle, percent[p], &mg);
+            r = ceilf(percent[p] * 0.01f * (float)ADXL362_HISTOGRAM_TEST_LEN);
+            rank = (r < 1.0f) ? 1 : (uint32_t)r;
+            exact = sqrt((double)gs_sq[rank - 1]);
+            e = fabs((double)mg - exact) / (exact > 8.0 ? exact : 8.0);
+            error = e > error ? e : error;
+        }
+        
+        /* round trip the export */
+        res = adxl362_histogram_export(&gs_handle, gs_export, sizeof(gs_export), &len);
+        if (res != 0)
+        {
+            adxl362_interface_debug_print("adxl362: histogram export failed.\n");
+            
+            return 1;
+        }
+        res = adxl362_histogram_import(&gs_check, gs_export, len);
+        (void)adxl362_histogram_get_summary(&gs_handle, &summary);
+        (void)adxl362_histogram_get_summary(&gs_check, &check);
+        if ((res != 0) || (a_adxl362_histogram_test_compare(&gs_handle, &gs_check) != 0) || 
+            (memcmp(&summary, &check, sizeof(summary)) != 0))
+        {
+            adxl362_interface_debug_print("adxl362: histogram round trip failed.\n");
+            
+            return 1;
+        }
+        
+        /* a short buffer fails the export, a truncated export fails the import */
+        for (n = 0; n < len; n++)
+        {
+            if (adxl362_histogram_export(&gs_handle, gs_copy, n, &out_len) != 4)
+            {
+                adxl362_interface_debug_print("adxl362: histogram exported into %d bytes.\n", n);
+                
+                return 1;
+            }
+            res = adxl362_histogram_import(&gs_check, gs_export, n);
+            if ((res != 4) && (res != 6))
+            {
+                adxl362_interface_debug_print("adxl362: histogram took an export truncated to %d bytes.\n", n);
+                
+                return 1;
+            }
+        }
+        
+        /* every single bit error must be rejected and leave the histogram alone */
+        for (b = 0; b < (uint32_t)len * 8; b++)
+        {
+            memcpy(gs_copy, gs_export, len);
+            gs_copy[b / 8] ^= (uint8_t)(1 << (b % 8));
+            res = adxl362_histogram_import(&gs_check, gs_copy, len);
+            if ((res != 4) && (res != 5) && (res != 6))
+            {
+                adxl362_interface_debug_print("adxl362: histogram took an export with bit %d flipped.\n", b);
+                
+                return 1;
+            }
+            rejected++;
+        }
+        if (a_adxl362_histogram_test_compare(&gs_handle, &gs_check) != 0)
+        {
+            adxl362_interface_debug_print("adxl362: histogram changed on a bad export.\n");
+            
+            return 1;
+        }
+    }
+    adxl362_interface_debug_print("adxl362: %d samples, max percentile error %0.3f%%.\n", rounds * ADXL362_HISTOGRAM_TEST_LEN, error * 100.0);
+    adxl362_interface_debug_print("adxl362: last export has %d bytes for %d samples.\n", len, ADXL362_HISTOGRAM_TEST_LEN);
+    adxl362_interface_debug_print("adxl362: rejected %d corrupted exports.\n", rejected);
+    if (error > 1.0 / 128.0 + 0.0001)
+    {
+        adxl362_interface_debug_print("adxl362: histogram percentile check failed.\n");
+        
+        return 1;
+    }
+    
+    /* check a newer version */
+    memcpy(gs_copy, gs_export, len);
+    gs_copy[4]++;
+    if ((adxl362_histogram_import(&gs_check, gs_copy, len) != 4) || 
+        (adxl362_histogram_get_percentile(&gs_handle, 100.1f, &mg) != 4))
+    {
+        adxl362_interface_debug_print("adxl362: histogram version check failed.\n");
+        
+        return 1;
+    }
+    
+    /* benchmark */
+    start = clock();
+    for (j = 0; j < times * 20000; j++)
+    {
+        (void)adxl362_histogram_update_block(&gs_handle, &gs_block);
+    }
+    seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    if (seconds > 0.0)
+    {
+        adxl362_interface_debug_print("adxl362: %0.0f samples/s.\n", (double)times * 20000 * ADXL362_BLOCK_MAX_LEN / seconds);
+    }
+    
+    /* finish histogram test */
+    adxl362_interface_debug_print("adxl362: finish histogram test.\n");
+    
+    return 0;
+}
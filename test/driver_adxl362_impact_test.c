@@ -0,0 +1,239 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_impact_test.c
+ * @brief     driver adxl362 impact test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_adxl362_impact_test.h"
+#include <time.h>
+
+/**
+ * @brief adxl362 impact test definition
+ */
+#define ADXL362_IMPACT_TEST_LEN          1400        /**< sequence length in samples at 100Hz */
+#define ADXL362_IMPACT_TEST_BLOCK        50          /**< samples per fifo read */
+#define ADXL362_IMPACT_TEST_RECORDS      8           /**< max saved records */
+
+/**
+ * @brief adxl362 impact test record structure definition
+ */
+typedef struct adxl362_impact_test_record_s
+{
+    adxl362_impact_type_t type;        /**< event type */
+    uint32_t sample;                   /**< trigger sample */
+    uint16_t fall_time;                /**< free fall samples */
+    uint16_t peak_mg;                  /**< peak magnitude in mg */
+    uint16_t pre;                      /**< samples before the trigger */
+    uint16_t len;                      /**< captured samples */
+} adxl362_impact_test_record_t;
+
+static adxl362_impact_handle_t gs_handle;                                       /**< adxl362 impact handle */
+static int16_t gs_x[ADXL362_IMPACT_TEST_LEN];                                   /**< x raw buffer */
+static int16_t gs_y[ADXL362_IMPACT_TEST_LEN];                                   /**< y raw buffer */
+static int16_t gs_z[ADXL362_IMPACT_TEST_LEN];                                   /**< z raw buffer */
+static adxl362_impact_test_record_t gs_record[ADXL362_IMPACT_TEST_RECORDS];     /**< saved records */
+static uint32_t gs_record_count;                                                /**< record number */
+static uint32_t gs_mismatch;                                                    /**< captured samples not matching the input */
+
+/**
+ * @brief expected records of the sequence
+ */
+static const struct
+{
+    adxl362_impact_type_t type;        /**< event type */
+    uint32_t sample;                   /**< trigger sample */
+    uint16_t fall_time;                /**< free fall samples */
+} gsc_expected[3] =
+{
+    {ADXL362_IMPACT_TYPE_DROP, 309, 40},         /* 400ms fall, then a 5g shock */
+    {ADXL362_IMPACT_TYPE_SHOCK, 601, 0},         /* 4g for 3 samples */
+    {ADXL362_IMPACT_TYPE_FREE_FALL, 909, 30},    /* 300ms fall and a soft landing */
+};
+
+/**
+ * @brief     impact record callback
+ * @param[in] *record pointer to a record structure
+ * @note      the samples are compared here, the record is only valid during the call
+ */
+static void a_adxl362_impact_test_callback(adxl362_impact_record_t *record)
+{
+    uint16_t i;
+    uint32_t first;
+    
+    first = record->sample - record->pre;
+    for (i = 0; i < record->len; i++)
+    {
+        if ((record->x[i] != gs_x[first + i]) || (record->y[i] != gs_y[first + i]) ||
+            (record->z[i] != gs_z[first + i]))
+        {
+            gs_mismatch++;
+        }
+    }
+    if (gs_record_count < ADXL362_IMPACT_TEST_RECORDS)
+    {
+        gs_record[gs_record_count].type = record->type;
+        gs_record[gs_record_count].sample = record->sample;
+        gs_record[gs_record_count].fall_time = record->fall_time;
+        gs_record[gs_record_count].peak_mg = record->peak_mg;
+        gs_record[gs_record_count].pre = record->pre;
+        gs_record[gs_record_count].len = record->len;
+    }
+    gs_record_count++;
+}
+
+/**
+ * @brief     impact test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      runs a synthetic drop, a lone shock, a lone free fall and a short dip through the
+ *            detector, checks the type, timing and captured samples of every record and reports
+ *            samples per second, no sensor is needed
+ */
+uint8_t adxl362_impact_test(uint32_t times)
+{
+    uint8_t res;
+    uint16_t n;
+    uint32_t i;
+    uint32_t j;
+    uint32_t loops;
+    double seconds;
+    clock_t start;
+    adxl362_impact_config_t config;
+    static const char *const type_name[3] = {"free fall", "shock", "drop"};
+    
+    /* start impact test */
+    adxl362_interface_debug_print("adxl362: start impact test.\n");
+    
+    /* 1g at rest in the 8g range, one lsb is 4mg */
+    for (i = 0; i < ADXL362_IMPACT_TEST_LEN; i++)
+    {
+        gs_x[i] = (int16_t)((i % 3) - 1);
+        gs_y[i] = (int16_t)((i % 5) - 2);
+        gs_z[i] = 250;
+        if (((i >= 300) && (i < 340)) || ((i >= 900) && (i < 930)) || ((i >= 1200) && (i < 1205)))
+        {
+            gs_z[i] = (int16_t)(10 + (i % 4));                  /* falling, about 50mg */
+        }
+        if ((i >= 340) && (i < 345))
+        {
+            gs_z[i] = 1250;                                     /* 5g landing */
+        }
+        if ((i >= 600) && (i < 603))
+        {
+            gs_x[i] = 1000;                                     /* 4g knock on 1g, 4.12g */
+        }
+    }
+    
+    /* 300mg for 100ms is a fall, 3g for 20ms is a shock, a shock within 200ms of a fall is a drop */
+    config.free_fall_mg = 300;
+    config.free_fall_time = 10;
+    config.shock_mg = 3000;
+    config.shock_time = 2;
+    config.shock_window = 20;
+    config.pre = 64;
+    config.post = 128;
+    res = adxl362_impact_init(&gs_handle, &config, a_adxl362_impact_test_callback);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: impact init failed.\n");
+        
+        return 1;
+    }
+    
+    /* run the sequence in fifo sized blocks */
+    gs_record_count = 0;
+    gs_mismatch = 0;
+    for (i = 0; i < ADXL362_IMPACT_TEST_LEN; i += n)
+    {
+        n = (ADXL362_IMPACT_TEST_LEN - i) < ADXL362_IMPACT_TEST_BLOCK ? (uint16_t)(ADXL362_IMPACT_TEST_LEN - i) :
+                                                                         ADXL362_IMPACT_TEST_BLOCK;
+        (void)adxl362_impact_update(&gs_handle, &gs_x[i], &gs_y[i], &gs_z[i], n, ADXL362_RANGE_8G);
+    }
+    for (j = 0; (j < gs_record_count) && (j < ADXL362_IMPACT_TEST_RECORDS); j++)
+    {
+        adxl362_interface_debug_print("adxl362: %s at sample %d, fall %d samples, peak %dmg, %d + %d samples.\n",
+                                      type_name[gs_record[j].type], gs_record[j].sample, gs_record[j].fall_time,
+                                      gs_record[j].peak_mg, gs_record[j].pre, gs_record[j].len - gs_record[j].pre);
+    }
+    if (gs_record_count != sizeof(gsc_expected) / sizeof(gsc_expected[0]))
+    {
+        adxl362_interface_debug_print("adxl362: impact record number check failed.\n");
+        
+        return 1;
+    }
+    for (j = 0; j < gs_record_count; j++)
+    {
+        if ((gs_record[j].type != gsc_expected[j].type) || (gs_record[j].sample != gsc_expected[j].sample) ||
+            (gs_record[j].fall_time != gsc_expected[j].fall_time) || (gs_record[j].pre != config.pre) ||
+            (gs_record[j].len != config.pre + config.post))
+        {
+            adxl362_interface_debug_print("adxl362: impact record %d check failed.\n", j);
+            
+            return 1;
+        }
+    }
+    if ((gs_record[0].peak_mg < 4990) || (gs_record[0].peak_mg > 5010) ||
+        (gs_record[1].peak_mg < 4113) || (gs_record[1].peak_mg > 4133))
+    {
+        adxl362_interface_debug_print("adxl362: impact peak check failed.\n");
+        
+        return 1;
+    }
+    if (gs_mismatch != 0)
+    {
+        adxl362_interface_debug_print("adxl362: %d captured samples differ from the input.\n", gs_mismatch);
+        
+        return 1;
+    }
+    
+    /* benchmark */
+    (void)adxl362_impact_init(&gs_handle, &config, NULL);
+    loops = times * 2000;
+    start = clock();
+    for (j = 0; j < loops; j++)
+    {
+        (void)adxl362_impact_update(&gs_handle, gs_x, gs_y, gs_z, ADXL362_IMPACT_TEST_LEN, ADXL362_RANGE_8G);
+    }
+    seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    if (seconds > 0.0)
+    {
+        adxl362_interface_debug_print("adxl362: %0.0f samples/s.\n", (double)loops * ADXL362_IMPACT_TEST_LEN / seconds);
+    }
+    
+    /* finish impact test */
+    adxl362_interface_debug_print("adxl362: finish impact test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,230 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_recorder_test.c
+ * @brief     driver adxl362 recorder test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_adxl362_recorder_test.h"
+#include <time.h>
+
+/**
+ * @brief adxl362 recorder test definition
+ */
+#define ADXL362_RECORDER_TEST_LEN          2000        /**< stream length in samples */
+#define ADXL362_RECORDER_TEST_BLOCK        32          /**< samples per fifo read */
+#define ADXL362_RECORDER_TEST_CAPACITY     256         /**< history samples */
+#define ADXL362_RECORDER_TEST_PRE          100         /**< samples before the trigger */
+#define ADXL362_RECORDER_TEST_POST         60          /**< samples from the trigger on */
+
+static adxl362_recorder_handle_t gs_handle;                                                     /**< adxl362 recorder handle */
+static int16_t gs_buf[ADXL362_RECORDER_BUF_LEN(ADXL362_RECORDER_TEST_CAPACITY)];                /**< history buffer */
+static int16_t gs_x[ADXL362_RECORDER_TEST_LEN];                                                 /**< x raw buffer */
+static int16_t gs_y[ADXL362_RECORDER_TEST_LEN];                                                 /**< y raw buffer */
+static int16_t gs_z[ADXL362_RECORDER_TEST_LEN];                                                 /**< z raw buffer */
+static adxl362_recorder_window_t gs_window;                                                     /**< last window */
+static uint32_t gs_windows;                                                                     /**< window number */
+
+/**
+ * @brief     recorder window callback
+ * @param[in] *window pointer to a window structure
+ * @note      the window is kept held, the test releases it later
+ */
+static void a_adxl362_recorder_test_callback(const adxl362_recorder_window_t *window)
+{
+    gs_window = *window;
+    gs_windows++;
+}
+
+/**
+ * @brief     feed a part of the stream in fifo sized blocks
+ * @param[in] first first sample
+ * @param[in] last sample after the part
+ * @param[in] range range of the raw data
+ * @note      none
+ */
+static void a_adxl362_recorder_test_run(uint32_t first, uint32_t last, adxl362_range_t range)
+{
+    uint32_t i;
+    uint16_t n;
+    
+    for (i = first; i < last; i += n)
+    {
+        n = (last - i) < ADXL362_RECORDER_TEST_BLOCK ? (uint16_t)(last - i) : ADXL362_RECORDER_TEST_BLOCK;
+        (void)adxl362_recorder_update_raw(&gs_handle, &gs_x[i], &gs_y[i], &gs_z[i], n, range);
+    }
+}
+
+/**
+ * @brief     check a window against the stream
+ * @param[in] *window pointer to a window structure
+ * @param[in] shift mg per lsb as a power of 2
+ * @return    mismatched samples
+ * @note      the stream index is window->start + k for the k-th window sample
+ */
+static uint32_t a_adxl362_recorder_test_check(const adxl362_recorder_window_t *window, uint8_t shift)
+{
+    uint32_t k;
+    uint32_t s;
+    uint32_t bad;
+    const int16_t *p;
+    
+    bad = 0;
+    for (k = 0; k < window->len; k++)
+    {
+        p = (k < window->first_len) ? &window->first[k * 3] : &window->second[(k - window->first_len) * 3];
+        s = window->start + k;
+        if ((p[0] != gs_x[s] * (1 << shift)) || (p[1] != gs_y[s] * (1 << shift)) || (p[2] != gs_z[s] * (1 << shift)))
+        {
+            bad++;
+        }
+    }
+    
+    return bad;
+}
+
+/**
+ * @brief     recorder test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      records an indexed synthetic stream, checks a pre and post window across the
+ *            buffer wrap, the hold with dropped samples and a shortened window after the
+ *            drop, then reports samples per second, no sensor is needed
+ */
+uint8_t adxl362_recorder_test(uint32_t times)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t j;
+    uint32_t bad;
+    uint32_t loops;
+    double seconds;
+    clock_t start;
+    
+    /* start recorder test */
+    adxl362_interface_debug_print("adxl362: start recorder test.\n");
+    
+    /* every sample carries its index so a window can be checked sample by sample */
+    for (i = 0; i < ADXL362_RECORDER_TEST_LEN; i++)
+    {
+        gs_x[i] = (int16_t)((int32_t)(i % 1000) - 500);
+        gs_y[i] = (int16_t)(i / 1000);
+        gs_z[i] = (int16_t)(250 + (i % 7));
+    }
+    
+    /* keep 100 samples before and 60 from an activity trigger */
+    res = adxl362_recorder_init(&gs_handle, gs_buf, ADXL362_RECORDER_TEST_CAPACITY, ADXL362_RECORDER_TEST_PRE,
+                                ADXL362_RECORDER_TEST_POST, ADXL362_STATUS_ACT, a_adxl362_recorder_test_callback);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: recorder init failed.\n");
+        
+        return 1;
+    }
+    gs_windows = 0;
+    
+    /* the ring wraps before the trigger, a masked status is ignored */
+    a_adxl362_recorder_test_run(0, 448, ADXL362_RANGE_2G);
+    (void)adxl362_recorder_trigger(&gs_handle, ADXL362_STATUS_INACT);
+    a_adxl362_recorder_test_run(448, 480, ADXL362_RANGE_2G);
+    (void)adxl362_recorder_trigger(&gs_handle, ADXL362_STATUS_ACT);
+    a_adxl362_recorder_test_run(480, 608, ADXL362_RANGE_2G);
+    if (gs_windows != 1)
+    {
+        adxl362_interface_debug_print("adxl362: recorder window number check failed.\n");
+        
+        return 1;
+    }
+    bad = a_adxl362_recorder_test_check(&gs_window, 0);
+    adxl362_interface_debug_print("adxl362: window from sample %d, %d + %d samples, %d + %d in the ring, %d bad.\n",
+                                  gs_window.start, gs_window.pre, gs_window.len - gs_window.pre,
+                                  gs_window.first_len, gs_window.second_len, bad);
+    if ((gs_window.start != 480 - ADXL362_RECORDER_TEST_PRE) || (gs_window.pre != ADXL362_RECORDER_TEST_PRE) ||
+        (gs_window.len != ADXL362_RECORDER_TEST_PRE + ADXL362_RECORDER_TEST_POST) ||
+        (gs_window.second == NULL) || (gs_window.status != ADXL362_STATUS_ACT) || (bad != 0))
+    {
+        adxl362_interface_debug_print("adxl362: recorder wrapped window check failed.\n");
+        
+        return 1;
+    }
+    
+    /* a held window survives a full ring, the overflow and a new trigger are counted */
+    (void)adxl362_recorder_trigger(&gs_handle, ADXL362_STATUS_ACT);
+    a_adxl362_recorder_test_run(608, 1024, ADXL362_RANGE_2G);
+    bad = a_adxl362_recorder_test_check(&gs_window, 0);
+    adxl362_interface_debug_print("adxl362: held window has %d bad, %d dropped, %d missed.\n", bad,
+                                  gs_handle.dropped, gs_handle.missed);
+    if ((bad != 0) || (gs_handle.dropped != 1024 - 480 - (ADXL362_RECORDER_TEST_CAPACITY - ADXL362_RECORDER_TEST_PRE)) ||
+        (gs_handle.missed != 1))
+    {
+        adxl362_interface_debug_print("adxl362: recorder hold check failed.\n");
+        
+        return 1;
+    }
+    
+    /* after the release the history restarts, so the next pre part is cut short, 4g is scaled to mg */
+    (void)adxl362_recorder_release(&gs_handle);
+    a_adxl362_recorder_test_run(1024, 1056, ADXL362_RANGE_4G);
+    (void)adxl362_recorder_trigger(&gs_handle, ADXL362_STATUS_ACT);
+    a_adxl362_recorder_test_run(1056, 1152, ADXL362_RANGE_4G);
+    bad = a_adxl362_recorder_test_check(&gs_window, 1);
+    adxl362_interface_debug_print("adxl362: window from sample %d, %d + %d samples, %d bad.\n",
+                                  gs_window.start, gs_window.pre, gs_window.len - gs_window.pre, bad);
+    if ((gs_windows != 2) || (gs_window.start != 1024) || (gs_window.pre != 32) ||
+        (gs_window.len != 32 + ADXL362_RECORDER_TEST_POST) || (bad != 0))
+    {
+        adxl362_interface_debug_print("adxl362: recorder restart check failed.\n");
+        
+        return 1;
+    }
+    (void)adxl362_recorder_release(&gs_handle);
+    
+    /* benchmark */
+    loops = times * 1000;
+    start = clock();
+    for (j = 0; j < loops; j++)
+    {
+        a_adxl362_recorder_test_run(0, ADXL362_RECORDER_TEST_LEN, ADXL362_RANGE_2G);
+    }
+    seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    if (seconds > 0.0)
+    {
+        adxl362_interface_debug_print("adxl362: %0.0f samples/s.\n", (double)loops * ADXL362_RECORDER_TEST_LEN / seconds);
+    }
+    
+    /* finish recorder test */
+    adxl362_interface_debug_print("adxl362: finish recorder test.\n");
+    
+    return 0;
+}
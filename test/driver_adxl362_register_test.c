@@ -76,6 +76,7 @@ uint8_t adxl362_register_test(void)
     adxl362_mode_t mode;
     adxl362_detect_mode_t detect_mode;
     adxl362_detect_trigger_t trigger;
+    adxl362_self_test_report_t report;
 
     /* link interface function */
     DRIVER_ADXL362_LINK_INIT(&gs_handle, adxl362_handle_t);
@@ -2095,6 +2096,22 @@ uint8_t adxl362_register_test(void)
     }
     adxl362_interface_debug_print("adxl362: check self test %s.\n", (enable == ADXL362_BOOL_FALSE) ? "ok" : "error");
     
+    /* adxl362_self_test test */
+    adxl362_interface_debug_print("adxl362: adxl362_self_test test.\n");
+    
+    /* run self test */
+    res = adxl362_self_test(&gs_handle, 3.3f, 32, &report);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: self test failed.\n");
+        (void)adxl362_deinit(&gs_handle);
+        
+        return 1;
+    }
+    adxl362_interface_debug_print("adxl362: self test delta x %0.1fmg y %0.1fmg z %0.1fmg in %d periods.\n",
+                                  report.delta_mg[0], report.delta_mg[1], report.delta_mg[2], report.periods);
+    adxl362_interface_debug_print("adxl362: check self test %s.\n", (report.pass == 1) ? "ok" : "error");
+    
     /* finish register test */
     adxl362_interface_debug_print("adxl362: finish register test.\n");
     (void)adxl362_deinit(&gs_handle);
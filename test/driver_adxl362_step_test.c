@@ -0,0 +1,192 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_step_test.c
+ * @brief     driver adxl362 step test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_adxl362_step_test.h"
+#include <math.h>
+#include <time.h>
+
+/**
+ * @brief adxl362 step test definition
+ */
+#define ADXL362_STEP_TEST_RATE        50                                  /**< odr in Hz */
+#define ADXL362_STEP_TEST_BLOCK       25                                  /**< samples per fifo read */
+#define ADXL362_STEP_TEST_LEN         (ADXL362_STEP_TEST_RATE * 36)       /**< 36s sequence */
+#define ADXL362_STEP_TEST_WALK        20                                  /**< walk seconds at 2 steps/s */
+
+static adxl362_step_handle_t gs_handle;                  /**< adxl362 step handle */
+static int16_t gs_x[ADXL362_STEP_TEST_LEN];              /**< x raw buffer */
+static int16_t gs_y[ADXL362_STEP_TEST_LEN];              /**< y raw buffer */
+static int16_t gs_z[ADXL362_STEP_TEST_LEN];              /**< z raw buffer */
+static adxl362_step_info_t gs_info;                      /**< last reported info */
+static uint32_t gs_reports;                              /**< report number */
+
+/**
+ * @brief     step callback
+ * @param[in] *info pointer to a step info structure
+ * @note      none
+ */
+static void a_adxl362_step_test_callback(adxl362_step_info_t *info)
+{
+    gs_info = *info;
+    gs_reports++;
+}
+
+/**
+ * @brief     run a part of the sequence in fifo sized blocks
+ * @param[in] first first sample
+ * @param[in] last sample after the part
+ * @note      none
+ */
+static void a_adxl362_step_test_run(uint32_t first, uint32_t last)
+{
+    uint32_t i;
+    uint16_t n;
+    
+    for (i = first; i < last; i += n)
+    {
+        n = (last - i) < ADXL362_STEP_TEST_BLOCK ? (uint16_t)(last - i) : ADXL362_STEP_TEST_BLOCK;
+        (void)adxl362_step_update(&gs_handle, &gs_x[i], &gs_y[i], &gs_z[i], n, ADXL362_RANGE_2G);
+    }
+}
+
+/**
+ * @brief     step test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      runs a synthetic still, bump, walk and stop sequence, checks that the bump is not
+ *            counted, the walk is confirmed with the right count and cadence and the stop reports
+ *            a cadence of 0, then reports samples per second, no sensor is needed
+ */
+uint8_t adxl362_step_test(uint32_t times)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t j;
+    uint32_t loops;
+    uint32_t seed;
+    uint32_t steps;
+    adxl362_step_info_t info;
+    double t;
+    double seconds;
+    clock_t start;
+    
+    /* start step test */
+    adxl362_interface_debug_print("adxl362: start step test.\n");
+    
+    /* 5s still, 2 bumps 0.5s apart, 5s still, 20s walk at 2 steps/s and 5s still, all with +-3mg noise */
+    seed = 1;
+    for (i = 0; i < ADXL362_STEP_TEST_LEN; i++)
+    {
+        t = (double)i / ADXL362_STEP_TEST_RATE;
+        seed = seed * 1103515245U + 12345U;
+        gs_x[i] = (int16_t)((int32_t)((seed >> 16) % 7) - 3);
+        gs_y[i] = (int16_t)((int32_t)((seed >> 20) % 7) - 3);
+        gs_z[i] = (int16_t)(1000 + (int32_t)((seed >> 24) % 7) - 3);
+        if ((t >= 5.0) && (t < 6.0))
+        {
+            gs_z[i] += (int16_t)(300.0 * sin(2.0 * 3.14159265358979323846 * 2.0 * (t - 5.0)));
+        }
+        if ((t >= 11.0) && (t < 11.0 + ADXL362_STEP_TEST_WALK))
+        {
+            gs_x[i] += (int16_t)(120.0 * sin(2.0 * 3.14159265358979323846 * 1.0 * (t - 11.0)));
+            gs_z[i] += (int16_t)(300.0 * sin(2.0 * 3.14159265358979323846 * 2.0 * (t - 11.0)));
+        }
+    }
+    
+    /* init at 50Hz with a 50mg floor */
+    res = adxl362_step_init(&gs_handle, ADXL362_ODR_50HZ, 50, a_adxl362_step_test_callback);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: step init failed.\n");
+        
+        return 1;
+    }
+    
+    /* still and bumps are never counted */
+    gs_reports = 0;
+    a_adxl362_step_test_run(0, ADXL362_STEP_TEST_RATE * 11);
+    (void)adxl362_step_get_info(&gs_handle, &info);
+    adxl362_interface_debug_print("adxl362: still and 2 bumps give %d steps.\n", info.steps);
+    if ((info.steps != 0) || (gs_reports != 0))
+    {
+        adxl362_interface_debug_print("adxl362: step regulation check failed.\n");
+        
+        return 1;
+    }
+    
+    /* the walk is confirmed and counted from its first step */
+    a_adxl362_step_test_run(ADXL362_STEP_TEST_RATE * 11, ADXL362_STEP_TEST_RATE * (11 + ADXL362_STEP_TEST_WALK));
+    adxl362_interface_debug_print("adxl362: %ds walk gives %d steps at %d steps/min.\n", ADXL362_STEP_TEST_WALK,
+                                  gs_info.steps, gs_info.cadence);
+    if ((gs_info.steps + 1 < ADXL362_STEP_TEST_WALK * 2) || (gs_info.steps > ADXL362_STEP_TEST_WALK * 2) ||
+        (gs_info.cadence < 118) || (gs_info.cadence > 122))
+    {
+        adxl362_interface_debug_print("adxl362: step walk check failed.\n");
+        
+        return 1;
+    }
+    
+    /* the stop is reported with a cadence of 0 and keeps the count */
+    steps = gs_info.steps;
+    a_adxl362_step_test_run(ADXL362_STEP_TEST_RATE * (11 + ADXL362_STEP_TEST_WALK), ADXL362_STEP_TEST_LEN);
+    adxl362_interface_debug_print("adxl362: stop gives %d steps at %d steps/min.\n", gs_info.steps, gs_info.cadence);
+    if ((gs_info.cadence != 0) || (gs_info.steps != steps))
+    {
+        adxl362_interface_debug_print("adxl362: step stop check failed.\n");
+        
+        return 1;
+    }
+    
+    /* benchmark */
+    loops = times * 200;
+    start = clock();
+    for (j = 0; j < loops; j++)
+    {
+        (void)adxl362_step_update(&gs_handle, gs_x, gs_y, gs_z, ADXL362_STEP_TEST_LEN, ADXL362_RANGE_2G);
+    }
+    seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    if (seconds > 0.0)
+    {
+        adxl362_interface_debug_print("adxl362: %0.0f samples/s.\n", (double)loops * ADXL362_STEP_TEST_LEN / seconds);
+    }
+    
+    /* finish step test */
+    adxl362_interface_debug_print("adxl362: finish step test.\n");
+    
+    return 0;
+}
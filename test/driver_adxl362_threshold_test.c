@@ -0,0 +1,243 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_threshold_test.c
+ * @brief     driver adxl362 threshold test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_adxl362_threshold_test.h"
+#include <time.h>
+
+/**
+ * @brief adxl362 threshold test definition
+ */
+#define ADXL362_THRESHOLD_TEST_LEN        500        /**< sequence length in samples */
+#define ADXL362_THRESHOLD_TEST_EVENTS     16         /**< max recorded events */
+
+static adxl362_threshold_handle_t gs_handle;                                    /**< adxl362 threshold handle */
+static int16_t gs_x[ADXL362_THRESHOLD_TEST_LEN];                                /**< x raw buffer */
+static int16_t gs_y[ADXL362_THRESHOLD_TEST_LEN];                                /**< y raw buffer */
+static int16_t gs_z[ADXL362_THRESHOLD_TEST_LEN];                                /**< z raw buffer */
+static adxl362_threshold_event_t gs_event[ADXL362_THRESHOLD_TEST_EVENTS];       /**< recorded events */
+static uint32_t gs_event_count;                                                 /**< recorded event number */
+
+/**
+ * @brief expected events of the sequence
+ */
+static const struct
+{
+    uint8_t detector;                     /**< detector index */
+    adxl362_threshold_type_t type;        /**< detector type */
+    uint32_t sample;                      /**< sample index */
+} gsc_expected[7] =
+{
+    {1, ADXL362_THRESHOLD_TYPE_INACTIVITY, 49},         /* first still period latches once */
+    {0, ADXL362_THRESHOLD_TYPE_ACTIVITY, 204},          /* shake held for 5 samples */
+    {0, ADXL362_THRESHOLD_TYPE_ACTIVITY, 214},          /* re-armed on the shake, so the return fires too */
+    {1, ADXL362_THRESHOLD_TYPE_INACTIVITY, 260},        /* still again 50 samples after the return */
+    {1, ADXL362_THRESHOLD_TYPE_INACTIVITY, 352},        /* a 2 samples spike breaks the latch */
+    {2, ADXL362_THRESHOLD_TYPE_ACTIVITY, 402},          /* a 3 samples spike reaches the absolute timer */
+    {1, ADXL362_THRESHOLD_TYPE_INACTIVITY, 453},        /* and breaks the latch again */
+};
+
+/**
+ * @brief     threshold event callback
+ * @param[in] *event pointer to an event structure
+ * @note      none
+ */
+static void a_adxl362_threshold_test_callback(adxl362_threshold_event_t *event)
+{
+    if (gs_event_count < ADXL362_THRESHOLD_TEST_EVENTS)
+    {
+        gs_event[gs_event_count] = *event;
+    }
+    gs_event_count++;
+}
+
+/**
+ * @brief     run the sequence in blocks
+ * @param[in] block block length
+ * @note      none
+ */
+static void a_adxl362_threshold_test_run(uint16_t block)
+{
+    uint16_t i;
+    uint16_t n;
+    
+    for (i = 0; i < ADXL362_THRESHOLD_TEST_LEN; i += n)
+    {
+        n = (uint16_t)(ADXL362_THRESHOLD_TEST_LEN - i) < block ? (uint16_t)(ADXL362_THRESHOLD_TEST_LEN - i) : block;
+        (void)adxl362_threshold_update(&gs_handle, &gs_x[i], &gs_y[i], &gs_z[i], n, ADXL362_RANGE_2G);
+    }
+}
+
+/**
+ * @brief     threshold test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      runs a synthetic still, shake and spike sequence through referenced and absolute
+ *            detectors, checks every latch and re-arm event and reports samples per second,
+ *            no sensor is needed
+ */
+uint8_t adxl362_threshold_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t index;
+    uint16_t i;
+    uint32_t j;
+    uint32_t loops;
+    uint32_t status;
+    double seconds;
+    clock_t start;
+    
+    /* start threshold test */
+    adxl362_interface_debug_print("adxl362: start threshold test.\n");
+    
+    /* flat at 1g with +-2mg noise, a 600mg shake, a 2 samples and a 3 samples spike to 1.8g */
+    for (i = 0; i < ADXL362_THRESHOLD_TEST_LEN; i++)
+    {
+        gs_x[i] = (int16_t)((i % 5) - 2);
+        gs_y[i] = (int16_t)((i % 3) - 1);
+        gs_z[i] = (int16_t)(1000 + (i % 4) - 2);
+        if ((i >= 200) && (i < 210))
+        {
+            gs_x[i] += 600;
+        }
+        if (((i >= 300) && (i < 302)) || ((i >= 400) && (i < 403)))
+        {
+            gs_z[i] = 1800;
+        }
+    }
+    
+    /* referenced activity, referenced inactivity and absolute activity */
+    res = adxl362_threshold_init(&gs_handle, a_adxl362_threshold_test_callback);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: threshold init failed.\n");
+        
+        return 1;
+    }
+    res = adxl362_threshold_add_detector(&gs_handle, ADXL362_THRESHOLD_TYPE_ACTIVITY,
+                                         ADXL362_DETECT_TRIGGER_REFERENCED, 250, 5, &index);
+    res |= adxl362_threshold_add_detector(&gs_handle, ADXL362_THRESHOLD_TYPE_INACTIVITY,
+                                          ADXL362_DETECT_TRIGGER_REFERENCED, 100, 50, &index);
+    res |= adxl362_threshold_add_detector(&gs_handle, ADXL362_THRESHOLD_TYPE_ACTIVITY,
+                                          ADXL362_DETECT_TRIGGER_ABSOLUTE, 1500, 3, &index);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: threshold add detector failed.\n");
+        
+        return 1;
+    }
+    
+    /* run the sequence with odd blocks so timers cross the block edges */
+    gs_event_count = 0;
+    a_adxl362_threshold_test_run(37);
+    for (j = 0; j < gs_event_count; j++)
+    {
+        adxl362_interface_debug_print("adxl362: detector %d %s at sample %d.\n", gs_event[j].detector,
+                                      (gs_event[j].type == ADXL362_THRESHOLD_TYPE_ACTIVITY) ? "activity" : "inactivity",
+                                      gs_event[j].sample);
+    }
+    if (gs_event_count != sizeof(gsc_expected) / sizeof(gsc_expected[0]))
+    {
+        adxl362_interface_debug_print("adxl362: threshold event number check failed.\n");
+        
+        return 1;
+    }
+    for (j = 0; j < gs_event_count; j++)
+    {
+        if ((gs_event[j].detector != gsc_expected[j].detector) || (gs_event[j].type != gsc_expected[j].type) ||
+            (gs_event[j].sample != gsc_expected[j].sample))
+        {
+            adxl362_interface_debug_print("adxl362: threshold event %d check failed.\n", j);
+            
+            return 1;
+        }
+    }
+    
+    /* the status latches all detectors once and clears on read */
+    (void)adxl362_threshold_get_status(&gs_handle, &status);
+    adxl362_interface_debug_print("adxl362: status is 0x%02X.\n", status);
+    if (status != 0x07)
+    {
+        adxl362_interface_debug_print("adxl362: threshold status check failed.\n");
+        
+        return 1;
+    }
+    (void)adxl362_threshold_get_status(&gs_handle, &status);
+    if (status != 0)
+    {
+        adxl362_interface_debug_print("adxl362: threshold status clear check failed.\n");
+        
+        return 1;
+    }
+    
+    /* a reset re-arms, so the same sequence gives the same events */
+    (void)adxl362_threshold_reset(&gs_handle);
+    gs_event_count = 0;
+    a_adxl362_threshold_test_run(ADXL362_THRESHOLD_TEST_LEN);
+    adxl362_interface_debug_print("adxl362: %d events after the reset.\n", gs_event_count);
+    if (gs_event_count != sizeof(gsc_expected) / sizeof(gsc_expected[0]))
+    {
+        adxl362_interface_debug_print("adxl362: threshold reset check failed.\n");
+        
+        return 1;
+    }
+    
+    /* benchmark */
+    (void)adxl362_threshold_init(&gs_handle, NULL);
+    for (i = 0; i < ADXL362_THRESHOLD_MAX_DETECTORS; i++)
+    {
+        (void)adxl362_threshold_add_detector(&gs_handle, (adxl362_threshold_type_t)(i & 1),
+                                             ADXL362_DETECT_TRIGGER_REFERENCED, (uint16_t)(100 + i * 50), 5, &index);
+    }
+    loops = times * 2000;
+    start = clock();
+    for (j = 0; j < loops; j++)
+    {
+        a_adxl362_threshold_test_run(ADXL362_THRESHOLD_TEST_LEN);
+    }
+    seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    if (seconds > 0.0)
+    {
+        adxl362_interface_debug_print("adxl362: 16 detectors %0.0f samples/s.\n",
+                                      (double)loops * ADXL362_THRESHOLD_TEST_LEN / seconds);
+    }
+    
+    /* finish threshold test */
+    adxl362_interface_debug_print("adxl362: finish threshold test.\n");
+    
+    return 0;
+}
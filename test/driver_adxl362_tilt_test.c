@@ -0,0 +1,214 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_tilt_test.c
+ * @brief     driver adxl362 tilt test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_adxl362_tilt_test.h"
+#include <math.h>
+#include <time.h>
+
+static adxl362_tilt_handle_t gs_handle;                 /**< adxl362 tilt handle */
+static int16_t gs_x[ADXL362_BLOCK_MAX_LEN];             /**< x raw buffer */
+static int16_t gs_y[ADXL362_BLOCK_MAX_LEN];             /**< y raw buffer */
+static int16_t gs_z[ADXL362_BLOCK_MAX_LEN];             /**< z raw buffer */
+static float gs_pitch[ADXL362_BLOCK_MAX_LEN];           /**< pitch buffer */
+static float gs_roll[ADXL362_BLOCK_MAX_LEN];            /**< roll buffer */
+static float gs_tilt[ADXL362_BLOCK_MAX_LEN];            /**< tilt buffer */
+
+/**
+ * @brief     angle difference
+ * @param[in] a first angle in degrees
+ * @param[in] b second angle in degrees
+ * @return    absolute difference in degrees
+ * @note      +180 and -180 are the same angle
+ */
+static double a_adxl362_tilt_test_diff(double a, double b)
+{
+    double d;
+    
+    d = fabs(a - b);
+    if (d > 180.0)
+    {
+        d = 360.0 - d;
+    }
+    
+    return d;
+}
+
+/**
+ * @brief     tilt test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      checks the approximated angles against libm over all orientations
+ *            and reports samples per second of both, no sensor is needed
+ */
+uint8_t adxl362_tilt_test(uint32_t times)
+{
+    uint8_t res;
+    uint16_t i;
+    uint16_t len;
+    uint32_t j;
+    uint32_t loops;
+    int32_t azimuth;
+    int32_t elevation;
+    double deg;
+    double err[3];
+    double ref;
+    double seconds;
+    float x;
+    float y;
+    float z;
+    clock_t start;
+    
+    /* start tilt test */
+    adxl362_interface_debug_print("adxl362: start tilt test.\n");
+    
+    /* init with no averaging */
+    res = adxl362_tilt_init(&gs_handle, 1);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: tilt init failed.\n");
+        
+        return 1;
+    }
+    
+    /* sweep the sphere with 1g vectors in 1 degree steps */
+    deg = 3.14159265358979323846 / 180.0;
+    err[0] = 0.0;
+    err[1] = 0.0;
+    err[2] = 0.0;
+    for (elevation = -90; elevation <= 90; elevation++)
+    {
+        i = 0;
+        for (azimuth = -180; azimuth < 180; azimuth++)
+        {
+            gs_x[i] = (int16_t)floor(1000.0 * cos(elevation * deg) * cos(azimuth * deg) + 0.5);
+            gs_y[i] = (int16_t)floor(1000.0 * cos(elevation * deg) * sin(azimuth * deg) + 0.5);
+            gs_z[i] = (int16_t)floor(1000.0 * sin(elevation * deg) + 0.5);
+            i++;
+            if ((i == ADXL362_BLOCK_MAX_LEN) || (azimuth == 179))
+            {
+                (void)adxl362_tilt_convert(&gs_handle, gs_x, gs_y, gs_z, i, ADXL362_RANGE_2G,
+                                           gs_pitch, gs_roll, gs_tilt, &len);
+                for (j = 0; j < len; j++)
+                {
+                    ref = atan2(-gs_x[j], sqrt((double)gs_y[j] * gs_y[j] + (double)gs_z[j] * gs_z[j])) / deg;
+                    err[0] = fmax(err[0], a_adxl362_tilt_test_diff(gs_pitch[j], ref));
+                    ref = atan2(gs_y[j], gs_z[j]) / deg;
+                    err[1] = fmax(err[1], a_adxl362_tilt_test_diff(gs_roll[j], ref));
+                    ref = atan2(sqrt((double)gs_x[j] * gs_x[j] + (double)gs_y[j] * gs_y[j]), gs_z[j]) / deg;
+                    err[2] = fmax(err[2], a_adxl362_tilt_test_diff(gs_tilt[j], ref));
+                }
+                i = 0;
+            }
+        }
+    }
+    adxl362_interface_debug_print("adxl362: max pitch error is %0.6f degrees.\n", err[0]);
+    adxl362_interface_debug_print("adxl362: max roll error is %0.6f degrees.\n", err[1]);
+    adxl362_interface_debug_print("adxl362: max tilt error is %0.6f degrees.\n", err[2]);
+    if ((err[0] > 0.001) || (err[1] > 0.001) || (err[2] > 0.001))
+    {
+        adxl362_interface_debug_print("adxl362: tilt accuracy check failed.\n");
+        
+        return 1;
+    }
+    
+    /* a noisy 30 degrees roll block */
+    for (i = 0; i < ADXL362_BLOCK_MAX_LEN; i++)
+    {
+        gs_x[i] = (int16_t)((i % 7) - 3);
+        gs_y[i] = (int16_t)(500 + (i % 5) - 2);
+        gs_z[i] = (int16_t)(866 + (i % 3) - 1);
+    }
+    
+    /* check the averaging */
+    res = adxl362_tilt_init(&gs_handle, 10);
+    if (res != 0)
+    {
+        adxl362_interface_debug_print("adxl362: tilt init failed.\n");
+        
+        return 1;
+    }
+    (void)adxl362_tilt_convert(&gs_handle, gs_x, gs_y, gs_z, ADXL362_BLOCK_MAX_LEN, ADXL362_RANGE_2G,
+                               NULL, gs_roll, NULL, &len);
+    adxl362_interface_debug_print("adxl362: average 10 gives %d angles, roll is %0.3f degrees.\n", len, gs_roll[0]);
+    if ((len != ADXL362_BLOCK_MAX_LEN / 10) || (fabs(gs_roll[0] - 30.0) > 0.1))
+    {
+        adxl362_interface_debug_print("adxl362: tilt average check failed.\n");
+        
+        return 1;
+    }
+    
+    /* fast benchmark */
+    (void)adxl362_tilt_init(&gs_handle, 1);
+    loops = times * 20000;
+    start = clock();
+    for (j = 0; j < loops; j++)
+    {
+        (void)adxl362_tilt_convert(&gs_handle, gs_x, gs_y, gs_z, ADXL362_BLOCK_MAX_LEN, ADXL362_RANGE_2G,
+                                   gs_pitch, gs_roll, gs_tilt, &len);
+    }
+    seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    if (seconds > 0.0)
+    {
+        adxl362_interface_debug_print("adxl362: fast %0.0f samples/s.\n", (double)loops * ADXL362_BLOCK_MAX_LEN / seconds);
+    }
+    
+    /* libm benchmark */
+    start = clock();
+    for (j = 0; j < loops; j++)
+    {
+        for (i = 0; i < ADXL362_BLOCK_MAX_LEN; i++)
+        {
+            x = (float)gs_x[i];
+            y = (float)gs_y[i];
+            z = (float)gs_z[i];
+            gs_pitch[i] = atan2f(-x, sqrtf(y * y + z * z)) * 57.2957795f;
+            gs_roll[i] = atan2f(y, z) * 57.2957795f;
+            gs_tilt[i] = atan2f(sqrtf(x * x + y * y), z) * 57.2957795f;
+        }
+    }
+    seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    if (seconds > 0.0)
+    {
+        adxl362_interface_debug_print("adxl362: libm %0.0f samples/s.\n", (double)loops * ADXL362_BLOCK_MAX_LEN / seconds);
+    }
+    
+    /* finish tilt test */
+    adxl362_interface_debug_print("adxl362: finish tilt test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,221 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_adxl362_trend_test.c
+ * @brief     driver adxl362 trend test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_adxl362_trend_test.h"
+#include <math.h>
+#include <time.h>
+
+/**
+ * @brief trend test definition
+ */
+#define ADXL362_TREND_TEST_LEN        (400 * 60)        /**< made capture length, 60s at 400Hz */
+
+static adxl362_trend_handle_t gs_handle;                        /**< adxl362 trend handle */
+static int16_t gs_capture[ADXL362_TREND_TEST_LEN * 3];          /**< made capture */
+static const int16_t *gs_xyz;                                   /**< capture under test */
+static int16_t gs_x[ADXL362_BLOCK_MAX_LEN];                     /**< x raw buffer */
+static int16_t gs_y[ADXL362_BLOCK_MAX_LEN];                     /**< y raw buffer */
+static int16_t gs_z[ADXL362_BLOCK_MAX_LEN];                     /**< z raw buffer */
+static uint32_t gs_prev_index[3];                               /**< previous breakpoint index */
+static float gs_prev_value[3];                                  /**< previous breakpoint value */
+static double gs_max_error;                                     /**< max error in g */
+
+/**
+ * @brief     breakpoint callback
+ * @param[in] axis axis index
+ * @param[in] index sample index
+ * @param[in] value value in g
+ * @note      checks every sample of the closed segment against the line
+ */
+static void a_adxl362_trend_test_callback(uint8_t axis, uint32_t index, float value)
+{
+    uint32_t k;
+    double v;
+    double e;
+    
+    for (k = gs_prev_index[axis] + 1; (index > gs_prev_index[axis]) && (k <= index); k++)
+    {
+        v = gs_prev_value[axis] + ((double)value - gs_prev_value[axis]) * 
+            (double)(k - gs_prev_index[axis]) / (double)(index - gs_prev_index[axis]);
+        e = fabs(v - (double)gs_xyz[k * 3 + axis] / 1000.0);
+        gs_max_error = e > gs_max_error ? e : gs_max_error;
+    }
+    if (index == 0)
+    {
+        e = fabs((double)value - (double)gs_xyz[axis] / 1000.0);
+        gs_max_error = e > gs_max_error ? e : gs_max_error;
+    }
+    gs_prev_index[axis] = index;
+    gs_prev_value[axis] = value;
+}
+
+/**
+ * @brief     run a capture through the compressor
+ * @param[in] len triplet count
+ * @note      the triplets are split into fifo sized SoA blocks
+ */
+static void a_adxl362_trend_test_run(uint32_t len)
+{
+    uint32_t i;
+    uint16_t j;
+    uint16_t n;
+    
+    for (i = 0; i < len; i += n)
+    {
+        n = (len - i) < ADXL362_BLOCK_MAX_LEN ? (uint16_t)(len - i) : ADXL362_BLOCK_MAX_LEN;
+        for (j = 0; j < n; j++)
+        {
+            gs_x[j] = gs_xyz[(i + j) * 3 + 0];
+            gs_y[j] = gs_xyz[(i + j) * 3 + 1];
+            gs_z[j] = gs_xyz[(i + j) * 3 + 2];
+        }
+        (void)adxl362_trend_update_raw(&gs_handle, gs_x, gs_y, gs_z, n, ADXL362_RANGE_2G);
+    }
+    (void)adxl362_trend_flush(&gs_handle);
+}
+
+/**
+ * @brief     trend test
+ * @param[in] *capture pointer to packed x, y, z triplets in mg, NULL makes a capture
+ * @param[in] len triplet count
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      checks the max error of every segment and reports the compression ratio and
+ *            samples per second for several deviations, no sensor is needed
+ */
+uint8_t adxl362_trend_test(const int16_t *capture, uint32_t len, uint32_t times)
+{
+    uint8_t res;
+    uint8_t d;
+    uint32_t i;
+    uint32_t j;
+    uint32_t seed;
+    double t;
+    double seconds;
+    clock_t start;
+    const float deviation[5] = {2.0f, 5.0f, 10.0f, 20.0f, 50.0f};
+    
+    /* start trend test */
+    adxl362_interface_debug_print("adxl362: start trend test.\n");
+    
+    /* make a capture if none is given */
+    if ((capture == NULL) || (len < 2))
+    {
+        /* 15s still, 15s walking, 15s running machine, 15s slow turn, all with noise */
+        seed = 1;
+        for (i = 0; i < ADXL362_TREND_TEST_LEN; i++)
+        {
+            t = (double)i / 400.0;
+            for (j = 0; j < 3; j++)
+            {
+                seed = seed * 1103515245U + 12345U;
+                gs_capture[i * 3 + j] = (int16_t)((int32_t)((seed >> 16) % 7) - 3);
+            }
+            if (t < 15.0)
+            {
+                gs_capture[i * 3 + 2] += 1000;
+            }
+            else if (t < 30.0)
+            {
+                gs_capture[i * 3 + 0] += (int16_t)(250.0 * sin(2.0 * 3.14159265 * 1.8 * t));
+                gs_capture[i * 3 + 1] += (int16_t)(80.0 * sin(2.0 * 3.14159265 * 0.9 * t));
+                gs_capture[i * 3 + 2] += (int16_t)(1000.0 + 300.0 * fabs(sin(2.0 * 3.14159265 * 1.8 * t)));
+            }
+            else if (t < 45.0)
+            {
+                gs_capture[i * 3 + 0] += (int16_t)(40.0 * sin(2.0 * 3.14159265 * 25.0 * t));
+                gs_capture[i * 3 + 1] += (int16_t)(20.0 * sin(2.0 * 3.14159265 * 50.0 * t));
+                gs_capture[i * 3 + 2] += 1000;
+            }
+            else
+            {
+                gs_capture[i * 3 + 0] += (int16_t)(1000.0 * sin((t - 45.0) / 15.0 * 1.5707963));
+                gs_capture[i * 3 + 2] += (int16_t)(1000.0 * cos((t - 45.0) / 15.0 * 1.5707963));
+            }
+        }
+        capture = gs_capture;
+        len = ADXL362_TREND_TEST_LEN;
+        adxl362_interface_debug_print("adxl362: made a %d samples capture.\n", len);
+    }
+    else
+    {
+        adxl362_interface_debug_print("adxl362: capture has %d samples.\n", len);
+    }
+    gs_xyz = capture;
+    
+    /* check the error bound and the ratio */
+    for (d = 0; d < 5; d++)
+    {
+        res = adxl362_trend_init(&gs_handle, deviation[d], 0, a_adxl362_trend_test_callback);
+        if (res != 0)
+        {
+            adxl362_interface_debug_print("adxl362: trend init failed.\n");
+            
+            return 1;
+        }
+        gs_max_error = 0.0;
+        a_adxl362_trend_test_run(len);
+        adxl362_interface_debug_print("adxl362: deviation %0.0fmg, %d breakpoints, ratio %0.1f, max error %0.3fmg.\n",
+                                      deviation[d], gs_handle.points, (double)len * 3.0 / gs_handle.points,
+                                      gs_max_error * 1000.0);
+        if (gs_max_error * 1000.0 > deviation[d] * 1.0001 + 0.001)
+        {
+            adxl362_interface_debug_print("adxl362: trend error bound check failed.\n");
+            
+            return 1;
+        }
+    }
+    
+    /* benchmark */
+    (void)adxl362_trend_init(&gs_handle, 10.0f, 0, NULL);
+    start = clock();
+    for (j = 0; j < times; j++)
+    {
+        a_adxl362_trend_test_run(len);
+    }
+    seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    if (seconds > 0.0)
+    {
+        adxl362_interface_debug_print("adxl362: %0.0f samples/s.\n", (double)len * times / seconds);
+    }
+    
+    /* finish trend test */
+    adxl362_interface_debug_print("adxl362: finish trend test.\n");
+    
+    return 0;
+}